@@ -0,0 +1,109 @@
+#region Usings
+
+using System;
+using System.Collections.Generic;
+using System.Linq;
+
+#endregion
+
+namespace Harp.Olfactometer.Design.Models
+{
+    public class CalibrationSweep
+    {
+        // same limits as the CalibrationCurve register on the device
+        public const int CurvePoints = 32;
+        public const int CurveSize = 2 + CurvePoints * 2;
+        private const ushort SplineFlag = 0x100;
+
+        public class Point
+        {
+            public int Step { get; set; }
+            public float DutyCycle { get; set; }
+            public ushort Code { get; set; }
+            public float? ReferenceFlow { get; set; }
+        }
+
+        public int Channel { get; }
+        public List<Point> Points { get; }
+
+        public CalibrationSweep(int channel)
+        {
+            Channel = channel;
+            Points = new List<Point>();
+        }
+
+        public List<Point> AddData(ushort[] payload)
+        {
+            // CalibrationSweepData: first step, number of points, then pairs of duty cycle (0.1 %) and code
+            int first = payload[0];
+            int count = payload[1];
+            var added = new List<Point>();
+
+            for (int i = 0; i < count; i++)
+            {
+                // the same batch is read again while it fills, keep the reference flow already entered
+                var point = Points.Find(p => p.Step == first + i);
+                if (point == null)
+                {
+                    point = new Point { Step = first + i };
+                    Points.Add(point);
+                    added.Add(point);
+                }
+
+                point.DutyCycle = payload[2 + i * 2] / 10.0f;
+                point.Code = payload[3 + i * 2];
+            }
+
+            return added;
+        }
+
+        public ushort[] BuildCurve(bool spline)
+        {
+            // only the steps with a reference flow, ordered by code
+            var measured = Points
+                .Where(p => p.ReferenceFlow.HasValue)
+                .OrderBy(p => p.Code)
+                .GroupBy(p => p.Code)
+                .Select(g => new[] { (double)g.Key, g.Average(p => p.ReferenceFlow.Value) })
+                .ToList();
+
+            if (measured.Count < 2)
+                throw new InvalidOperationException("At least two steps with a reference flow are needed.");
+
+            // the device needs the flow to never decrease with the code, so neighbours that
+            // break it are pooled into their mean (pool adjacent violators)
+            var blocks = new List<double[]>();
+            foreach (var point in measured)
+            {
+                blocks.Add(new[] { point[0], point[1], 1 });
+                while (blocks.Count > 1 && blocks[blocks.Count - 2][1] > blocks[blocks.Count - 1][1])
+                {
+                    var last = blocks[blocks.Count - 1];
+                    var previous = blocks[blocks.Count - 2];
+                    var weight = previous[2] + last[2];
+                    previous[1] = (previous[1] * previous[2] + last[1] * last[2]) / weight;
+                    previous[2] = weight;
+                    blocks.RemoveAt(blocks.Count - 1);
+                }
+            }
+
+            // evenly spread over the points when there are more than the device takes
+            var count = Math.Min(blocks.Count, CurvePoints);
+            if (count < 2)
+                throw new InvalidOperationException("The reference flows do not increase with the code.");
+
+            var curve = new ushort[CurveSize];
+            curve[0] = (ushort)(Channel | (spline ? SplineFlag : 0));
+            curve[1] = (ushort)count;
+
+            for (int i = 0; i < count; i++)
+            {
+                var block = blocks[(int)Math.Round(i * (blocks.Count - 1) / (double)(count - 1))];
+                curve[2 + i * 2] = (ushort)block[0];
+                curve[3 + i * 2] = (ushort)Math.Round(block[1] * 10);
+            }
+
+            return curve;
+        }
+    }
+}
@@ -53,11 +53,15 @@ namespace Harp.Olfactometer.Design.Models
             // using the HexIO nuget package, create the EEPROM file by adding Data starting in address 0x10064000
             const int baseOffset = 100;
             const int dataSize = 6;
+            const int recordOffset = 112;
             var testData = new List<byte>
             {
                 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
             };
 
+            // the versioned calibration record follows the legacy rows, built before the temperature is merged into Data
+            var record = BuildCalibrationRecord(dataSize, temperature);
+
             // create memory stream
             stream = new MemoryStream();
             Encoding utf8WithoutBom = new UTF8Encoding(false);
@@ -118,6 +122,16 @@ namespace Harp.Olfactometer.Design.Models
                     // FIXME: this is a hack to get the correct offset
                     i += dataSize - 1;
                 }
+                else if (i >= recordOffset && (i - recordOffset) * 0x10 < record.Length)
+                {
+                    // unused bytes of the last line are left erased
+                    var line = new List<byte>(testData);
+                    var start = (i - recordOffset) * 0x10;
+                    for (int j = 0; j < 0x10 && start + j < record.Length; j++)
+                        line[j] = record[start + j];
+
+                    writer.WriteDataRecord((ushort)(i * 0x10), line);
+                }
                 else
                 {
                     // special case for the first Data record since we will need to add the serial number
@@ -148,6 +162,49 @@ namespace Harp.Olfactometer.Design.Models
             stream.Position = 0;
         }
 
+        private byte[] BuildCalibrationRecord(int dataSize, int temperature)
+        {
+            // must match the record read by init_calibration_values() in the firmware:
+            // mark, version, number of tables, points per table, the tables MSB first, temperature and CRC16
+            const byte recordMark = 0xCA;
+            const byte recordVersion = 1;
+            const int points = 11;
+
+            var record = new List<byte> { recordMark, recordVersion, (byte)dataSize, points };
+
+            for (int k = 0; k < dataSize; k++)
+            {
+                for (int j = 0; j < points; j++)
+                {
+                    record.Add((byte)(Data[k][j] >> 8));
+                    record.Add((byte)(Data[k][j] & 0xFF));
+                }
+            }
+
+            record.Add(Convert.ToByte(temperature));
+
+            var crc = Crc16(record);
+            record.Add((byte)(crc >> 8));
+            record.Add((byte)(crc & 0xFF));
+
+            return record.ToArray();
+        }
+
+        private static ushort Crc16(IEnumerable<byte> data)
+        {
+            // CRC-16/CCITT with 0xFFFF seed, same as _crc_xmodem_update() on the device
+            ushort crc = 0xFFFF;
+
+            foreach (var value in data)
+            {
+                crc ^= (ushort)(value << 8);
+                for (int bit = 0; bit < 8; bit++)
+                    crc = (crc & 0x8000) != 0 ? (ushort)((crc << 1) ^ 0x1021) : (ushort)(crc << 1);
+            }
+
+            return crc;
+        }
+
         public void Save(string filename)
         {
             // save stream field to file
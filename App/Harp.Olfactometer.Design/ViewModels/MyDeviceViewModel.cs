@@ -2043,6 +2043,18 @@ public class OlfactometerViewModel : ViewModelBase
 
     #endregion
 
+    #region Calibration Sweep
+
+    [Reactive] public int CalibrationSweepChannel { get; set; }
+    [Reactive] public bool CalibrationSweepRunning { get; set; }
+    [Reactive] public bool CalibrationCurveSpline { get; set; }
+    [Reactive] public ObservableCollection<Models.CalibrationSweep.Point> CalibrationSweepPoints { get; set; } = new ObservableCollection<Models.CalibrationSweep.Point>();
+
+    public ReactiveCommand<Unit, Unit> StartCalibrationSweepCommand { get; }
+    public ReactiveCommand<Unit, Unit> UploadCalibrationCurveCommand { get; }
+
+    #endregion
+
     #region Application State
 
     [ObservableAsProperty] public bool IsLoadingPorts { get; }
@@ -2075,6 +2087,7 @@ public class OlfactometerViewModel : ViewModelBase
     private IObservable<string> _deviceEventsObservable;
     private IDisposable? _deviceEventsSubscription;
     private IObservable<long> _actualFlowObservable;
+    private Models.CalibrationSweep? _calibrationSweep;
 
     public OlfactometerViewModel()
     {
@@ -2145,6 +2158,14 @@ public class OlfactometerViewModel : ViewModelBase
         DO1SetClearCommand.ThrownExceptions.Subscribe(ex =>
             //Log.Error(ex, "Error setting/clearing DO1 with error: {Exception}", ex));
             Console.WriteLine($"Error setting/clearing DO1 with error: {ex}"));
+
+        StartCalibrationSweepCommand = ReactiveCommand.CreateFromObservable(StartCalibrationSweep, canChangeConfig);
+        StartCalibrationSweepCommand.ThrownExceptions.Subscribe(ex =>
+            Console.WriteLine($"Error starting the calibration sweep with error: {ex}"));
+
+        UploadCalibrationCurveCommand = ReactiveCommand.CreateFromObservable(UploadCalibrationCurve, canChangeConfig);
+        UploadCalibrationCurveCommand.ThrownExceptions.Subscribe(ex =>
+            Console.WriteLine($"Error uploading the calibration curve with error: {ex}"));
         
 
         this.WhenAnyValue(x => x.HardwareVersion)
@@ -2754,6 +2775,26 @@ public class OlfactometerViewModel : ViewModelBase
                     DigitalOutputState = await _device.ReadDigitalOutputStateAsync(cancellationToken);
                     observer.OnNext($"DigitalOutputState: {DigitalOutputState}");
 
+                    // Collect the points of the calibration sweep until it ends
+                    var sweep = _calibrationSweep;
+                    if (CalibrationSweepRunning && sweep != null)
+                    {
+                        // read the state first so that the last points are collected with it
+                        var sweepState = await device.ReadCalibrationSweepAsync(cancellationToken);
+                        var sweepData = await device.ReadCalibrationSweepDataAsync(cancellationToken);
+                        foreach (var point in sweep.AddData(sweepData))
+                        {
+                            RxApp.MainThreadScheduler.Schedule(() => CalibrationSweepPoints.Add(point));
+                            observer.OnNext($"CalibrationSweepData: step {point.Step}, {point.DutyCycle} %, code {point.Code}");
+                        }
+
+                        if (!sweepState.Run)
+                        {
+                            CalibrationSweepRunning = false;
+                            observer.OnNext($"CalibrationSweep: {sweepState}");
+                        }
+                    }
+
                     // Wait a short while before polling again. Adjust delay as necessary.
                     await Task.Delay(TimeSpan.FromMilliseconds(10), cancellationToken);
                 }
@@ -3031,6 +3072,41 @@ public class OlfactometerViewModel : ViewModelBase
         });
     }
 
+    private IObservable<Unit> StartCalibrationSweep()
+    {
+        return Observable.StartAsync(async () =>
+        {
+            if (_device == null)
+                throw new Exception("Device not connected");
+
+            await WriteAndLogAsync(
+                value => _device.WriteCalibrationSweepAsync(value),
+                new CalibrationSweepPayload((byte)CalibrationSweepChannel, true),
+                "CalibrationSweep");
+
+            // the points of the previous sweep are dropped with their reference flows
+            _calibrationSweep = new Models.CalibrationSweep(CalibrationSweepChannel);
+            RxApp.MainThreadScheduler.Schedule(() => CalibrationSweepPoints.Clear());
+            CalibrationSweepRunning = true;
+        });
+    }
+
+    private IObservable<Unit> UploadCalibrationCurve()
+    {
+        return Observable.StartAsync(async () =>
+        {
+            if (_device == null)
+                throw new Exception("Device not connected");
+            if (_calibrationSweep == null)
+                throw new Exception("Run a calibration sweep first");
+
+            await WriteAndLogAsync(
+                value => _device.WriteCalibrationCurveAsync(value),
+                _calibrationSweep.BuildCurve(CalibrationCurveSpline),
+                "CalibrationCurve");
+        });
+    }
+
     private IObservable<Unit> ResetConfiguration()
     {
         return Observable.StartAsync(async () =>
@@ -9,9 +9,11 @@
 #include "usart_driver.h"
 
 #include "aux_funcs.h"
+#include "profiler.h"
 
 #define F_CPU 32000000 //need to be defined for delay.h
 #include <util/delay.h>
+#include <util/crc16.h>
 
 /************************************************************************/
 /* Declare application registers                                        */
@@ -22,6 +24,9 @@ extern uint16_t app_regs_n_elements[];
 extern uint8_t *app_regs_pointer[];
 extern void (*app_func_rd_pointer[])(void);
 extern bool (*app_func_wr_pointer[])(void*);
+
+extern uint32_t adc_frame_cycles; // profiler.c
+
 countdown_t pulse_countdown;
 status_PWM_DC_t status_DC;
 
@@ -32,7 +37,6 @@ uint8_t ADC_sampling_counter = 0;
 #define CLOSE_LOOP_TIMING 5 //2*1*5ms 
 uint8_t close_loop_counter_ms = 0;
 uint8_t close_loop_case = 0;
-uint8_t calibration_size = 11; //number of array positions for calibration
 uint8_t standby_mfcs = 5;
 
 uint16_t CH0_calibration_values [] = {3259, 3819, 4336, 4824, 5284, 5722, 6144, 6549, 6928, 7283, 7636};	
@@ -41,6 +45,144 @@ uint16_t CH2_calibration_values [] = {3259, 3819, 4336, 4824, 5284, 5722, 6144,
 uint16_t CH3_calibration_values [] = {3259, 3819, 4336, 4824, 5284, 5722, 6144, 6549, 6928, 7283, 7636};
 uint16_t CH4_calibration_values [] = {3391, 5176, 6389, 7357, 8166, 8872, 9493, 10060, 10554, 11006, 11430};
 uint16_t CH3_calibration_aux_values [] = {3391, 5176, 6389, 7357, 8166, 8872, 9493, 10060, 10554, 11006, 11430};
+
+
+/************************************************************************/
+/* Flow channels                                                        */
+/************************************************************************/
+/* Channel 3 has a 100 and a 1000 ml/min range, the fields that depend  */
+/* on it are set by update_channel3_range(). The extra lookup is the    */
+/* 1000 ml/min one of channel 3, kept while it is in auto range.        */
+#define CH3_AUTO_RANGE_LUT FLOW_CHANNELS
+
+calibration_lut_t calibration_luts[FLOW_CHANNELS + 1];
+
+flow_channel_t flow_channels[FLOW_CHANNELS] = {
+	{
+		.timer = &TCC0, .timer_type1 = false,
+		.frequency = &app_regs.REG_CHANNEL0_FREQUENCY, .target_flow = &app_regs.REG_CHANNEL0_TARGET_FLOW,
+		.actual_flow = &app_regs.REG_CHANNEL0_ACTUAL_FLOW, .duty_cycle = &app_regs.REG_CHANNEL0_DUTY_CYCLE,
+		.calibration = CH0_calibration_values, .user_calibration = app_regs.REG_CHANNEL0_USER_CALIBRATION, .lut = &calibration_luts[0],
+		.full_scale = 100, .overflow_flow = 500,
+		.temperature_gain = 5, .gain_divider = 32, .mfc = 0, .mfc_divider = 1,
+		.add_actual_flow = ADD_REG_CHANNEL0_ACTUAL_FLOW
+	},
+	{
+		.timer = &TCD0, .timer_type1 = false,
+		.frequency = &app_regs.REG_CHANNEL1_FREQUENCY, .target_flow = &app_regs.REG_CHANNEL1_TARGET_FLOW,
+		.actual_flow = &app_regs.REG_CHANNEL1_ACTUAL_FLOW, .duty_cycle = &app_regs.REG_CHANNEL1_DUTY_CYCLE,
+		.calibration = CH1_calibration_values, .user_calibration = app_regs.REG_CHANNEL1_USER_CALIBRATION, .lut = &calibration_luts[1],
+		.full_scale = 100, .overflow_flow = 500,
+		.temperature_gain = 5, .gain_divider = 32, .mfc = 1, .mfc_divider = 1,
+		.add_actual_flow = ADD_REG_CHANNEL1_ACTUAL_FLOW
+	},
+	{
+		.timer = &TCE0, .timer_type1 = false,
+		.frequency = &app_regs.REG_CHANNEL2_FREQUENCY, .target_flow = &app_regs.REG_CHANNEL2_TARGET_FLOW,
+		.actual_flow = &app_regs.REG_CHANNEL2_ACTUAL_FLOW, .duty_cycle = &app_regs.REG_CHANNEL2_DUTY_CYCLE,
+		.calibration = CH2_calibration_values, .user_calibration = app_regs.REG_CHANNEL2_USER_CALIBRATION, .lut = &calibration_luts[2],
+		.full_scale = 100, .overflow_flow = 500,
+		.temperature_gain = 5, .gain_divider = 32, .mfc = 2, .mfc_divider = 1,
+		.add_actual_flow = ADD_REG_CHANNEL2_ACTUAL_FLOW
+	},
+	{
+		.timer = &TCF0, .timer_type1 = false,
+		.frequency = &app_regs.REG_CHANNEL3_FREQUENCY, .target_flow = &app_regs.REG_CHANNEL3_TARGET_FLOW,
+		.actual_flow = &app_regs.REG_CHANNEL3_ACTUAL_FLOW, .duty_cycle = &app_regs.REG_CHANNEL3_DUTY_CYCLE,
+		.calibration = CH3_calibration_values, .user_calibration = app_regs.REG_CHANNEL3_USER_CALIBRATION, .lut = &calibration_luts[3],
+		.full_scale = 100, .overflow_flow = 500,
+		.temperature_gain = 2.5, .gain_divider = 256, .mfc = 3, .mfc_divider = 10,
+		.add_actual_flow = ADD_REG_CHANNEL3_ACTUAL_FLOW
+	},
+	{
+		.timer = (TC0_t*)&TCD1, .timer_type1 = true,
+		.frequency = &app_regs.REG_CHANNEL4_FREQUENCY, .target_flow = &app_regs.REG_CHANNEL4_TARGET_FLOW,
+		.actual_flow = &app_regs.REG_CHANNEL4_ACTUAL_FLOW, .duty_cycle = &app_regs.REG_CHANNEL4_DUTY_CYCLE,
+		.calibration = CH4_calibration_values, .user_calibration = app_regs.REG_CHANNEL4_USER_CALIBRATION, .lut = &calibration_luts[4],
+		.full_scale = 1000, .overflow_flow = 3000,
+		.temperature_gain = 5, .gain_divider = 256, .mfc = 4, .mfc_divider = 1,
+		.add_actual_flow = ADD_REG_CHANNEL4_ACTUAL_FLOW
+	}
+};
+
+typedef struct
+{
+	uint16_t *calibration;
+	uint16_t *user_calibration;
+	uint16_t full_scale;
+	uint16_t overflow_flow;
+	float temperature_gain;
+	uint16_t gain_divider;
+	uint8_t mfc_divider;
+} flow_range_t;
+
+/* Indexed by GM_FLOW_100 and GM_FLOW_1000 */
+static const flow_range_t channel3_ranges[2] = {
+	{ CH3_calibration_values, app_regs.REG_CHANNEL3_USER_CALIBRATION, 100, 500, 2.5, 256, 10 },
+	{ CH3_calibration_aux_values, app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX, 1000, 3000, 5, 256, 1 }
+};
+
+/* With GM_FLOW_AUTO the range follows the setpoint and the measured    */
+/* flow. It goes up above the 100 ml/min full scale and only comes back */
+/* once both are below CH3_RANGE_DOWN, so it does not toggle around it. */
+#define CH3_RANGE_UP 100
+#define CH3_RANGE_UP_MEASURED 110
+#define CH3_RANGE_DOWN 90
+
+uint8_t channel3_range = GM_FLOW_100; // range in use, also in auto range
+
+static bool channel3_auto_range(void)
+{
+	return (app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_AUTO;
+}
+
+static void set_channel3_range(uint8_t range)
+{
+	flow_channel_t *channel = &flow_channels[3];
+	const flow_range_t *config = &channel3_ranges[range];
+	
+	channel->calibration = config->calibration;
+	channel->user_calibration = config->user_calibration;
+	channel->full_scale = config->full_scale;
+	channel->overflow_flow = config->overflow_flow;
+	channel->temperature_gain = config->temperature_gain;
+	channel->gain_divider = config->gain_divider;
+	channel->mfc_divider = config->mfc_divider;
+	
+	/* Both lookups are resident in auto range, switching is a pointer */
+	if (range == GM_FLOW_1000 && channel3_auto_range())
+		channel->lut = &calibration_luts[CH3_AUTO_RANGE_LUT];
+	else
+		channel->lut = &calibration_luts[3];
+	
+	channel3_range = range;
+}
+
+void update_channel3_range(void)
+{
+	uint8_t range = app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG;
+	
+	if (range == GM_FLOW_AUTO)
+		range = (app_regs.REG_CHANNEL3_TARGET_FLOW > CH3_RANGE_UP) ? GM_FLOW_1000 : GM_FLOW_100;
+	
+	set_channel3_range(range);
+}
+
+static void auto_range_channel3(void)
+{
+	float target = app_regs.REG_CHANNEL3_TARGET_FLOW;
+	float actual = app_regs.REG_CHANNEL3_ACTUAL_FLOW;
+	
+	if (channel3_range == GM_FLOW_100)
+	{
+		if (target > CH3_RANGE_UP || actual > CH3_RANGE_UP_MEASURED)
+			set_channel3_range(GM_FLOW_1000);
+	}
+	else if (target < CH3_RANGE_DOWN && actual < CH3_RANGE_DOWN)
+	{
+		set_channel3_range(GM_FLOW_100);
+	}
+}
 	
 #define _1_CLOCK_CYCLES asm ( "nop \n")
 #define _2_CLOCK_CYCLES _1_CLOCK_CYCLES; _1_CLOCK_CYCLES
@@ -122,11 +264,8 @@ void init_mfcs()
 {
 	if(read_VERSION_CTRL){
 		mfcs = 1;
-		status_DC.flow0_update = 1;
-		status_DC.flow1_update = 1;
-		status_DC.flow2_update = 1;
-		status_DC.flow3_update = 1;
-		status_DC.flow4_update = 1;
+		for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+			status_DC.flow_update[i] = 1;
 	}
 	else{
 		mfcs = 0;
@@ -287,197 +426,382 @@ void read_temperature() //~50us
 /* Read calibration values from EEPROM                                  */
 /************************************************************************/
 
+/* The factory calibration is written by the App in two layouts. The    */
+/* legacy one has a 32 bytes row per table from CALIBRATION_EEPROM and  */
+/* the temperature at +182. The record that follows it has a header,    */
+/* the same tables and a CRC16 (CCITT, 0xFFFF seed) of all the bytes    */
+/* before it. Values are stored MSB first in both.                      */
+/* The EEPROM is read once, later calls only use the tables in RAM.     */
+#define CALIBRATION_EEPROM 1600
+#define CALIBRATION_EEPROM_ROW 32
+#define CALIBRATION_EEPROM_TEMPERATURE (CALIBRATION_EEPROM + 182)
+#define CALIBRATION_RECORD_EEPROM 1792
+#define CALIBRATION_RECORD_MARK 0xCA
+#define CALIBRATION_RECORD_VERSION 1
+#define CALIBRATION_TABLES 6
+#define CALIBRATION_RECORD_HEADER 4 // mark, version, tables, points
+#define CALIBRATION_RECORD_SIZE (CALIBRATION_RECORD_HEADER + CALIBRATION_TABLES * CALIBRATION_POINTS * 2 + 1 + 2)
+
+/* Same order in both layouts */
+static uint16_t * const calibration_tables[CALIBRATION_TABLES] = {
+	CH0_calibration_values,
+	CH1_calibration_values,
+	CH2_calibration_values,
+	CH3_calibration_values,
+	CH4_calibration_values,
+	CH3_calibration_aux_values
+};
+
+uint8_t calibration_source = GM_CALIBRATION_BUILT_IN;
+bool calibration_record_damaged = false;
+uint8_t calibration_temperature;
+bool calibration_loaded = false;
+
+/* The core library only exports eeprm_is_busy(), so the background     */
+/* EEPROM writers check the NVM controller themselves.                  */
+static bool eeprom_busy(void)
+{
+	return NVM.STATUS & NVM_NVMBUSY_bm;
+}
+
+static void eeprom_rd_block(uint16_t address, uint8_t *data, uint16_t size)
+{
+	while (size--)
+		*data++ = eeprom_rd_byte(address++);
+}
+
+static void unpack_calibration_table(uint16_t *table, uint8_t *data)
+{
+	for (uint8_t i = 0; i < CALIBRATION_POINTS; i++, data += 2)
+		table[i] = ((uint16_t)data[0] << 8) | data[1];
+}
+
+static uint8_t load_calibration_values(void)
+{
+	uint8_t record[CALIBRATION_RECORD_SIZE];
+	uint16_t crc = 0xFFFF;
+	
+	eeprom_rd_block(CALIBRATION_RECORD_EEPROM, record, CALIBRATION_RECORD_SIZE);
+	
+	if (record[0] == CALIBRATION_RECORD_MARK && record[1] == CALIBRATION_RECORD_VERSION)
+	{
+		for (uint8_t i = 0; i < CALIBRATION_RECORD_SIZE - 2; i++)
+			crc = _crc_xmodem_update(crc, record[i]);
+		
+		if (record[2] == CALIBRATION_TABLES && record[3] == CALIBRATION_POINTS &&
+			crc == (((uint16_t)record[CALIBRATION_RECORD_SIZE - 2] << 8) | record[CALIBRATION_RECORD_SIZE - 1]))
+		{
+			for (uint8_t t = 0; t < CALIBRATION_TABLES; t++)
+				unpack_calibration_table(calibration_tables[t], &record[CALIBRATION_RECORD_HEADER + t * CALIBRATION_POINTS * 2]);
+			calibration_temperature = record[CALIBRATION_RECORD_SIZE - 3];
+			return GM_CALIBRATION_RECORD;
+		}
+		
+		/* A damaged record falls back to the legacy rows, written together with it */
+		calibration_record_damaged = true;
+	}
+	
+	/* Devices programmed before the record existed */
+	if (eeprom_rd_byte(CALIBRATION_EEPROM) == 0) // no data in EEPROM
+		return GM_CALIBRATION_BUILT_IN;
+	
+	for (uint8_t t = 0; t < CALIBRATION_TABLES; t++)
+	{
+		eeprom_rd_block(CALIBRATION_EEPROM + t * CALIBRATION_EEPROM_ROW, record, CALIBRATION_POINTS * 2);
+		unpack_calibration_table(calibration_tables[t], record);
+	}
+	calibration_temperature = eeprom_rd_byte(CALIBRATION_EEPROM_TEMPERATURE);
+	return GM_CALIBRATION_LEGACY;
+}
+
 void init_calibration_values(void)
 {
+	if (!calibration_loaded)
+	{
+		calibration_source = load_calibration_values();
+		calibration_loaded = true;
+	}
+	
+	// no initialization performed without data in the EEPROM, and the USER_CALIBRATION registers are used as they are
+	if (calibration_source != GM_CALIBRATION_BUILT_IN && !app_regs.REG_USER_CALIBRATION_ENABLE)
+	{
+		if (mfcs){
+			for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++){
+				for (uint8_t i = 0; i < CALIBRATION_POINTS; i++){
+					float decade = 16383/10*i;
+					flow_channels[channel].calibration[i] = (uint16_t)decade/flow_channels[channel].mfc_divider;
+				}
+			}
+		}
+		else if (app_regs.REG_TEMP_USER_CALIBRATION == 0){
+			app_regs.REG_TEMP_USER_CALIBRATION = calibration_temperature; //factory temp calibration - can be override for user calibration by just setting REG_TEMP_USER_CALIBRATION and write permanently
+		}
+	}
+	
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+		compile_calibration(channel);
+}
+
+
+/************************************************************************/
+/* Calibration profiles                                                 */
+/************************************************************************/
+/* Each channel has CALIBRATION_PROFILES slots in the EEPROM with a     */
+/* name, the points (MSB first) and a CRC16 of both, written last. A    */
+/* selected profile is read once and compiled, the loop never waits.    */
+#define CALIBRATION_PROFILE_EEPROM 1120
+#define CALIBRATION_PROFILE_SIZE (CALIBRATION_PROFILE_NAME_SIZE + CALIBRATION_POINTS * 2 + 2)
+#define CALIBRATION_PROFILE_ADDRESS(channel, slot) (CALIBRATION_PROFILE_EEPROM + ((channel) * CALIBRATION_PROFILES + (slot) - 1) * CALIBRATION_PROFILE_SIZE)
+
+uint16_t profile_values[FLOW_CHANNELS][CALIBRATION_POINTS];
+uint8_t profile_eeprom_image[CALIBRATION_PROFILE_SIZE];
+uint16_t profile_eeprom_address;
+uint8_t profile_eeprom_step = CALIBRATION_PROFILE_SIZE;
+
+static uint16_t calibration_crc(uint8_t *data, uint8_t size)
+{
+	uint16_t crc = 0xFFFF;
 	
+	while (size--)
+		crc = _crc_xmodem_update(crc, *data++);
+	return crc;
+}
+
+static bool load_calibration_profile(uint8_t channel, uint8_t slot, uint16_t *values, uint8_t *name)
+{
+	uint8_t profile[CALIBRATION_PROFILE_SIZE];
+	uint16_t crc;
 	
-	//uint16_t CHX_calibration_values;
-	uint16_t index0 = 1600;
-	uint16_t index = 0;
-	uint8_t user_calibration = 0;
+	/* A save in progress on the same slot is not complete yet */
+	if (profile_eeprom_step < CALIBRATION_PROFILE_SIZE && profile_eeprom_address == CALIBRATION_PROFILE_ADDRESS(channel, slot))
+		return false;
 	
-	index = index0;
-	user_calibration = app_regs.REG_USER_CALIBRATION_ENABLE;
+	eeprom_rd_block(CALIBRATION_PROFILE_ADDRESS(channel, slot), profile, CALIBRATION_PROFILE_SIZE);
+	crc = ((uint16_t)profile[CALIBRATION_PROFILE_SIZE - 2] << 8) | profile[CALIBRATION_PROFILE_SIZE - 1];
 	
-	CH0_calibration_values[0] = eeprom_rd_byte(index);
+	if (crc != calibration_crc(profile, CALIBRATION_PROFILE_SIZE - 2))
+		return false;
 	
-	if (CH0_calibration_values[0] == 0) // no data in EEPROM, no initialization performed
-		return;
+	for (uint8_t i = 0; i < CALIBRATION_PROFILE_NAME_SIZE; i++)
+		name[i] = profile[i];
+	unpack_calibration_table(values, &profile[CALIBRATION_PROFILE_NAME_SIZE]);
+	return true;
+}
+
+/* All the profiles are read before any channel switches, so a missing */
+/* or damaged one leaves every channel as it was.                       */
+bool select_calibration_profiles(uint8_t *profiles)
+{
+	uint16_t values[FLOW_CHANNELS][CALIBRATION_POINTS];
+	uint8_t name[CALIBRATION_PROFILE_NAME_SIZE];
+	bool named = false;
+	
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+	{
+		if (!profiles[channel])
+			continue;
+		
+		if (!load_calibration_profile(channel, profiles[channel], values[channel], name))
+			return false;
+		named = true;
+	}
+	
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+	{
+		app_regs.REG_CALIBRATION_PROFILE[channel] = profiles[channel];
 		
-	if (user_calibration) // calibration values are stored in USER_CALIBRATION registers
+		if (profiles[channel])
+			for (uint8_t i = 0; i < CALIBRATION_POINTS; i++)
+				profile_values[channel][i] = values[channel][i];
+		
+		compile_calibration(channel);
+	}
+	
+	/* The name of the last channel with a profile */
+	if (named)
+		for (uint8_t i = 0; i < CALIBRATION_PROFILE_NAME_SIZE; i++)
+			app_regs.REG_CALIBRATION_PROFILE_NAME[i] = name[i];
+	
+	return true;
+}
+
+/* Stores the USER_CALIBRATION register of the channel, for the range   */
+/* in use on channel 3, with the name in CALIBRATION_PROFILE_NAME.      */
+bool save_calibration_profile(uint8_t channel, uint8_t slot)
+{
+	uint8_t *image = profile_eeprom_image;
+	uint16_t crc;
+	
+	if (profile_eeprom_step < CALIBRATION_PROFILE_SIZE || !calibration_increasing(flow_channels[channel].user_calibration))
+		return false;
+	
+	for (uint8_t i = 0; i < CALIBRATION_PROFILE_NAME_SIZE; i++)
+		*image++ = app_regs.REG_CALIBRATION_PROFILE_NAME[i];
+	
+	for (uint8_t i = 0; i < CALIBRATION_POINTS; i++)
+	{
+		*image++ = flow_channels[channel].user_calibration[i] >> 8;
+		*image++ = flow_channels[channel].user_calibration[i] & 0xFF;
+	}
+	
+	crc = calibration_crc(profile_eeprom_image, CALIBRATION_PROFILE_SIZE - 2);
+	*image++ = crc >> 8;
+	*image = crc & 0xFF;
+	
+	profile_eeprom_address = CALIBRATION_PROFILE_ADDRESS(channel, slot);
+	profile_eeprom_step = 0;
+	return true;
+}
+
+/* Writes one byte per call, the CRC ends up last.                      */
+void save_calibration_profile_tick(void)
+{
+	if (profile_eeprom_step >= CALIBRATION_PROFILE_SIZE || eeprom_busy())
 		return;
+	
+	eeprom_wr_byte(profile_eeprom_address + profile_eeprom_step, profile_eeprom_image[profile_eeprom_step]);
+	profile_eeprom_step++;
+}
+
+
+/************************************************************************/
+/* Delivered volume                                                     */
+/************************************************************************/
+/* The control loop turns the actual flow of a channel into the volume  */
+/* it adds each ms, in 1/65536 ul, so the 1 ms tick only adds integers. */
+/* The fraction is kept next to the total so nothing is lost to         */
+/* rounding, however long the channel runs.                             */
+uint32_t volume_increment[FLOW_CHANNELS];
+uint16_t volume_fraction[FLOW_CHANNELS];
+
+static void update_volume_increment(uint8_t channel, float flow)
+{
+	uint32_t increment = 0;
+	
+	/* ml/min is 1/60 ul per ms */
+	if (flow > 0)
+		increment = flow * (65536.0 / 60);
+	
+	uint8_t sreg = SREG;
+	cli();
+	volume_increment[channel] = increment;
+	SREG = sreg;
+}
+
+void total_volume_tick(void)
+{
+	uint8_t channels = app_regs.REG_CHANNELS_ENABLE;
+	uint32_t sum;
+	
+	if (app_regs.REG_TOTAL_VOLUME_GATED)
+		channels &= ~(app_regs.REG_TOTAL_VOLUME_GATED & ~read_valves());
+	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		if (!(channels & (1 << i)))
+			continue;
 		
-	if (mfcs){
-		for (uint8_t i = 0; i < 11; i++){
-			float decade = 16383/10*i;
-			CH0_calibration_values[i] = (uint16_t)decade;
-			CH1_calibration_values[i] = (uint16_t)decade;
-			CH2_calibration_values[i] = (uint16_t)decade;
-			if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-				CH3_calibration_values[i] = (uint16_t)decade/10;
-			}
-			else{
-				CH3_calibration_values[i] = (uint16_t)decade;
-			}
-			CH4_calibration_values[i] = (uint16_t)decade;
+		sum = volume_fraction[i] + volume_increment[i];
+		app_regs.REG_CHANNELS_TOTAL_VOLUME[i] += sum >> 16;
+		volume_fraction[i] = sum & 0xFFFF;
+	}
+}
+
+/* Latched before being reset, so one command can read and restart the  */
+/* volumes of the same 1 ms period.                                     */
+void command_total_volume(uint8_t command)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		if (!(command & (1 << i)))
+			continue;
+		
+		if (command & B_TOTAL_VOLUME_LATCH)
+			app_regs.REG_CHANNELS_TOTAL_VOLUME_LATCHED[i] = app_regs.REG_CHANNELS_TOTAL_VOLUME[i];
+		
+		if (command & B_TOTAL_VOLUME_RESET)
+		{
+			app_regs.REG_CHANNELS_TOTAL_VOLUME[i] = 0;
+			volume_fraction[i] = 0;
 		}
-		return;
-	}	
-	
-	CH0_calibration_values[0] = ((CH0_calibration_values[0] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[1] = eeprom_rd_byte(++index);
-	CH0_calibration_values[1] = ((CH0_calibration_values[1] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[2] = eeprom_rd_byte(++index);
-	CH0_calibration_values[2] = ((CH0_calibration_values[2] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[3] = eeprom_rd_byte(++index);
-	CH0_calibration_values[3] = ((CH0_calibration_values[3] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[4] = eeprom_rd_byte(++index);
-	CH0_calibration_values[4] = ((CH0_calibration_values[4] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[5] = eeprom_rd_byte(++index);
-	CH0_calibration_values[5] = ((CH0_calibration_values[5] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[6] = eeprom_rd_byte(++index);
-	CH0_calibration_values[6] = ((CH0_calibration_values[6] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[7] = eeprom_rd_byte(++index);
-	CH0_calibration_values[7] = ((CH0_calibration_values[7] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[8] = eeprom_rd_byte(++index);
-	CH0_calibration_values[8] = ((CH0_calibration_values[8] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[9] = eeprom_rd_byte(++index);
-	CH0_calibration_values[9] = ((CH0_calibration_values[9] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH0_calibration_values[10] = eeprom_rd_byte(++index);
-	CH0_calibration_values[10] = ((CH0_calibration_values[10] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	
-	index = index0 + 32;
-	CH1_calibration_values[0] = eeprom_rd_byte(index);
-	CH1_calibration_values[0] = ((CH1_calibration_values[0] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[1] = eeprom_rd_byte(++index);
-	CH1_calibration_values[1] = ((CH1_calibration_values[1] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[2] = eeprom_rd_byte(++index);
-	CH1_calibration_values[2] = ((CH1_calibration_values[2] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[3] = eeprom_rd_byte(++index);
-	CH1_calibration_values[3] = ((CH1_calibration_values[3] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[4] = eeprom_rd_byte(++index);
-	CH1_calibration_values[4] = ((CH1_calibration_values[4] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[5] = eeprom_rd_byte(++index);
-	CH1_calibration_values[5] = ((CH1_calibration_values[5] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[6] = eeprom_rd_byte(++index);
-	CH1_calibration_values[6] = ((CH1_calibration_values[6] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[7] = eeprom_rd_byte(++index);
-	CH1_calibration_values[7] = ((CH1_calibration_values[7] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[8] = eeprom_rd_byte(++index);
-	CH1_calibration_values[8] = ((CH1_calibration_values[8] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[9] = eeprom_rd_byte(++index);
-	CH1_calibration_values[9] = ((CH1_calibration_values[9] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH1_calibration_values[10] = eeprom_rd_byte(++index);
-	CH1_calibration_values[10] = ((CH1_calibration_values[10] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	
-	index = index0 + 64;
-	CH2_calibration_values[0] = eeprom_rd_byte(index);
-	CH2_calibration_values[0] = ((CH2_calibration_values[0] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[1] = eeprom_rd_byte(++index);
-	CH2_calibration_values[1] = ((CH2_calibration_values[1] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[2] = eeprom_rd_byte(++index);
-	CH2_calibration_values[2] = ((CH2_calibration_values[2] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[3] = eeprom_rd_byte(++index);
-	CH2_calibration_values[3] = ((CH2_calibration_values[3] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[4] = eeprom_rd_byte(++index);
-	CH2_calibration_values[4] = ((CH2_calibration_values[4] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[5] = eeprom_rd_byte(++index);
-	CH2_calibration_values[5] = ((CH2_calibration_values[5] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[6] = eeprom_rd_byte(++index);
-	CH2_calibration_values[6] = ((CH2_calibration_values[6] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[7] = eeprom_rd_byte(++index);
-	CH2_calibration_values[7] = ((CH2_calibration_values[7] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[8] = eeprom_rd_byte(++index);
-	CH2_calibration_values[8] = ((CH2_calibration_values[8] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[9] = eeprom_rd_byte(++index);
-	CH2_calibration_values[9] = ((CH2_calibration_values[9] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH2_calibration_values[10] = eeprom_rd_byte(++index);
-	CH2_calibration_values[10] = ((CH2_calibration_values[10] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	
-	if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-		index = index0 + 96;
-		CH3_calibration_values[0] = eeprom_rd_byte(index);
-		CH3_calibration_values[0] = ((CH3_calibration_values[0] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[1] = eeprom_rd_byte(++index);
-		CH3_calibration_values[1] = ((CH3_calibration_values[1] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[2] = eeprom_rd_byte(++index);
-		CH3_calibration_values[2] = ((CH3_calibration_values[2] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[3] = eeprom_rd_byte(++index);
-		CH3_calibration_values[3] = ((CH3_calibration_values[3] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[4] = eeprom_rd_byte(++index);
-		CH3_calibration_values[4] = ((CH3_calibration_values[4] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[5] = eeprom_rd_byte(++index);
-		CH3_calibration_values[5] = ((CH3_calibration_values[5] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[6] = eeprom_rd_byte(++index);
-		CH3_calibration_values[6] = ((CH3_calibration_values[6] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[7] = eeprom_rd_byte(++index);
-		CH3_calibration_values[7] = ((CH3_calibration_values[7] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[8] = eeprom_rd_byte(++index);
-		CH3_calibration_values[8] = ((CH3_calibration_values[8] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[9] = eeprom_rd_byte(++index);
-		CH3_calibration_values[9] = ((CH3_calibration_values[9] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[10] = eeprom_rd_byte(++index);
-		CH3_calibration_values[10] = ((CH3_calibration_values[10] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	}
-	
-	index = index0 + 128;
-	CH4_calibration_values[0] = eeprom_rd_byte(index);
-	CH4_calibration_values[0] = ((CH4_calibration_values[0] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[1] = eeprom_rd_byte(++index);
-	CH4_calibration_values[1] = ((CH4_calibration_values[1] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[2] = eeprom_rd_byte(++index);
-	CH4_calibration_values[2] = ((CH4_calibration_values[2] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[3] = eeprom_rd_byte(++index);
-	CH4_calibration_values[3] = ((CH4_calibration_values[3] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[4] = eeprom_rd_byte(++index);
-	CH4_calibration_values[4] = ((CH4_calibration_values[4] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[5] = eeprom_rd_byte(++index);
-	CH4_calibration_values[5] = ((CH4_calibration_values[5] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[6] = eeprom_rd_byte(++index);
-	CH4_calibration_values[6] = ((CH4_calibration_values[6] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[7] = eeprom_rd_byte(++index);
-	CH4_calibration_values[7] = ((CH4_calibration_values[7] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[8] = eeprom_rd_byte(++index);
-	CH4_calibration_values[8] = ((CH4_calibration_values[8] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[9] = eeprom_rd_byte(++index);
-	CH4_calibration_values[9] = ((CH4_calibration_values[9] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	CH4_calibration_values[10] = eeprom_rd_byte(++index);
-	CH4_calibration_values[10] = ((CH4_calibration_values[10] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	
-	
-	if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_1000){
-		index = index0 + 160;
-		CH3_calibration_values[0] = eeprom_rd_byte(index);
-		CH3_calibration_values[0] = ((CH3_calibration_values[0] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[1] = eeprom_rd_byte(++index);
-		CH3_calibration_values[1] = ((CH3_calibration_values[1] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[2] = eeprom_rd_byte(++index);
-		CH3_calibration_values[2] = ((CH3_calibration_values[2] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[3] = eeprom_rd_byte(++index);
-		CH3_calibration_values[3] = ((CH3_calibration_values[3] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[4] = eeprom_rd_byte(++index);
-		CH3_calibration_values[4] = ((CH3_calibration_values[4] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[5] = eeprom_rd_byte(++index);
-		CH3_calibration_values[5] = ((CH3_calibration_values[5] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[6] = eeprom_rd_byte(++index);
-		CH3_calibration_values[6] = ((CH3_calibration_values[6] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[7] = eeprom_rd_byte(++index);
-		CH3_calibration_values[7] = ((CH3_calibration_values[7] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[8] = eeprom_rd_byte(++index);
-		CH3_calibration_values[8] = ((CH3_calibration_values[8] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[9] = eeprom_rd_byte(++index);
-		CH3_calibration_values[9] = ((CH3_calibration_values[9] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-		CH3_calibration_values[10] = eeprom_rd_byte(++index);
-		CH3_calibration_values[10] = ((CH3_calibration_values[10] << 8) & 0xFF00) | eeprom_rd_byte(++index);
-	}
-	
-	if (app_regs.REG_TEMP_USER_CALIBRATION == 0){
-		index = index0 + 181;
-		app_regs.REG_TEMP_USER_CALIBRATION = eeprom_rd_byte(++index); //factory temp calibration - can be override for user calibration by just setting REG_TEMP_USER_CALIBRATION and write permanently
 	}
+	SREG = sreg;
+}
+
+
+/************************************************************************/
+/* Concentration mix                                                    */
+/************************************************************************/
+/* The host gives the total flow and the fraction of it that goes       */
+/* through each odor channel, the carrier makes up the rest. The five   */
+/* setpoints are written in the same 1 ms tick, before the control loop */
+/* runs again, so a concentration step does not move the total flow.    */
+#define MIX_ODOR_CHANNELS 4
+#define MIX_CARRIER_CHANNEL 4
+
+bool mix_pending = false;
+
+static bool mix_setpoints(float total_flow, float *concentrations, float *targets)
+{
+	float odor_flow = 0;
+	
+	for (uint8_t i = 0; i < MIX_ODOR_CHANNELS; i++)
+	{
+		if (concentrations[i] < 0 || concentrations[i] > 1)
+			return false;
+		
+		targets[i] = total_flow * concentrations[i];
+		odor_flow += targets[i];
+		
+		if (targets[i] > target_flow_limit(i))
+			return false;
+	}
+	
+	/* Rounding of concentrations adding up to 1 */
+	targets[MIX_CARRIER_CHANNEL] = total_flow - odor_flow;
+	if (targets[MIX_CARRIER_CHANNEL] < 0 && targets[MIX_CARRIER_CHANNEL] > -0.01)
+		targets[MIX_CARRIER_CHANNEL] = 0;
+	
+	return targets[MIX_CARRIER_CHANNEL] >= 0 && targets[MIX_CARRIER_CHANNEL] <= target_flow_limit(MIX_CARRIER_CHANNEL);
+}
+
+/* Refused when a setpoint would not fit its channel */
+bool write_mix(float total_flow, float *concentrations)
+{
+	float targets[FLOW_CHANNELS];
+	
+	if (total_flow < 0 || !mix_setpoints(total_flow, concentrations, targets))
+		return false;
+	
+	app_regs.REG_MIX_TOTAL_FLOW = total_flow;
+	for (uint8_t i = 0; i < MIX_ODOR_CHANNELS; i++)
+		app_regs.REG_MIX_CONCENTRATIONS[i] = concentrations[i];
+	
+	mix_pending = true;
+	return true;
+}
+
+void mix_tick(void)
+{
+	float targets[FLOW_CHANNELS];
+	
+	mix_pending = false;
+	
+	if (!(app_regs.REG_MIX_ENABLE & B_MIX_ENABLE))
+		return;
+	
+	/* The channel 3 range may have changed since the mix was written */
+	if (!mix_setpoints(app_regs.REG_MIX_TOTAL_FLOW, app_regs.REG_MIX_CONCENTRATIONS, targets))
+		return;
 	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		write_target_flow(i, targets[i]);
 }
 
+
 /************************************************************************/
 /* Closed Loop Control - aux Interpolate function                       */
 /************************************************************************/
@@ -557,324 +881,901 @@ void set_flowrate_mfc(uint8_t mfc_id,float target_flow)
 }
 
 /************************************************************************/
-/* Closed Loop Control                                                  */
+/* Digital outputs driven by the firmware                               */
 /************************************************************************/
+/* DOUT0 and DOUT1 share the same configuration values, so a single     */
+/* GM_DOUT0_xxx selects every output configured with that function.     */
+#define DOUT_PULSE_DURATION 2 //2*1ms
+uint8_t dout_pulse_countdown = 0;
+
+void update_douts(uint8_t conf, uint8_t action)
+{
+	if ((app_regs.REG_DO0_SYNC & MSK_DOUT0_CONF) == conf)
+	{
+		if (action == DOUT_TOGGLE) tgl_OUT0; else if (action == DOUT_SET) set_OUT0; else clr_OUT0;
+	}
+	
+	if ((app_regs.REG_DO1_SYNC & MSK_DOUT1_CONF) == conf)
+	{
+		if (action == DOUT_TOGGLE) tgl_OUT1; else if (action == DOUT_SET) set_OUT1; else clr_OUT1;
+	}
+}
 
 
-void closed_loop_control(uint8_t flow)
+/************************************************************************/
+/* Warm start duty cycle memory                                         */
+/************************************************************************/
+/* Each channel remembers the duty cycle at which it settled for its    */
+/* last WARM_START_POINTS targets. On a flow start the duty cycle comes */
+/* from this table, interpolated between the closest targets, so the   */
+/* loop does not have to climb from the low limit again.                */
+#define WARM_START_POINTS 4
+#define WARM_START_EEPROM_ADDRESS 1960
+#define WARM_START_EEPROM_MARK 0xA5
+#define WARM_START_EEPROM_SIZE (1 + FLOW_CHANNELS * WARM_START_POINTS * 4)
+float warm_target[FLOW_CHANNELS][WARM_START_POINTS];
+float warm_duty[FLOW_CHANNELS][WARM_START_POINTS];
+uint8_t warm_next[FLOW_CHANNELS];
+uint8_t warm_eeprom_image[WARM_START_EEPROM_SIZE];
+uint8_t warm_eeprom_step = WARM_START_EEPROM_SIZE + 1;
+
+static void store_warm_start(uint8_t channel)
 {
+	float target = *flow_channels[channel].target_flow;
+	float tolerance = target * app_regs.REG_FLOW_SETTLE_TOLERANCE / 100;
+	uint8_t point = warm_next[channel];
+	bool found = false;
 	
-	uint16_t CH100_flows [] = {0, 0, 10, 20, 30, 40, 50, 60, 70, 80, 90, 100, 100};
-	uint16_t CH1000_flows [] = {0, 0, 100, 200, 300, 400, 500, 600, 700, 800, 900, 1000, 1000};
-		
-	/* Takes 350 us */
-	uint16_t calibration_values [] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32768,500};
-	uint16_t calibration_values_1000 [] = {0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32768,3000};
-	float flow_real = 0;
-	float calc_dutycycle = 0;
-	float low_limit_dc = 1.0;
-	float high_limit_dc = 99.0;
-	float error = 0;
-	float temp_correction = 0.0;
+	for (uint8_t i = 0; i < WARM_START_POINTS && !found; i++)
+	{
+		if (warm_target[channel][i] - target <= tolerance && target - warm_target[channel][i] <= tolerance)
+		{
+			point = i;
+			found = true;
+		}
+	}
 	
-	uint8_t flowmeter = flow;
-	uint8_t index = 0;
-	uint8_t user_calibration = 0;
-	user_calibration = app_regs.REG_USER_CALIBRATION_ENABLE;
+	if (!found)
+		warm_next[channel] = (point + 1) % WARM_START_POINTS;
 	
-	switch (flowmeter)
+	warm_target[channel][point] = target;
+	warm_duty[channel][point] = *flow_channels[channel].duty_cycle;
+}
+
+static float warm_start_duty(uint8_t channel, float target)
+{
+	float below_target = 0, below_duty = 0;
+	float above_target = 0, above_duty = 0;
+	
+	for (uint8_t i = 0; i < WARM_START_POINTS; i++)
 	{
-		case 0:
+		float point = warm_target[channel][i];
 		
-			if (status_DC.flow0_update && mfcs){
-				set_flowrate_mfc(0,app_regs.REG_CHANNEL0_TARGET_FLOW);
-				status_DC.flow0_update = 0;
-			}
-				
-			if(app_regs.REG_CHANNEL0_TARGET_FLOW == 0 || app_regs.REG_ENABLE_FLOW == 0)
-				break;
-				
-				
-			flow_real = app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[0]; // raw ADC analog output signal [2^16]
-			
-			// create calibration array
-			index = 0;
-			while(index < calibration_size){
-				
-				if(app_regs.REG_TEMPERATURE_VALUE != 0 && app_regs.REG_ENABLE_TEMP_CALIBRATION != 0){ // MSB temperature 
-					temp_correction = app_regs.REG_TEMPERATURE_VALUE - app_regs.REG_TEMP_USER_CALIBRATION; 
-					temp_correction = temp_correction * 5;
-				}
-				
-				if(!user_calibration){
-					calibration_values[index*2+2] = CH0_calibration_values[index]-(uint16_t)temp_correction;
-					calibration_values[index*2+3] = CH100_flows[index+1];
-				}
-				else{
-					calibration_values[index*2+2] = app_regs.REG_CHANNEL0_USER_CALIBRATION[index]-(uint16_t)temp_correction;
-					calibration_values[index*2+3] = CH100_flows[index+1];
-				}
-				index = index + 1;
-			}
-			
-			// determine real flow rate by interpolation of calibration values
-			index = 0;
-			while(!(flow_real < calibration_values[index])){
-				index = index + 2;
-			}
-			flow_real = interpolate_aux(flow_real, calibration_values[index-2], calibration_values[index], calibration_values[index-1], calibration_values[index+1]);
-			
-			app_regs.REG_CHANNEL0_ACTUAL_FLOW = flow_real;
-			if (app_regs.REG_ENABLE_EVENTS & B_EVT2){
-				core_func_send_event(ADD_REG_CHANNEL0_ACTUAL_FLOW, true);
-			}
-			
-			// P control
-			error = (app_regs.REG_CHANNEL0_TARGET_FLOW-app_regs.REG_CHANNEL0_ACTUAL_FLOW);
-			calc_dutycycle = app_regs.REG_CHANNEL0_DUTY_CYCLE + error/32; 
-			
-			if (calc_dutycycle <= 1) { app_write_REG_CHANNEL0_DUTY_CYCLE(&low_limit_dc); } else if (calc_dutycycle >= 99) {
-				app_write_REG_CHANNEL0_DUTY_CYCLE(&high_limit_dc); } else { app_write_REG_CHANNEL0_DUTY_CYCLE(&calc_dutycycle); }
-			break;
-
+		if (point == 0)
+			continue;
 		
-		case 1:
+		if (point <= target && point > below_target)
+		{
+			below_target = point;
+			below_duty = warm_duty[channel][i];
+		}
 		
-			if (status_DC.flow1_update && mfcs){
-				set_flowrate_mfc(1,app_regs.REG_CHANNEL1_TARGET_FLOW);
-				status_DC.flow1_update = 0;
-			}
-			
-			if(app_regs.REG_CHANNEL1_TARGET_FLOW == 0 || app_regs.REG_ENABLE_FLOW == 0)
-				break;
-				
-			flow_real = app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[1]; // raw analog output signal [2^16]
-			
-			// create calibration array
-			index = 0;
-			while(index < calibration_size){
-				if(app_regs.REG_TEMPERATURE_VALUE != 0 && app_regs.REG_ENABLE_TEMP_CALIBRATION != 0){ 
-					temp_correction = app_regs.REG_TEMPERATURE_VALUE - app_regs.REG_TEMP_USER_CALIBRATION; 
-					temp_correction = temp_correction * 5;
-				}
-				if(!user_calibration){
-					calibration_values[index*2+2] = CH1_calibration_values[index]-(uint16_t)temp_correction;
-					calibration_values[index*2+3] = CH100_flows[index+1];
-				}
-				else{
-					calibration_values[index*2+2] = app_regs.REG_CHANNEL1_USER_CALIBRATION[index]-(uint16_t)temp_correction;
-					calibration_values[index*2+3] = CH100_flows[index+1];
-				}
-				index = index + 1;
-			}
-			
-			// determine real flow rate by interpolation of calibration values
-			index = 0;
-			while(!(flow_real < calibration_values[index])){
-				index = index + 2;
-			}
-			flow_real = interpolate_aux(flow_real, calibration_values[index-2], calibration_values[index], calibration_values[index-1], calibration_values[index+1]);
-			
-			app_regs.REG_CHANNEL1_ACTUAL_FLOW = flow_real;
-			if (app_regs.REG_ENABLE_EVENTS & B_EVT2){
-				core_func_send_event(ADD_REG_CHANNEL1_ACTUAL_FLOW, true);
-			}
-						
-			// P control
-			error = (app_regs.REG_CHANNEL1_TARGET_FLOW-app_regs.REG_CHANNEL1_ACTUAL_FLOW);
-			calc_dutycycle = app_regs.REG_CHANNEL1_DUTY_CYCLE + error/32; 
-			
-			if (calc_dutycycle <= 1) { app_write_REG_CHANNEL1_DUTY_CYCLE(&low_limit_dc); } else if (calc_dutycycle >= 99) {
-				app_write_REG_CHANNEL1_DUTY_CYCLE(&high_limit_dc); } else { app_write_REG_CHANNEL1_DUTY_CYCLE(&calc_dutycycle); }
-			break;
+		if (point >= target && (above_target == 0 || point < above_target))
+		{
+			above_target = point;
+			above_duty = warm_duty[channel][i];
+		}
+	}
+	
+	if (below_target != 0 && above_target > below_target)
+		return below_duty + (target - below_target) * (above_duty - below_duty) / (above_target - below_target);
+	
+	/* Zero when the table is empty, the duty cycle is then left alone */
+	return (below_target != 0) ? below_duty : above_duty;
+}
+
+void warm_start_channels(void)
+{
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		float target = *flow_channels[i].target_flow;
+		float duty_cycle;
 		
+		if (!(app_regs.REG_CHANNELS_ENABLE & (1 << i)) || target <= 0)
+			continue;
 		
-		case 2:
+		duty_cycle = warm_start_duty(i, target);
 		
-			if (status_DC.flow2_update && mfcs){
-				set_flowrate_mfc(2,app_regs.REG_CHANNEL2_TARGET_FLOW);
-				status_DC.flow2_update = 0;
-			}
+		if (duty_cycle > 0)
+			write_duty_cycle(i, duty_cycle);
+	}
+}
+
+/* The table is kept in the EEPROM as 0.1 ml/min targets and 0.01 %    */
+/* duty cycles, after a mark byte that is only written once the data   */
+/* is complete.                                                         */
+void save_warm_start(void)
+{
+	uint8_t *image = warm_eeprom_image;
+	
+	*image++ = WARM_START_EEPROM_MARK;
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+	{
+		for (uint8_t i = 0; i < WARM_START_POINTS; i++)
+		{
+			uint16_t target = warm_target[channel][i] * 10 + 0.5;
+			uint16_t duty_cycle = warm_duty[channel][i] * 100 + 0.5;
 			
-			if(app_regs.REG_CHANNEL2_TARGET_FLOW == 0 || app_regs.REG_ENABLE_FLOW == 0)
-				break;
-				
-			flow_real = app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[2]; // raw ADC analog output signal [2^16]
+			*image++ = target;
+			*image++ = target >> 8;
+			*image++ = duty_cycle;
+			*image++ = duty_cycle >> 8;
+		}
+	}
+	
+	warm_eeprom_step = 0;
+}
+
+/* Writes one byte per call so a flow stop never waits for the EEPROM.  */
+/* Step 0 invalidates the mark and the last step writes it back.        */
+void save_warm_start_tick(void)
+{
+	if (warm_eeprom_step > WARM_START_EEPROM_SIZE || eeprom_busy())
+		return;
+	
+	if (warm_eeprom_step == 0)
+		eeprom_wr_byte(WARM_START_EEPROM_ADDRESS, 0xFF);
+	else
+		eeprom_wr_byte(WARM_START_EEPROM_ADDRESS + (warm_eeprom_step % WARM_START_EEPROM_SIZE), warm_eeprom_image[warm_eeprom_step % WARM_START_EEPROM_SIZE]);
+	
+	warm_eeprom_step++;
+}
+
+void load_warm_start(void)
+{
+	uint16_t address = WARM_START_EEPROM_ADDRESS;
+	
+	if (eeprom_rd_byte(address++) != WARM_START_EEPROM_MARK)
+		return;
+	
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+	{
+		for (uint8_t i = 0; i < WARM_START_POINTS; i++)
+		{
+			uint16_t target = eeprom_rd_byte(address) | (eeprom_rd_byte(address + 1) << 8);
+			uint16_t duty_cycle = eeprom_rd_byte(address + 2) | (eeprom_rd_byte(address + 3) << 8);
+			
+			warm_target[channel][i] = target / 10.0;
+			warm_duty[channel][i] = duty_cycle / 100.0;
+			address += 4;
+		}
+	}
+}
+
+void clear_warm_start(void)
+{
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+	{
+		for (uint8_t i = 0; i < WARM_START_POINTS; i++)
+		{
+			warm_target[channel][i] = 0;
+			warm_duty[channel][i] = 0;
+		}
+		warm_next[channel] = 0;
+	}
+	
+	if (app_regs.REG_WARM_START & B_WARM_START_EEPROM)
+		save_warm_start();
+}
+
+
+/************************************************************************/
+/* Flow settled detector                                                */
+/************************************************************************/
+/* A channel is settled once its flow error stays within the tolerance  */
+/* for the dwell time. The settle time is counted from the last target  */
+/* change up to the sample that entered the tolerance band.             */
+#define SETTLE_OUT_OF_BAND 0xFFFF
+float settle_target[FLOW_CHANNELS];
+uint16_t settle_elapsed[FLOW_CHANNELS];
+uint16_t settle_in_band[FLOW_CHANNELS] = {SETTLE_OUT_OF_BAND, SETTLE_OUT_OF_BAND, SETTLE_OUT_OF_BAND, SETTLE_OUT_OF_BAND, SETTLE_OUT_OF_BAND};
+
+static void set_flow_settled(uint8_t channel, bool settled)
+{
+	uint8_t mask = app_regs.REG_FLOW_SETTLED;
+	
+	if (settled) mask |= (1 << channel); else mask &= ~(1 << channel);
+	
+	if (mask == app_regs.REG_FLOW_SETTLED)
+		return;
+	
+	app_regs.REG_FLOW_SETTLED = mask;
+	
+	if (settled && (app_regs.REG_WARM_START & B_WARM_START))
+		store_warm_start(channel);
+	update_douts(GM_DOUT0_FLOW0_SETTLED + channel, settled ? DOUT_SET : DOUT_CLEAR);
+	
+	if (app_regs.REG_ENABLE_EVENTS & B_EVT6)
+	{
+		if (settled)
+			core_func_send_event(ADD_REG_FLOW_SETTLE_TIME, true);
+		core_func_send_event(ADD_REG_FLOW_SETTLED, true);
+	}
+}
+
+void restart_flow_settle(uint8_t mask)
+{
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		if (!(mask & (1 << i)))
+			continue;
 		
-			// create calibration array
-			index = 0;
-			while(index < calibration_size){
-				if(app_regs.REG_TEMPERATURE_VALUE != 0 && app_regs.REG_ENABLE_TEMP_CALIBRATION != 0){
-					temp_correction = app_regs.REG_TEMPERATURE_VALUE - app_regs.REG_TEMP_USER_CALIBRATION;
-					temp_correction = temp_correction * 5;
-				}
-				if(!user_calibration){
-					calibration_values[index*2+2] = CH2_calibration_values[index]-(uint16_t)temp_correction;
-					calibration_values[index*2+3] = CH100_flows[index+1];
-				}
-				else{
-					calibration_values[index*2+2] = app_regs.REG_CHANNEL2_USER_CALIBRATION[index]-(uint16_t)temp_correction;
-					calibration_values[index*2+3] = CH100_flows[index+1];
-				}
-				index = index + 1;
-			}
+		settle_target[i] = *flow_channels[i].target_flow;
+		settle_elapsed[i] = 0;
+		settle_in_band[i] = SETTLE_OUT_OF_BAND;
+		set_flow_settled(i, false);
+	}
+}
+
+void flow_settle_tick(void)
+{
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		if (*flow_channels[i].target_flow != settle_target[i])
+			restart_flow_settle(1 << i);
+		else if (settle_elapsed[i] < SETTLE_OUT_OF_BAND - 1)
+			settle_elapsed[i]++;
+	}
+}
+
+static void update_flow_settled(uint8_t channel)
+{
+	float target = *flow_channels[channel].target_flow;
+	float error = *flow_channels[channel].actual_flow - target;
+	float tolerance = target * app_regs.REG_FLOW_SETTLE_TOLERANCE / 100;
+	
+	if (!(app_regs.REG_ENABLE_FLOW & B_START) || !(app_regs.REG_CHANNELS_ENABLE & (1 << channel)) || target <= 0 || error > tolerance || error < -tolerance)
+	{
+		settle_in_band[channel] = SETTLE_OUT_OF_BAND;
+		set_flow_settled(channel, false);
+		return;
+	}
+	
+	if (settle_in_band[channel] == SETTLE_OUT_OF_BAND)
+		settle_in_band[channel] = settle_elapsed[channel];
+	
+	if (settle_elapsed[channel] - settle_in_band[channel] >= app_regs.REG_FLOW_SETTLE_DWELL && !(app_regs.REG_FLOW_SETTLED & (1 << channel)))
+	{
+		app_regs.REG_FLOW_SETTLE_TIME[channel] = settle_in_band[channel];
+		set_flow_settled(channel, true);
+	}
+}
+
+
+/************************************************************************/
+/* Compile the calibration in use                                       */
+/************************************************************************/
+static void index_calibration_lut(calibration_lut_t *lut)
+{
+	uint8_t index = 1;
+	
+	for (uint8_t bucket = 0; bucket < CALIBRATION_LUT_BUCKETS; bucket++)
+	{
+		while (index < lut->points - 1 && lut->code[index] <= ((uint16_t)bucket << 10))
+			index++;
+		lut->bucket[bucket] = index;
+	}
+}
+
+/* The lookup is indexed in table order, so the codes of a calibration  */
+/* written by the user must increase with the flow points.              */
+bool calibration_increasing(uint16_t *calibration)
+{
+	for (uint8_t i = 1; i < CALIBRATION_POINTS; i++)
+		if (calibration[i] <= calibration[i - 1])
+			return false;
+	
+	return true;
+}
+
+/* An uploaded curve comes first, then a selected profile, then the     */
+/* USER_CALIBRATION register when enabled, and the factory calibration  */
+/* otherwise. Needs to run again when any of them changes, the loop     */
+/* only reads the lookup.                                               */
+uint8_t calibration_curves = 0; // channels running from an uploaded curve
+
+static void compile_calibration_lut(calibration_lut_t *lut, uint16_t *calibration, uint16_t full_scale, uint16_t overflow_flow)
+{
+	lut->code[0] = 0;
+	lut->flow[0] = 0;
+	for (uint8_t i = 0; i < CALIBRATION_POINTS; i++)
+	{
+		lut->code[i + 1] = calibration[i];
+		lut->flow[i + 1] = i * full_scale / 10;
+	}
+	lut->points = CALIBRATION_POINTS + 2;
+	lut->code[lut->points - 1] = 32768;
+	lut->flow[lut->points - 1] = overflow_flow;
+	
+	index_calibration_lut(lut);
+}
+
+void compile_calibration(uint8_t channel)
+{
+	flow_channel_t *flow = &flow_channels[channel];
+	const flow_range_t *range;
+	uint16_t *calibration = flow->calibration;
+	uint16_t *user_calibration = flow->user_calibration;
+	uint16_t full_scale = flow->full_scale;
+	uint16_t overflow_flow = flow->overflow_flow;
+	
+	/* In auto range the lookup of channel 3 is the 100 ml/min one, the  */
+	/* 1000 ml/min one is compiled next to it from its own calibration.  */
+	if (channel == 3 && channel3_auto_range())
+	{
+		range = &channel3_ranges[GM_FLOW_1000];
+		compile_calibration_lut(&calibration_luts[CH3_AUTO_RANGE_LUT],
+			app_regs.REG_USER_CALIBRATION_ENABLE ? range->user_calibration : range->calibration,
+			range->full_scale, range->overflow_flow);
 		
-			// determine real flow rate by interpolation of calibration values
-			index = 0;
-			while(!(flow_real < calibration_values[index])){
-				index = index + 2;
-			}
-			flow_real = interpolate_aux(flow_real, calibration_values[index-2], calibration_values[index], calibration_values[index-1], calibration_values[index+1]);
-				
-			app_regs.REG_CHANNEL2_ACTUAL_FLOW = flow_real;
-			if (app_regs.REG_ENABLE_EVENTS & B_EVT2){
-				core_func_send_event(ADD_REG_CHANNEL2_ACTUAL_FLOW, true);
-			}
+		range = &channel3_ranges[GM_FLOW_100];
+		calibration = range->calibration;
+		user_calibration = range->user_calibration;
+		full_scale = range->full_scale;
+		overflow_flow = range->overflow_flow;
+	}
+	
+	if (calibration_curves & (1 << channel))
+		return;
+	
+	if (app_regs.REG_CALIBRATION_PROFILE[channel])
+		calibration = profile_values[channel];
+	else if (app_regs.REG_USER_CALIBRATION_ENABLE)
+		calibration = user_calibration;
+	
+	compile_calibration_lut(&calibration_luts[channel], calibration, full_scale, overflow_flow);
+}
+
+/* Monotone cubic (Fritsch-Carlson) between the curve points, so the    */
+/* flow never decreases with the code and does not overshoot.           */
+static float monotone_spline(uint16_t *code, float *flow, float *tangent, uint8_t points, float x)
+{
+	uint8_t k = 0;
+	
+	while (k < points - 2 && x > code[k + 1])
+		k++;
+	
+	float h = code[k + 1] - code[k];
+	float t = (x - code[k]) / h;
+	float t2 = t * t;
+	float t3 = t2 * t;
+	
+	return (2 * t3 - 3 * t2 + 1) * flow[k] + (t3 - 2 * t2 + t) * h * tangent[k] +
+		(-2 * t3 + 3 * t2) * flow[k + 1] + (t3 - t2) * h * tangent[k + 1];
+}
+
+/* The curve is the CALIBRATION_CURVE register: channel and options,    */
+/* number of points, then pairs of ADC code and flow in 0.1 ml/min.     */
+/* Codes must increase and flows must not decrease. Zero points gives   */
+/* the channel back to the other calibrations.                          */
+/* Each channel keeps its own curve, compiled into its lookup, so they  */
+/* are uploaded one channel after the other. The register holds the     */
+/* curve written last, the only one saved with the other registers.     */
+bool compile_calibration_curve(uint16_t *curve)
+{
+	uint8_t channel = curve[0] & MSK_CURVE_CHANNEL;
+	uint8_t points = curve[1];
+	uint16_t *pair = &curve[2];
+	uint16_t code[CALIBRATION_CURVE_POINTS];
+	float flow[CALIBRATION_CURVE_POINTS];
+	float tangent[CALIBRATION_CURVE_POINTS];
+	calibration_lut_t *lut;
+	
+	if (channel >= FLOW_CHANNELS || (curve[0] & ~(MSK_CURVE_CHANNEL | B_CURVE_SPLINE)) || points == 1 || points > CALIBRATION_CURVE_POINTS)
+		return false;
+	
+	if (points == 0)
+	{
+		calibration_curves &= ~(1 << channel);
+		compile_calibration(channel);
+		return true;
+	}
+	
+	for (uint8_t i = 0; i < points; i++, pair += 2)
+	{
+		code[i] = pair[0];
+		flow[i] = pair[1] / 10.0;
 		
-			// P control
-			error = (app_regs.REG_CHANNEL2_TARGET_FLOW-app_regs.REG_CHANNEL2_ACTUAL_FLOW);
-			calc_dutycycle = app_regs.REG_CHANNEL2_DUTY_CYCLE + error/32; 
-						
-			if (calc_dutycycle <= 1) { app_write_REG_CHANNEL2_DUTY_CYCLE(&low_limit_dc); } else if (calc_dutycycle >= 99) {
-				app_write_REG_CHANNEL2_DUTY_CYCLE(&high_limit_dc); } else { app_write_REG_CHANNEL2_DUTY_CYCLE(&calc_dutycycle); }
-			break;
+		if (code[i] >= 32768 || (i > 0 && (code[i] <= code[i - 1] || flow[i] < flow[i - 1])))
+			return false;
+	}
+	
+	lut = &calibration_luts[channel];
+	lut->points = points + 2;
+	lut->code[0] = 0;
+	lut->flow[0] = flow[0];
+	
+	if (!(curve[0] & B_CURVE_SPLINE))
+	{
+		for (uint8_t i = 0; i < points; i++)
+		{
+			lut->code[i + 1] = code[i];
+			lut->flow[i + 1] = flow[i];
+		}
+	}
+	else
+	{
+		/* Tangents from the secants, limited to keep the curve monotone */
+		for (uint8_t i = 0; i < points; i++)
+		{
+			float before = (i > 0) ? (flow[i] - flow[i - 1]) / (code[i] - code[i - 1]) : 0;
+			float after = (i < points - 1) ? (flow[i + 1] - flow[i]) / (code[i + 1] - code[i]) : 0;
+			
+			if (i == 0)
+				tangent[i] = after;
+			else if (i == points - 1)
+				tangent[i] = before;
+			else if (before == 0 || after == 0)
+				tangent[i] = 0;
+			else
+				tangent[i] = 2 / (1 / before + 1 / after); // harmonic mean, never more than 2x the smallest
+		}
 		
-				
-		case 3:
+		/* Sampled at codes evenly spread over the curve, no more than it */
+		/* spans so no two samples share a code.                          */
+		uint16_t span = code[points - 1] - code[0];
+		uint8_t samples = (span < CALIBRATION_CURVE_POINTS - 1) ? span + 1 : CALIBRATION_CURVE_POINTS;
 		
-			if (status_DC.flow3_update && mfcs){
-				set_flowrate_mfc(3,app_regs.REG_CHANNEL3_TARGET_FLOW);
-				status_DC.flow3_update = 0;
-			}
-
-			if(app_regs.REG_CHANNEL3_TARGET_FLOW == 0 || app_regs.REG_ENABLE_FLOW == 0)
-				break;
-				
-			flow_real = app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[3]; // raw ADC analog output signal [2^16]
+		lut->points = samples + 2;
+		for (uint8_t i = 0; i < samples; i++)
+		{
+			uint16_t x = code[0] + (uint32_t)span * i / (samples - 1);
 			
-			
-			// create calibration array
-			index = 0;
-			while(index < calibration_size){
-				if(app_regs.REG_TEMPERATURE_VALUE != 0 && app_regs.REG_ENABLE_TEMP_CALIBRATION != 0){
-					temp_correction = app_regs.REG_TEMPERATURE_VALUE - app_regs.REG_TEMP_USER_CALIBRATION;
-				}
-				if(!user_calibration){
-					if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-						temp_correction = temp_correction * 2.5;
-						calibration_values[index*2+2] = CH3_calibration_values[index]-((uint16_t)temp_correction);
-						calibration_values[index*2+3] = CH100_flows[index+1];
-					}
-					else{
-						temp_correction = temp_correction * 5;
-						calibration_values_1000[index*2+2] = CH3_calibration_values[index]-(uint16_t)temp_correction;
-						calibration_values_1000[index*2+3] = CH1000_flows[index+1];
-					}
-				}
-				else{
-					if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-						temp_correction = temp_correction * 2.5;
-						calibration_values[index*2+2] = app_regs.REG_CHANNEL3_USER_CALIBRATION[index]-((uint16_t)temp_correction);
-						calibration_values[index*2+3] = CH100_flows[index+1];
-					}
-					else{
-						temp_correction = temp_correction * 5;
-						calibration_values_1000[index*2+2] = app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[index]-(uint16_t)temp_correction;
-						calibration_values_1000[index*2+3] = CH1000_flows[index+1];
-					}
-				}
-				index = index + 1;
-			}
+			lut->code[i + 1] = x;
+			lut->flow[i + 1] = monotone_spline(code, flow, tangent, points, x);
+		}
+	}
+	
+	/* Above the last point the last segment is extended */
+	uint8_t last = lut->points - 2;
+	lut->code[last + 1] = 32768;
+	lut->flow[last + 1] = lut->flow[last] + (lut->flow[last] - lut->flow[last - 1]) * (32768.0 - lut->code[last]) / (lut->code[last] - lut->code[last - 1]);
+	
+	index_calibration_lut(lut);
+	calibration_curves |= (1 << channel);
+	return true;
+}
+
+/* The temperature correction moves every calibration point by the same */
+/* number of codes, so it is applied to the code looked up instead.     */
+static float lookup_calibration(calibration_lut_t *lut, int32_t code)
+{
+	uint8_t index;
+	
+	if (code < 0)
+		code = 0;
+	if (code > 32767)
+		code = 32767;
+	
+	index = lut->bucket[code >> 10];
+	while (!(code < lut->code[index]))
+		index++;
+	
+	return interpolate_aux(code, lut->code[index - 1], lut->code[index], lut->flow[index - 1], lut->flow[index]);
+}
+
+
+/************************************************************************/
+/* Closed Loop Control                                                  */
+/************************************************************************/
+
+
+void closed_loop_control(uint8_t flow)
+{
+	flow_channel_t *channel = &flow_channels[flow];
+	
+	float flow_real = 0;
+	float calc_dutycycle = 0;
+	float low_limit_dc = 1.0;
+	float high_limit_dc = 99.0;
+	float error = 0;
+	float temp_correction = 0.0;
+	uint16_t raw;
+	uint32_t sampled;
+	uint8_t sreg;
+	
+	if (status_DC.flow_update[flow] && mfcs){
+		set_flowrate_mfc(channel->mfc, *channel->target_flow);
+		status_DC.flow_update[flow] = 0;
+	}
 		
-			// determine real flow rate by interpolation of calibration values
-			index = 0;
-			while(!(flow_real < calibration_values[index])){
-				index = index + 2;
-			}
-			
-			if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-				// determine real flow rate by interpolation of calibration values
-				index = 0;
-				while(!(flow_real < calibration_values[index])){
-					index = index + 2;
-				}
-				flow_real = interpolate_aux(flow_real, calibration_values[index-2], calibration_values[index], calibration_values[index-1], calibration_values[index+1]);
-			}
-			else {
-				// determine real flow rate by interpolation of calibration values
-				index = 0;
-				while(!(flow_real < calibration_values_1000[index])){
-					index = index + 2;
-				}
-				flow_real = interpolate_aux(flow_real, calibration_values_1000[index-2], calibration_values_1000[index], calibration_values_1000[index-1], calibration_values_1000[index+1]);
-			
-			}
-			
-			app_regs.REG_CHANNEL3_ACTUAL_FLOW = flow_real;
-			if (app_regs.REG_ENABLE_EVENTS & B_EVT2){
-				core_func_send_event(ADD_REG_CHANNEL3_ACTUAL_FLOW, true);
-			}
+	if(*channel->target_flow == 0 || app_regs.REG_ENABLE_FLOW == 0){
+		update_volume_increment(flow, 0);
+		return;
+	}
 		
-			// P control
-			error = (app_regs.REG_CHANNEL3_TARGET_FLOW-app_regs.REG_CHANNEL3_ACTUAL_FLOW);
-			calc_dutycycle = app_regs.REG_CHANNEL3_DUTY_CYCLE + error/256; 
-						
-			if (calc_dutycycle <= 1) { app_write_REG_CHANNEL3_DUTY_CYCLE(&low_limit_dc); } else if (calc_dutycycle >= 99) {
-				app_write_REG_CHANNEL3_DUTY_CYCLE(&high_limit_dc); } else { app_write_REG_CHANNEL3_DUTY_CYCLE(&calc_dutycycle); }
-			break;
+	/* The range is picked before its temperature gain and lookup are used */
+	if (flow == 3 && channel3_auto_range())
+		auto_range_channel3();
 		
+	if(app_regs.REG_TEMPERATURE_VALUE != 0 && app_regs.REG_ENABLE_TEMP_CALIBRATION != 0){ // MSB temperature 
+		temp_correction = app_regs.REG_TEMPERATURE_VALUE - app_regs.REG_TEMP_USER_CALIBRATION; 
+		temp_correction = temp_correction * channel->temperature_gain;
+	}
+	
+	/* The code and the start of its conversion, from the same frame */
+	sreg = SREG;
+	cli();
+	raw = app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[flow];
+	sampled = adc_frame_cycles;
+	SREG = sreg;
+	
+	// determine real flow rate from the compiled calibration, raw ADC analog output signal [2^16]
+	flow_real = lookup_calibration(channel->lut, (int32_t)raw + (int16_t)temp_correction);
+	
+	*channel->actual_flow = flow_real;
+	update_volume_increment(flow, flow_real);
+	if ((app_regs.REG_ENABLE_EVENTS & B_EVT2) && (app_regs.REG_CHANNELS_ENABLE_EVENTS & (1 << flow))){
+		core_func_send_event(channel->add_actual_flow, true);
+	}
+	
+	// P control
+	error = (*channel->target_flow - *channel->actual_flow);
+	calc_dutycycle = *channel->duty_cycle + error/channel->gain_divider; 
+	
+	if (calc_dutycycle <= 1) { write_duty_cycle(flow, low_limit_dc); } else if (calc_dutycycle >= 99) {
+		write_duty_cycle(flow, high_limit_dc); } else { write_duty_cycle(flow, calc_dutycycle); }
+	
+	loop_latency_record(flow, sampled);
+}
+
+
+/************************************************************************/
+/* Calibration sweep                                                    */
+/************************************************************************/
+/* The channel leaves the closed loop and its duty cycle is stepped     */
+/* from the first to the last value of CALIBRATION_SWEEP_CONFIG. At     */
+/* each step the flowmeter code is averaged once the settle time has    */
+/* passed, and the points are sent in batches on CALIBRATION_SWEEP_DATA.*/
+/* The last batch stays in the register until the next point, so a host */
+/* polling it sees every point. The host pairs them with its reference  */
+/* flows to fit the curve.                                              */
+#define SWEEP_BATCH_POINTS 8
+
+uint16_t sweep_config_default[5] = {10, 900, 32, 500, 100};
+uint8_t sweep_channel;
+uint8_t sweep_step;
+uint16_t sweep_wait;       // ADC samples before the average starts
+uint16_t sweep_samples;    // ADC samples averaged
+uint32_t sweep_sum;
+float sweep_restore_duty;  // duty cycle given back to the closed loop
+
+static uint16_t sweep_duty(uint8_t step)
+{
+	uint16_t *config = app_regs.REG_CALIBRATION_SWEEP_CONFIG;
+	
+	return config[0] + (uint32_t)(config[1] - config[0]) * step / (config[2] - 1);
+}
+
+static void set_sweep_step(uint8_t step)
+{
+	sweep_step = step;
+	sweep_wait = app_regs.REG_CALIBRATION_SWEEP_CONFIG[3] / ADC_SAMPLING_DIVIDER;
+	sweep_samples = 0;
+	sweep_sum = 0;
+	write_duty_cycle(sweep_channel, sweep_duty(step) / 10.0);
+}
+
+static void send_sweep_data(void)
+{
+	if (app_regs.REG_ENABLE_EVENTS & B_EVT7)
+		core_func_send_event(ADD_REG_CALIBRATION_SWEEP_DATA, true);
+}
+
+bool start_calibration_sweep(uint8_t channel)
+{
+	/* Needs a proportional valve running, and one sweep at a time */
+	if (channel >= FLOW_CHANNELS || mfcs || (app_regs.REG_CALIBRATION_SWEEP & B_SWEEP_RUN))
+		return false;
+	if (!(app_regs.REG_ENABLE_FLOW & B_START) || !(app_regs.REG_CHANNELS_ENABLE & (1 << channel)))
+		return false;
+	
+	sweep_channel = channel;
+	sweep_restore_duty = *flow_channels[channel].duty_cycle;
+	update_volume_increment(channel, 0); // not counted while out of the closed loop
+	app_regs.REG_CALIBRATION_SWEEP = B_SWEEP_RUN | channel;
+	app_regs.REG_CALIBRATION_SWEEP_DATA[0] = 0;
+	app_regs.REG_CALIBRATION_SWEEP_DATA[1] = 0;
+	set_sweep_step(0);
+	return true;
+}
+
+void stop_calibration_sweep(void)
+{
+	if (!(app_regs.REG_CALIBRATION_SWEEP & B_SWEEP_RUN))
+		return;
+	
+	app_regs.REG_CALIBRATION_SWEEP &= ~B_SWEEP_RUN;
+	write_duty_cycle(sweep_channel, sweep_restore_duty);
+	restart_flow_settle(1 << sweep_channel);
+	
+	if (app_regs.REG_ENABLE_EVENTS & B_EVT7)
+		core_func_send_event(ADD_REG_CALIBRATION_SWEEP, true);
+}
+
+/* Called on each ADC sample */
+void calibration_sweep_tick(void)
+{
+	uint16_t *point;
+	
+	/* The channel stopped under the sweep, its codes are meaningless */
+	if (!(app_regs.REG_CHANNELS_ENABLE & (1 << sweep_channel)))
+	{
+		stop_calibration_sweep();
+		return;
+	}
+	
+	if (sweep_wait)
+	{
+		sweep_wait--;
+		return;
+	}
+	
+	sweep_sum += app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[sweep_channel];
+	if (++sweep_samples < app_regs.REG_CALIBRATION_SWEEP_CONFIG[4] / ADC_SAMPLING_DIVIDER)
+		return;
+	
+	/* A sent batch is kept until the next point, so it can still be read */
+	if (app_regs.REG_CALIBRATION_SWEEP_DATA[1] == SWEEP_BATCH_POINTS)
+	{
+		app_regs.REG_CALIBRATION_SWEEP_DATA[1] = 0;
+		app_regs.REG_CALIBRATION_SWEEP_DATA[0] = sweep_step;
+	}
+	
+	point = &app_regs.REG_CALIBRATION_SWEEP_DATA[2 + app_regs.REG_CALIBRATION_SWEEP_DATA[1] * 2];
+	point[0] = sweep_duty(sweep_step);
+	point[1] = (sweep_sum + sweep_samples / 2) / sweep_samples;
+	
+	if (++app_regs.REG_CALIBRATION_SWEEP_DATA[1] == SWEEP_BATCH_POINTS || sweep_step + 1 == app_regs.REG_CALIBRATION_SWEEP_CONFIG[2])
+		send_sweep_data();
+	
+	if (sweep_step + 1 == app_regs.REG_CALIBRATION_SWEEP_CONFIG[2])
+		stop_calibration_sweep();
+	else
+		set_sweep_step(sweep_step + 1);
+}
+
+
+/************************************************************************/
+/* Valves pulse trains                                                  */
+/************************************************************************/
+/* Each train runs on the 500us tick: the start delay, then the on and  */
+/* off phases until the number of pulses is reached. The odor, end and  */
+/* dummy valves have one train each, indexed by their valve bit.        */
+trains_t trains;
+
+static uint16_t * const train_regs[TRAIN_VALVES] = {
+	app_regs.REG_VALVE0_TRAIN,
+	app_regs.REG_VALVE1_TRAIN,
+	app_regs.REG_VALVE2_TRAIN,
+	app_regs.REG_VALVE3_TRAIN,
+	app_regs.REG_END_VALVE0_TRAIN,
+	app_regs.REG_END_VALVE1_TRAIN,
+	app_regs.REG_DUMMY_VALVE_TRAIN
+};
+
+void start_valves_train(uint16_t mask)
+{
+	uint8_t sreg = SREG;
+	uint16_t was_on;
+	
+	cli();
+	for (uint8_t i = 0; i < TRAIN_VALVES; i++)
+	{
+		if (mask & (1<<i))
+		{
+			trains.countdown[i] = train_regs[i][TRAIN_DELAY] + 1;
+			trains.remaining[i] = train_regs[i][TRAIN_PULSES];
+		}
+	}
+	was_on = trains.on & mask;
+	trains.on &= ~mask;
+	trains.active |= mask;
+	SREG = sreg;
+	
+	/* A restarted train begins with its valve closed */
+	if (was_on)
+	{
+		write_valves(0, was_on);
+		arm_valves_countdown(0, was_on);
+	}
+}
+
+void stop_valves_train(uint16_t mask)
+{
+	uint8_t sreg = SREG;
+	uint16_t was_on;
+	
+	cli();
+	was_on = trains.on & mask;
+	trains.on &= ~mask;
+	trains.active &= ~mask;
+	SREG = sreg;
+	
+	if (was_on)
+	{
+		write_valves(0, was_on);
+		arm_valves_countdown(0, was_on);
+	}
+}
+
+uint8_t valves_train_tick(uint16_t *set_mask, uint16_t *clear_mask)
+{
+	uint8_t done = 0;
+	
+	for (uint8_t i = 0; i < TRAIN_VALVES; i++)
+	{
+		uint8_t bit = 1<<i;
+		
+		if (!(trains.active & bit) || --trains.countdown[i])
+			continue;
+		
+		if (!(trains.on & bit))
+		{
+			*set_mask |= bit;
+			trains.on |= bit;
+			trains.countdown[i] = train_regs[i][TRAIN_ON];
+		}
+		else
+		{
+			*clear_mask |= bit;
+			trains.on &= ~bit;
 			
-		case 4: // flow meter 1000ml/min 
-			
-			if (status_DC.flow4_update && mfcs){
-				set_flowrate_mfc(4,app_regs.REG_CHANNEL4_TARGET_FLOW);
-				status_DC.flow4_update = 0;
+			if (trains.remaining[i] && --trains.remaining[i] == 0)
+			{
+				trains.active &= ~bit;
+				done |= bit;
 			}
-			
-			if(app_regs.REG_CHANNEL4_TARGET_FLOW == 0 || app_regs.REG_ENABLE_FLOW == 0)
-				break;
-				
-			flow_real = app_regs.REG_FLOWMETER_ANALOG_OUTPUTS[4]; // raw analog output signal [2^16]
-			
-			// create calibration array
-			index = 0;
-			while(index < calibration_size){
-				if(app_regs.REG_TEMPERATURE_VALUE != 0 && app_regs.REG_ENABLE_TEMP_CALIBRATION != 0){
-					temp_correction = app_regs.REG_TEMPERATURE_VALUE - app_regs.REG_TEMP_USER_CALIBRATION;
-					temp_correction = temp_correction * 5;
-				}
-				if(!user_calibration){
-					calibration_values_1000[index*2+2] = CH4_calibration_values[index]-(uint16_t)temp_correction;
-					calibration_values_1000[index*2+3] = CH1000_flows[index+1];
-				}
-				else{
-					calibration_values_1000[index*2+2] = app_regs.REG_CHANNEL4_USER_CALIBRATION[index]-(uint16_t)temp_correction;
-					calibration_values_1000[index*2+3] = CH1000_flows[index+1];
-				}
-				index = index + 1;
+			else
+			{
+				trains.countdown[i] = train_regs[i][TRAIN_OFF];
 			}
-			
-			// determine real flow rate by interpolation of calibration values
-			index = 0;
-			while(!(flow_real < calibration_values_1000[index])){
-				index = index + 2;
+		}
+	}
+	
+	return done;
+}
+
+
+/************************************************************************/
+/* Odor delivery sequence                                               */
+/************************************************************************/
+/* The steps are applied on the 500us tick once their time, counted     */
+/* from the start, is reached. Steps at time 0 are applied right away   */
+/* by start_sequence(), so a DI0 start has no tick latency. A step      */
+/* with a settle mask holds the sequence until those channels settle.   */
+/* The sequence is aborted if they cannot settle or take longer than    */
+/* REG_SEQUENCE_SETTLE_TIMEOUT. A step keeps the target of a channel    */
+/* until a flow is written for it.                                      */
+#define SEQUENCE_STEP_DEFAULT {.flows = {-1, -1, -1, -1, -1}}
+sequence_step_t sequence_steps[SEQUENCE_MAX_STEPS] = {[0 ... SEQUENCE_MAX_STEPS - 1] = SEQUENCE_STEP_DEFAULT};
+uint16_t sequence_elapsed;
+uint16_t sequence_wait;       // time the due step has waited for its channels
+uint8_t sequence_next;
+volatile bool sequence_busy;
+
+/* Channels that will not settle as things are, see update_flow_settled() */
+static uint8_t unsettleable_channels(void)
+{
+	uint8_t mask = ~app_regs.REG_CHANNELS_ENABLE & MSK_FLOW_CHANNELS;
+	
+	if (!(app_regs.REG_ENABLE_FLOW & B_START))
+		return MSK_FLOW_CHANNELS;
+	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		if (*flow_channels[i].target_flow <= 0)
+			mask |= (1 << i);
+	
+	if (app_regs.REG_CALIBRATION_SWEEP & B_SWEEP_RUN)
+		mask |= (1 << sweep_channel);
+	
+	return mask;
+}
+
+static void end_sequence(uint8_t state)
+{
+	app_regs.REG_SEQUENCE_CONTROL = state;
+	
+	if (app_regs.REG_ENABLE_EVENTS & B_EVT5)
+		core_func_send_event(ADD_REG_SEQUENCE_CONTROL, true);
+}
+
+static bool sequence_step_due(void)
+{
+	return sequence_next < app_regs.REG_SEQUENCE_LENGTH && sequence_steps[sequence_next].time <= sequence_elapsed;
+}
+
+static void run_sequence(void)
+{
+	/* A tick that comes while start_sequence() applies steps leaves them to it */
+	if (sequence_busy)
+		return;
+	sequence_busy = true;
+	
+	while (sequence_step_due())
+	{
+		sequence_step_t *step = &sequence_steps[sequence_next];
+		uint8_t new_targets = 0;
+		
+		if (step->settle & ~app_regs.REG_FLOW_SETTLED)
+		{
+			if ((step->settle & unsettleable_channels()) || sequence_wait >= app_regs.REG_SEQUENCE_SETTLE_TIMEOUT)
+			{
+				end_sequence(GM_SEQUENCE_SETTLE_FAILED);
+				sequence_busy = false;
+				return;
 			}
-			flow_real = interpolate_aux(flow_real, calibration_values_1000[index-2], calibration_values_1000[index], calibration_values_1000[index-1], calibration_values_1000[index+1]);
-				
-			app_regs.REG_CHANNEL4_ACTUAL_FLOW = flow_real;
-			if (app_regs.REG_ENABLE_EVENTS & B_EVT2){
-				core_func_send_event(ADD_REG_CHANNEL4_ACTUAL_FLOW, true);
+			break;
+		}
+		
+		sequence_next++;
+		sequence_wait = 0;
+		
+		app_write_REG_VALVES_STATE(&step->valves);
+		app_write_REG_OUTPUT_STATE(&step->outputs);
+		
+		for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+			if (step->flows[i] >= 0)
+			{
+				write_target_flow(i, step->flows[i]);
+				new_targets |= (1 << i);
 			}
 		
-			// P control
-			error = (app_regs.REG_CHANNEL4_TARGET_FLOW-app_regs.REG_CHANNEL4_ACTUAL_FLOW);
-			calc_dutycycle = app_regs.REG_CHANNEL4_DUTY_CYCLE + error/256; 
-	
-			if (calc_dutycycle <= 1) { app_write_REG_CHANNEL4_DUTY_CYCLE(&low_limit_dc); } else if (calc_dutycycle >= 99) {
-				app_write_REG_CHANNEL4_DUTY_CYCLE(&high_limit_dc); } else { app_write_REG_CHANNEL4_DUTY_CYCLE(&calc_dutycycle); }
-			break;
+		/* A following step gated on these channels must wait for the new targets */
+		if (new_targets)
+			restart_flow_settle(new_targets);
 	}
 	
+	if (sequence_next >= app_regs.REG_SEQUENCE_LENGTH)
+		end_sequence(GM_SEQUENCE_IDLE);
+	
+	sequence_busy = false;
+}
+
+void start_sequence(void)
+{
+	uint8_t sreg = SREG;
+	
+	update_douts(GM_DOUT0_SEQUENCE_PULSE, DOUT_SET);
+	dout_pulse_countdown = DOUT_PULSE_DURATION;
+	
+	cli();
+	sequence_elapsed = 0;
+	sequence_wait = 0;
+	sequence_next = 0;
+	app_regs.REG_SEQUENCE_CONTROL = GM_SEQUENCE_RUNNING;
+	SREG = sreg;
+	
+	if (app_regs.REG_ENABLE_EVENTS & B_EVT5)
+		core_func_send_event(ADD_REG_SEQUENCE_CONTROL, true);
+	
+	run_sequence();
+}
+
+void stop_sequence(void)
+{
+	app_regs.REG_SEQUENCE_CONTROL = GM_SEQUENCE_IDLE;
+}
+
+void sequence_tick(void)
+{
+	/* Time is held while a due step waits for its channels to settle */
+	if (!sequence_step_due())
+		sequence_elapsed++;
+	else if (sequence_wait < 0xFFFF)
+		sequence_wait++;
+	
+	run_sequence();
 }
 
 
@@ -895,6 +1796,7 @@ void core_callback_initialize_hardware(void){
 	uart1_enable();
 	
 	init_calibration_values();
+	load_warm_start();
 	/* Initialize SPI with 4MHz */
 	SPIE_CTRL = SPI_MASTER_bm | SPI_ENABLE_bm | SPI_MODE_0_gc | SPI_CLK2X_bm | SPI_PRESCALER_DIV16_gc;
 	
@@ -988,9 +1890,81 @@ void core_callback_reset_registers(void)
 	
 	app_regs.REG_ENABLE_EVENTS = B_EVT0 | B_EVT1 | B_EVT2;
 	
+	app_regs.REG_VALVES_EVENT[0] = 0;
+	app_regs.REG_VALVES_EVENT[1] = 0;
+	
+	for (uint8_t i = 0; i < TRAIN_VALVES; i++)
+	{
+		train_regs[i][TRAIN_DELAY] = 0;
+		train_regs[i][TRAIN_ON] = 50;
+		train_regs[i][TRAIN_OFF] = 450;
+		train_regs[i][TRAIN_PULSES] = 10;
+	}
+	trains.active = 0;
+	trains.on = 0;
+	
+	app_regs.REG_SEQUENCE_CONTROL = GM_SEQUENCE_IDLE;
+	app_regs.REG_SEQUENCE_LENGTH = 0;
+	app_regs.REG_SEQUENCE_STEP_INDEX = 0;
+	app_regs.REG_SEQUENCE_SETTLE_TIMEOUT = 10000;
+	for (uint8_t i = 0; i < SEQUENCE_MAX_STEPS; i++)
+		sequence_steps[i] = (sequence_step_t)SEQUENCE_STEP_DEFAULT;
+	
+	app_regs.REG_DI0_DEBOUNCE = 0;
+	
+	app_regs.REG_CHANNELS_ENABLE = MSK_FLOW_CHANNELS;
+	app_regs.REG_CHANNELS_ENABLE_EVENTS = MSK_FLOW_CHANNELS;
+	app_regs.REG_WARM_START = 0;
+	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		app_regs.REG_CALIBRATION_PROFILE[i] = 0;
+	for (uint8_t i = 0; i < CALIBRATION_PROFILE_NAME_SIZE; i++)
+		app_regs.REG_CALIBRATION_PROFILE_NAME[i] = 0;
+	app_regs.REG_CALIBRATION_PROFILE_SAVE = 0;
+	for (uint8_t i = 0; i < CALIBRATION_CURVE_SIZE; i++)
+		app_regs.REG_CALIBRATION_CURVE[i] = 0;
+	calibration_curves = 0;
+	
+	stop_calibration_sweep();
+	app_regs.REG_CALIBRATION_SWEEP = 0;
+	app_write_REG_CALIBRATION_SWEEP_CONFIG(sweep_config_default);
+	for (uint8_t i = 0; i < 18; i++)
+		app_regs.REG_CALIBRATION_SWEEP_DATA[i] = 0;
+	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		app_regs.REG_CHANNELS_TOTAL_VOLUME[i] = 0;
+		app_regs.REG_CHANNELS_TOTAL_VOLUME_LATCHED[i] = 0;
+	}
+	app_regs.REG_TOTAL_VOLUME_COMMAND = 0;
+	app_regs.REG_TOTAL_VOLUME_GATED = 0;
+	
+	app_regs.REG_PROFILER_CONTROL = 0;
+	app_regs.REG_PROFILER_SITE = 0;
+	for (uint8_t i = 0; i < 4; i++)
+		app_regs.REG_CPU_LOAD[i] = 0;
+	app_regs.REG_CPU_LOAD_CONTROL = 0;
+	app_regs.REG_LOOP_LATENCY_CHANNEL = 0;
+	app_regs.REG_LOOP_LATENCY_RESET = 0;
+	
+	app_regs.REG_MIX_ENABLE = 0;
+	app_regs.REG_MIX_TOTAL_FLOW = 0;
+	for (uint8_t i = 0; i < MIX_ODOR_CHANNELS; i++)
+		app_regs.REG_MIX_CONCENTRATIONS[i] = 0;
+	
+	app_regs.REG_PWM_DITHER = 0;
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		app_regs.REG_PWM_PHASE[i] = i * 20;
+	
+	app_regs.REG_FLOW_SETTLE_TOLERANCE = 2;
+	app_regs.REG_FLOW_SETTLE_DWELL = 100;
+	app_regs.REG_FLOW_SETTLED = 0;
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		app_regs.REG_FLOW_SETTLE_TIME[i] = 0;
+	
 	app_regs.REG_DI0_TRIGGER = GM_DIN0_SYNC;
 	app_regs.REG_DO0_SYNC = GM_DOUT0_SOFTWARE;
-	app_regs.REG_DO0_SYNC = GM_DOUT1_SOFTWARE;
+	app_regs.REG_DO1_SYNC = GM_DOUT1_SOFTWARE;
 	
 	app_regs.REG_MIMIC_ODOR_VALVE0 = GM_MIMIC_NONE;
 	app_regs.REG_MIMIC_ODOR_VALVE1 = GM_MIMIC_NONE;
@@ -1008,18 +1982,10 @@ void core_callback_reset_registers(void)
 	app_regs.REG_ENABLE_VALVE_EXT_CTRL = 0;
 	app_regs.REG_ENABLE_TEMP_CALIBRATION = 1;
 		
-	status_DC.DC0_ready = 0;
-	status_DC.DC1_ready = 0;
-	status_DC.DC2_ready = 0;
-	status_DC.DC3_ready = 0;
-	status_DC.DC4_ready = 0;
-	
-	status_DC.flow0_update = 1;
-	status_DC.flow1_update = 1;
-	status_DC.flow2_update = 1;
-	status_DC.flow3_update = 1;
-	status_DC.flow4_update = 1;
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		status_DC.flow_update[i] = 1;
 	
+	update_channel3_range();
 	init_calibration_values();
 	
 }
@@ -1027,20 +1993,52 @@ void core_callback_reset_registers(void)
 void core_callback_registers_were_reinitialized(void)
 {
 
-	// duty cycle calculation update 
-	hwbp_app_pwm_gen_update_dc0();
-	hwbp_app_pwm_gen_update_dc1();
-	hwbp_app_pwm_gen_update_dc2();
-	hwbp_app_pwm_gen_update_dc3();
-	hwbp_app_pwm_gen_update_dc4();
-
-	// stop PWMs 
-	timer_type0_stop(&TCC0);
-	timer_type0_stop(&TCD0);
-	timer_type0_stop(&TCE0);
-	timer_type0_stop(&TCF0);
-	timer_type1_stop(&TCD1);
+	uint8_t no_profiles[FLOW_CHANNELS] = {0};
+	
+	update_channel3_range();
+	
+	/* A stored profile that is no longer valid falls back to the calibration */
+	if (!app_write_REG_CALIBRATION_PROFILE(app_regs.REG_CALIBRATION_PROFILE))
+		app_write_REG_CALIBRATION_PROFILE(no_profiles);
+	
+	/* The volumes are measured, not restored */
+	command_total_volume(MSK_FLOW_CHANNELS | B_TOTAL_VOLUME_RESET);
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		app_regs.REG_CHANNELS_TOTAL_VOLUME_LATCHED[i] = 0;
+	if (app_write_REG_TOTAL_VOLUME_GATED(&app_regs.REG_TOTAL_VOLUME_GATED) == false)
+		app_regs.REG_TOTAL_VOLUME_GATED = 0;
+	
+	/* A stored mix that does not fit the channels is not used */
+	if (!write_mix(app_regs.REG_MIX_TOTAL_FLOW, app_regs.REG_MIX_CONCENTRATIONS))
+		app_regs.REG_MIX_ENABLE = 0;
+	
+	/* The reports select what they read */
+	if (app_regs.REG_PROFILER_SITE >= PROFILER_SITES)
+		app_regs.REG_PROFILER_SITE = 0;
+	if (app_regs.REG_LOOP_LATENCY_CHANNEL >= FLOW_CHANNELS)
+		app_regs.REG_LOOP_LATENCY_CHANNEL = 0;
+	if (app_regs.REG_SEQUENCE_SETTLE_TIMEOUT == 0)
+		app_regs.REG_SEQUENCE_SETTLE_TIMEOUT = 10000;
+	
+	/* A sweep does not survive the registers being reinitialized */
+	app_regs.REG_CALIBRATION_SWEEP = 0;
+	if (!app_write_REG_CALIBRATION_SWEEP_CONFIG(app_regs.REG_CALIBRATION_SWEEP_CONFIG))
+		app_write_REG_CALIBRATION_SWEEP_CONFIG(sweep_config_default);
+	
+	/* The last curve written, when it was saved with the registers */
+	if (!app_write_REG_CALIBRATION_CURVE(app_regs.REG_CALIBRATION_CURVE))
+		app_regs.REG_CALIBRATION_CURVE[1] = 0;
+	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		// duty cycle calculation update 
+		hwbp_app_pwm_gen_update_dc(i);
+		
+		// stop PWMs 
+		hwbp_app_pwm_gen_stop(i);
+	}
 	
+	app_write_REG_PWM_DITHER(&app_regs.REG_PWM_DITHER);
 	app_write_REG_ENABLE_CHECK_VALVES_SYNC(&app_regs.REG_ENABLE_CHECK_VALVES_SYNC);
 	app_write_REG_DI0_TRIGGER(&app_regs.REG_DI0_TRIGGER);
 	app_write_REG_DO0_SYNC(&app_regs.REG_DO0_SYNC);
@@ -1086,6 +2084,7 @@ void core_callback_device_to_standby(void) {
 	app_regs.REG_ENABLE_FLOW = 0;
 	app_write_REG_ENABLE_FLOW(&app_regs.REG_ENABLE_FLOW);
 	standby_mfcs = 5;
+	app_regs.REG_MIX_ENABLE = 0;
 	app_regs.REG_CHANNEL0_TARGET_FLOW = 0;
 	app_write_REG_CHANNEL0_TARGET_FLOW(&app_regs.REG_CHANNEL0_TARGET_FLOW);
 	app_regs.REG_CHANNEL1_TARGET_FLOW = 0;
@@ -1111,75 +2110,133 @@ void core_callback_device_to_speed(void) {}
 /************************************************************************/
 void core_callback_t_before_exec(void) {}
 void core_callback_t_after_exec(void) {}
-void core_callback_t_new_second(void) {}
+void core_callback_t_new_second(void) {
+	
+	cpu_load_second();
+}
 void core_callback_t_500us(void) {
 	
+	PROFILER_ENTRY(PROFILER_T_500US);
+	
+	/* Collect every valve that ends now and switch them with a single write */
+	uint16_t set_mask = 0;
+	uint16_t clear_mask = 0;
+	uint16_t odor_edges;
+	uint16_t odor_next = 0;
+	uint8_t trains_done = 0;
+	
+	if (trains.active)
+		trains_done = valves_train_tick(&set_mask, &clear_mask);
 	
 	if (pulse_countdown.valve0 > 0)
 		if (--pulse_countdown.valve0 == 0)
-			stop_VALVE0;
+			clear_mask |= B_VALVE0;
 			
 	if (pulse_countdown.valve1 > 0)
 		if (--pulse_countdown.valve1 == 0)
-			stop_VALVE1;
+			clear_mask |= B_VALVE1;
 			
 	if (pulse_countdown.valve2 > 0)
 		if (--pulse_countdown.valve2 == 0)
-			stop_VALVE2;
+			clear_mask |= B_VALVE2;
 		
 	if (pulse_countdown.valve3 > 0)
 		if (--pulse_countdown.valve3 == 0)
-			stop_VALVE3;
+			clear_mask |= B_VALVE3;
+			
+	/* An odor valve switched by its pulse or train still drives its check valve */
+	odor_edges = (set_mask | clear_mask) & MSK_ODOR_VALVES;
+	if (odor_edges)
+		arm_valves_countdown(0, odor_edges);
+	
+	if (pulse_countdown.delayvalve0chk | pulse_countdown.delayvalve1chk | pulse_countdown.delayvalve2chk | pulse_countdown.delayvalve3chk)
+		odor_next = ((read_valves() | set_mask) & ~clear_mask) & MSK_ODOR_VALVES;
 			
 	if (pulse_countdown.delayvalve0chk > 0)
-		if (--pulse_countdown.delayvalve0chk == 0){ if (read_VALVE0) set_VALVE0CHK; else clr_VALVE0CHK;}
+		if (--pulse_countdown.delayvalve0chk == 0){ if (odor_next & B_VALVE0) set_mask |= B_CHECK_VALVE0; else clear_mask |= B_CHECK_VALVE0;}
 		
 	if (pulse_countdown.delayvalve1chk > 0)
-		if (--pulse_countdown.delayvalve1chk == 0){ if (read_VALVE1) set_VALVE1CHK; else clr_VALVE1CHK;}
+		if (--pulse_countdown.delayvalve1chk == 0){ if (odor_next & B_VALVE1) set_mask |= B_CHECK_VALVE1; else clear_mask |= B_CHECK_VALVE1;}
 		
 	if (pulse_countdown.delayvalve2chk > 0)
-		if (--pulse_countdown.delayvalve2chk == 0){ if (read_VALVE2) set_VALVE2CHK; else clr_VALVE2CHK;}
+		if (--pulse_countdown.delayvalve2chk == 0){ if (odor_next & B_VALVE2) set_mask |= B_CHECK_VALVE2; else clear_mask |= B_CHECK_VALVE2;}
 		
 	if (pulse_countdown.delayvalve3chk > 0)
-		if (--pulse_countdown.delayvalve3chk == 0){ if (read_VALVE3) set_VALVE3CHK; else clr_VALVE3CHK;}
+		if (--pulse_countdown.delayvalve3chk == 0){ if (odor_next & B_VALVE3) set_mask |= B_CHECK_VALVE3; else clear_mask |= B_CHECK_VALVE3;}
 			
 			
 	if (pulse_countdown.chkvalve0 > 0)
 		if (--pulse_countdown.chkvalve0 == 0)
-			clr_VALVE0CHK;
+			clear_mask |= B_CHECK_VALVE0;
 		
 	if (pulse_countdown.chkvalve1 > 0)
 		if (--pulse_countdown.chkvalve1 == 0)
-			clr_VALVE1CHK;
+			clear_mask |= B_CHECK_VALVE1;
 		
 	if (pulse_countdown.chkvalve2 > 0)
 		if (--pulse_countdown.chkvalve2 == 0)
-			clr_VALVE2CHK;
+			clear_mask |= B_CHECK_VALVE2;
 		
 	if (pulse_countdown.chkvalve3 > 0)
 		if (--pulse_countdown.chkvalve3 == 0)
-			clr_VALVE3CHK;
+			clear_mask |= B_CHECK_VALVE3;
 			
 	if (pulse_countdown.valveaux0 > 0)
 		if (--pulse_countdown.valveaux0 == 0)
-			clr_ENDVALVE0;
+			clear_mask |= B_ENDVALVE0;
 	
 	if (pulse_countdown.valveaux1 > 0)
 		if (--pulse_countdown.valveaux1 == 0)
-			clr_ENDVALVE1;
+			clear_mask |= B_ENDVALVE1;
 	
 	if (pulse_countdown.valvedummy > 0)
 		if (--pulse_countdown.valvedummy == 0)
-			clr_DUMMYVALVE;
+			clear_mask |= B_DUMMYVALVE;
+	
+	if (set_mask | clear_mask)
+		write_valves(set_mask & ~clear_mask, clear_mask);
+	
+	if (app_regs.REG_SEQUENCE_CONTROL == GM_SEQUENCE_RUNNING)
+		sequence_tick();
+	
+	if (dout_pulse_countdown > 0)
+		if (--dout_pulse_countdown == 0)
+			update_douts(GM_DOUT0_SEQUENCE_PULSE, DOUT_CLEAR);
+	
+	if (trains_done)
+	{
+		app_regs.REG_VALVES_TRAIN_DONE = trains_done;
+		
+		if (app_regs.REG_ENABLE_EVENTS & B_EVT4)
+			core_func_send_event(ADD_REG_VALVES_TRAIN_DONE, true);
+	}
 	
+	PROFILER_EXIT(PROFILER_T_500US);
 }
 
 void core_callback_t_1ms(void) {
 
+	PROFILER_ENTRY(PROFILER_T_1MS);
+	
+	cpu_load_tick();
+	
+	if (mix_pending)
+		mix_tick();
+	
+	flow_settle_tick();
+	save_warm_start_tick();
+	
+	if (app_regs.REG_ENABLE_FLOW & B_START)
+		total_volume_tick();
+	save_calibration_profile_tick();
+
 	
 	if(++temp_sampling_counter >= TEMP_SAMPLING_DIVIDER){	
-		if (app_regs.REG_TEMPERATURE_VALUE != 0)
+		if (app_regs.REG_TEMPERATURE_VALUE != 0){
+			PROFILER_ENTRY(PROFILER_READ_TEMPERATURE);
 			read_temperature();
+			PROFILER_EXIT(PROFILER_READ_TEMPERATURE);
+		}
 		temp_sampling_counter = 0;
 	}
 	
@@ -1190,19 +2247,35 @@ void core_callback_t_1ms(void) {
 		// read ADC at 1ms x ADC_SAMPLING_DIVIDER
 		if(++ADC_sampling_counter >= ADC_SAMPLING_DIVIDER){		
 			set_CONVST;
+			adc_conversion_started();
+			update_douts(GM_DOUT0_ADC_CLOCK, DOUT_TOGGLE);
 			ADC_sampling_counter = 0;
+			
+			if (app_regs.REG_CALIBRATION_SWEEP & B_SWEEP_RUN)
+				calibration_sweep_tick();
 		    
 			// go over each flow controller
 			if(++close_loop_counter_ms >= CLOSE_LOOP_TIMING){
-				if(++close_loop_case >= 5)
+				if(++close_loop_case >= FLOW_CHANNELS)
 					close_loop_case = 0;
-				closed_loop_control(close_loop_case);
+				
+				// a disabled or swept channel keeps its time slot so the others are not disturbed
+				if ((app_regs.REG_CHANNELS_ENABLE & (1 << close_loop_case)) &&
+					!((app_regs.REG_CALIBRATION_SWEEP & B_SWEEP_RUN) && sweep_channel == close_loop_case)){
+					PROFILER_ENTRY(PROFILER_CLOSED_LOOP);
+					closed_loop_control(close_loop_case);
+					PROFILER_EXIT(PROFILER_CLOSED_LOOP);
+					update_flow_settled(close_loop_case);
+				}
+				update_douts(GM_DOUT0_HEARTBEAT, DOUT_TOGGLE);
 				if(standby_mfcs)
 					standby_mfcs--;	
 				close_loop_counter_ms = 0;
 			}				
 		}
 	}
+	
+	PROFILER_EXIT(PROFILER_T_1MS);
 }
 
 
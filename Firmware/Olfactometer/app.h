@@ -9,10 +9,37 @@
 #define hwbp_app_enable_interrupts 	PMIC_CTRL = PMIC_CTRL | PMIC_RREN_bm | PMIC_LOLVLEN_bm | PMIC_MEDLVLEN_bm | PMIC_HILVLEN_bm; __asm volatile("sei");
 
 
+/************************************************************************/
+/* Digital outputs actions                                              */
+/************************************************************************/
+#define DOUT_CLEAR 0
+#define DOUT_SET 1
+#define DOUT_TOGGLE 2
+
+
 /************************************************************************/
 /* User prototypes                                                      */
 /************************************************************************/
 void init_calibration_values(void);
+void update_channel3_range(void);
+void compile_calibration(uint8_t channel);
+void save_calibration_profile_tick(void);
+void stop_calibration_sweep(void);
+void calibration_sweep_tick(void);
+void command_total_volume(uint8_t command);
+void total_volume_tick(void);
+void mix_tick(void);
+void start_valves_train(uint16_t mask);
+void stop_valves_train(uint16_t mask);
+uint8_t valves_train_tick(uint16_t *set_mask, uint16_t *clear_mask);
+void start_sequence(void);
+void stop_sequence(void);
+void sequence_tick(void);
+void update_douts(uint8_t conf, uint8_t action);
+void restart_flow_settle(uint8_t mask);
+void warm_start_channels(void);
+void save_warm_start(void);
+void clear_warm_start(void);
 
 
 /************************************************************************/
@@ -5,15 +5,25 @@
 #include "hwbp_core_regs.h"
 #include "aux_funcs.h"
 #include "app.h"
+#include "profiler.h"
 
 #include "usart_driver.h"
 
 extern countdown_t pulse_countdown;
 extern status_PWM_DC_t status_DC;
+extern flow_channel_t flow_channels[];
+extern sequence_step_t sequence_steps[];
 
 //char* itoa(int, char* , int); 
 
 extern uint8_t mfcs;
+extern uint8_t calibration_source;
+extern bool calibration_record_damaged;
+extern bool mix_pending;
+
+extern uint8_t aux_isolation;
+extern uint8_t aux_end;
+extern uint16_t aux_check;
 
 /************************************************************************/
 /* Create pointers to functions                                         */
@@ -95,7 +105,57 @@ void (*app_func_rd_pointer[])(void) = {
 	&app_read_REG_TEMPERATURE_VALUE,
 	&app_read_REG_ENABLE_TEMP_CALIBRATION,
 	&app_read_REG_TEMP_USER_CALIBRATION,
-	&app_read_REG_ENABLE_EVENTS
+	&app_read_REG_ENABLE_EVENTS,
+	&app_read_REG_VALVES_EVENT,
+	&app_read_REG_VALVE0_TRAIN,
+	&app_read_REG_VALVE1_TRAIN,
+	&app_read_REG_VALVE2_TRAIN,
+	&app_read_REG_VALVE3_TRAIN,
+	&app_read_REG_END_VALVE0_TRAIN,
+	&app_read_REG_END_VALVE1_TRAIN,
+	&app_read_REG_DUMMY_VALVE_TRAIN,
+	&app_read_REG_VALVES_TRAIN_START,
+	&app_read_REG_VALVES_TRAIN_STOP,
+	&app_read_REG_VALVES_TRAIN_DONE,
+	&app_read_REG_SEQUENCE_CONTROL,
+	&app_read_REG_SEQUENCE_LENGTH,
+	&app_read_REG_SEQUENCE_STEP_INDEX,
+	&app_read_REG_SEQUENCE_STEP,
+	&app_read_REG_SEQUENCE_STEP_FLOWS,
+	&app_read_REG_DI0_DEBOUNCE,
+	&app_read_REG_FLOW_SETTLE_TOLERANCE,
+	&app_read_REG_FLOW_SETTLE_DWELL,
+	&app_read_REG_FLOW_SETTLED,
+	&app_read_REG_FLOW_SETTLE_TIME,
+	&app_read_REG_PWM_DITHER,
+	&app_read_REG_PWM_PHASE,
+	&app_read_REG_CHANNELS_ENABLE,
+	&app_read_REG_CHANNELS_ENABLE_EVENTS,
+	&app_read_REG_WARM_START,
+	&app_read_REG_CALIBRATION_PROFILE,
+	&app_read_REG_CALIBRATION_PROFILE_NAME,
+	&app_read_REG_CALIBRATION_PROFILE_SAVE,
+	&app_read_REG_CALIBRATION_CURVE,
+	&app_read_REG_CALIBRATION_SWEEP,
+	&app_read_REG_CALIBRATION_SWEEP_CONFIG,
+	&app_read_REG_CALIBRATION_SWEEP_DATA,
+	&app_read_REG_CHANNELS_TOTAL_VOLUME,
+	&app_read_REG_CHANNELS_TOTAL_VOLUME_LATCHED,
+	&app_read_REG_TOTAL_VOLUME_COMMAND,
+	&app_read_REG_TOTAL_VOLUME_GATED,
+	&app_read_REG_MIX_TOTAL_FLOW,
+	&app_read_REG_MIX_CONCENTRATIONS,
+	&app_read_REG_MIX_ENABLE,
+	&app_read_REG_PROFILER_CONTROL,
+	&app_read_REG_PROFILER_SITE,
+	&app_read_REG_PROFILER_DATA,
+	&app_read_REG_CPU_LOAD,
+	&app_read_REG_CPU_LOAD_CONTROL,
+	&app_read_REG_LOOP_LATENCY_CHANNEL,
+	&app_read_REG_LOOP_LATENCY,
+	&app_read_REG_LOOP_LATENCY_RESET,
+	&app_read_REG_SEQUENCE_SETTLE_TIMEOUT,
+	&app_read_REG_CALIBRATION_SOURCE
 };
 
 bool (*app_func_wr_pointer[])(void*) = {
@@ -173,42 +233,196 @@ bool (*app_func_wr_pointer[])(void*) = {
 	&app_write_REG_TEMPERATURE_VALUE,
 	&app_write_REG_ENABLE_TEMP_CALIBRATION,
 	&app_write_REG_TEMP_USER_CALIBRATION,
-	&app_write_REG_ENABLE_EVENTS
+	&app_write_REG_ENABLE_EVENTS,
+	&app_write_REG_VALVES_EVENT,
+	&app_write_REG_VALVE0_TRAIN,
+	&app_write_REG_VALVE1_TRAIN,
+	&app_write_REG_VALVE2_TRAIN,
+	&app_write_REG_VALVE3_TRAIN,
+	&app_write_REG_END_VALVE0_TRAIN,
+	&app_write_REG_END_VALVE1_TRAIN,
+	&app_write_REG_DUMMY_VALVE_TRAIN,
+	&app_write_REG_VALVES_TRAIN_START,
+	&app_write_REG_VALVES_TRAIN_STOP,
+	&app_write_REG_VALVES_TRAIN_DONE,
+	&app_write_REG_SEQUENCE_CONTROL,
+	&app_write_REG_SEQUENCE_LENGTH,
+	&app_write_REG_SEQUENCE_STEP_INDEX,
+	&app_write_REG_SEQUENCE_STEP,
+	&app_write_REG_SEQUENCE_STEP_FLOWS,
+	&app_write_REG_DI0_DEBOUNCE,
+	&app_write_REG_FLOW_SETTLE_TOLERANCE,
+	&app_write_REG_FLOW_SETTLE_DWELL,
+	&app_write_REG_FLOW_SETTLED,
+	&app_write_REG_FLOW_SETTLE_TIME,
+	&app_write_REG_PWM_DITHER,
+	&app_write_REG_PWM_PHASE,
+	&app_write_REG_CHANNELS_ENABLE,
+	&app_write_REG_CHANNELS_ENABLE_EVENTS,
+	&app_write_REG_WARM_START,
+	&app_write_REG_CALIBRATION_PROFILE,
+	&app_write_REG_CALIBRATION_PROFILE_NAME,
+	&app_write_REG_CALIBRATION_PROFILE_SAVE,
+	&app_write_REG_CALIBRATION_CURVE,
+	&app_write_REG_CALIBRATION_SWEEP,
+	&app_write_REG_CALIBRATION_SWEEP_CONFIG,
+	&app_write_REG_CALIBRATION_SWEEP_DATA,
+	&app_write_REG_CHANNELS_TOTAL_VOLUME,
+	&app_write_REG_CHANNELS_TOTAL_VOLUME_LATCHED,
+	&app_write_REG_TOTAL_VOLUME_COMMAND,
+	&app_write_REG_TOTAL_VOLUME_GATED,
+	&app_write_REG_MIX_TOTAL_FLOW,
+	&app_write_REG_MIX_CONCENTRATIONS,
+	&app_write_REG_MIX_ENABLE,
+	&app_write_REG_PROFILER_CONTROL,
+	&app_write_REG_PROFILER_SITE,
+	&app_write_REG_PROFILER_DATA,
+	&app_write_REG_CPU_LOAD,
+	&app_write_REG_CPU_LOAD_CONTROL,
+	&app_write_REG_LOOP_LATENCY_CHANNEL,
+	&app_write_REG_LOOP_LATENCY,
+	&app_write_REG_LOOP_LATENCY_RESET,
+	&app_write_REG_SEQUENCE_SETTLE_TIMEOUT,
+	&app_write_REG_CALIBRATION_SOURCE
 };
 
 	
 /************************************************************************/
-/* Stop and update DC of valves PWM                                     */
+/* Flow channels register writes                                        */
 /************************************************************************/
+/* The per channel registers all behave the same, only the descriptor   */
+/* changes, so their write handlers forward here.                       */
+uint16_t target_flow_limit(uint8_t channel)
+{
+	uint16_t full_scale = flow_channels[channel].full_scale;
+	
+	/* In auto range channel 3 takes the setpoints of both ranges */
+	if (channel == 3 && (app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_AUTO)
+		full_scale = 1000;
+	
+	return full_scale + full_scale / 10;
+}
+
+bool write_target_flow(uint8_t channel, float target_flow)
+{
+	flow_channel_t *flow = &flow_channels[channel];
+	uint16_t limit = target_flow_limit(channel);
+	
+	if (target_flow == 0)
+		hwbp_app_pwm_gen_stop(channel);
+		
+	if (target_flow > limit)
+		*flow->target_flow = limit;
+	else 
+		*flow->target_flow = target_flow;
+		
+	app_regs.REG_CHANNELS_TARGET_FLOW[channel] = *flow->target_flow;
+
+	if(mfcs)
+		status_DC.flow_update[channel] = 1;
+	
+	return true;
+}
 
-void stop_and_update_ch0_temps(void)
+bool write_frequency(uint8_t channel, uint16_t frequency)
 {
-	hwbp_app_pwm_gen_stop_ch0();
-	hwbp_app_pwm_gen_update_dc0();
+	if (frequency < 100 || frequency > 10000)
+		return false;
+
+	*flow_channels[channel].frequency = frequency;
+	
+	/* Stop and update DC of valves PWM */
+	hwbp_app_pwm_gen_stop(channel);
+	hwbp_app_pwm_gen_update_dc(channel);
+	return true;
+}
+
+bool write_duty_cycle(uint8_t channel, float duty_cycle)
+{
+	if (duty_cycle <= 0.1 || duty_cycle >= 99.9)
+		return false;
+
+	*flow_channels[channel].duty_cycle = duty_cycle;
+	hwbp_app_pwm_gen_set_dc(channel);
+	
+	if ((app_regs.REG_ENABLE_FLOW & B_START) && (app_regs.REG_CHANNELS_ENABLE & (1 << channel)))
+		hwbp_app_pwm_gen_start(channel);
+	
+	return true;
 }
 
-void stop_and_update_ch1_temps(void)
-{       
-	hwbp_app_pwm_gen_stop_ch1();
-    hwbp_app_pwm_gen_update_dc1();
+bool write_user_calibration(uint8_t channel, uint16_t *calibration, uint16_t *values)
+{
+	if (!calibration_increasing(values))
+		return false;
+	
+	for (uint8_t i = 0; i < CALIBRATION_POINTS; i++)
+		calibration[i] = values[i];
+	
+	compile_calibration(channel);
+	return true;
 }
 
-void stop_and_update_ch2_temps(void)
-{       
-	hwbp_app_pwm_gen_stop_ch2();
-    hwbp_app_pwm_gen_update_dc2();
+
+/************************************************************************/
+/* Arm the pulse and check valves countdowns                            */
+/************************************************************************/
+/* Same timing as the start_ and stop_ macros, applied to the valves    */
+/* that were switched together by write_valves().                       */
+void arm_valves_countdown(uint16_t started, uint16_t stopped)
+{
+	uint16_t pulse = started & app_regs.REG_ENABLE_VALVES_PULSE;
+	uint16_t sync = (started | stopped) & (app_regs.REG_ENABLE_CHECK_VALVES_SYNC >> 8);
+	
+	if (pulse & B_VALVE0) pulse_countdown.valve0 = app_regs.REG_VALVE0_PULSE_DURATION + 1;
+	if (pulse & B_VALVE1) pulse_countdown.valve1 = app_regs.REG_VALVE1_PULSE_DURATION + 1;
+	if (pulse & B_VALVE2) pulse_countdown.valve2 = app_regs.REG_VALVE2_PULSE_DURATION + 1;
+	if (pulse & B_VALVE3) pulse_countdown.valve3 = app_regs.REG_VALVE3_PULSE_DURATION + 1;
+	if (pulse & B_ENDVALVE0) pulse_countdown.valveaux0 = app_regs.REG_END_VALVE0_PULSE_DURATION + 1;
+	if (pulse & B_ENDVALVE1) pulse_countdown.valveaux1 = app_regs.REG_END_VALVE1_PULSE_DURATION + 1;
+	if (pulse & B_DUMMYVALVE) pulse_countdown.valvedummy = app_regs.REG_DUMMY_VALVE_PULSE_DURATION + 1;
+	if (pulse & B_CHECK_VALVE0) pulse_countdown.chkvalve0 = app_regs.REG_VALVE0CHK_DELAY + 1;
+	if (pulse & B_CHECK_VALVE1) pulse_countdown.chkvalve1 = app_regs.REG_VALVE1CHK_DELAY + 1;
+	if (pulse & B_CHECK_VALVE2) pulse_countdown.chkvalve2 = app_regs.REG_VALVE2CHK_DELAY + 1;
+	if (pulse & B_CHECK_VALVE3) pulse_countdown.chkvalve3 = app_regs.REG_VALVE3CHK_DELAY + 1;
+	
+	/* Odor valve n drives check valve n (bit n + 8) when sync is enabled */
+	if (sync & B_VALVE0) pulse_countdown.delayvalve0chk = app_regs.REG_VALVE0CHK_DELAY + 1;
+	if (sync & B_VALVE1) pulse_countdown.delayvalve1chk = app_regs.REG_VALVE1CHK_DELAY + 1;
+	if (sync & B_VALVE2) pulse_countdown.delayvalve2chk = app_regs.REG_VALVE2CHK_DELAY + 1;
+	if (sync & B_VALVE3) pulse_countdown.delayvalve3chk = app_regs.REG_VALVE3CHK_DELAY + 1;
 }
 
-void stop_and_update_ch3_temps(void)
-{       
-	hwbp_app_pwm_gen_stop_ch3();
-    hwbp_app_pwm_gen_update_dc3();
+
+/************************************************************************/
+/* Send an event with a latched timestamp                               */
+/************************************************************************/
+/* The user timestamp is borrowed to send the event and restored after, */
+/* since the ADC events rely on it.                                     */
+void send_event_at(uint8_t add, uint32_t seconds, uint16_t useconds)
+{
+	uint32_t user_seconds;
+	uint16_t user_useconds;
+	uint8_t sreg = SREG;
+	
+	cli();
+	core_func_read_user_timestamp(&user_seconds, &user_useconds);
+	core_func_update_user_timestamp(seconds, useconds);
+	core_func_send_event(add, false);
+	core_func_update_user_timestamp(user_seconds, user_useconds);
+	SREG = sreg;
 }
 
-void stop_and_update_ch4_temps(void)
-{       
-	hwbp_app_pwm_gen_stop_ch4();
-    hwbp_app_pwm_gen_update_dc4();
+
+/************************************************************************/
+/* Send a valves transition event                                       */
+/************************************************************************/
+void send_valves_event(uint16_t changed, uint16_t state, uint32_t seconds, uint16_t useconds)
+{
+	app_regs.REG_VALVES_EVENT[0] = changed;
+	app_regs.REG_VALVES_EVENT[1] = state;
+	
+	send_event_at(ADD_REG_VALVES_EVENT, seconds, useconds);
 }
 
 
@@ -224,6 +438,7 @@ void app_read_REG_ENABLE_FLOW(void)
 bool app_write_REG_ENABLE_FLOW(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	uint8_t started;
 	float low_limit_dc = 1;
 
 	if((app_regs.REG_DO1_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_START){
@@ -234,21 +449,29 @@ bool app_write_REG_ENABLE_FLOW(void *a)
 	
 	
 	if (!(reg & B_START)){
-		hwbp_app_pwm_gen_stop_ch0();
-		hwbp_app_pwm_gen_stop_ch1();
-		hwbp_app_pwm_gen_stop_ch2();
-		hwbp_app_pwm_gen_stop_ch3();
-		hwbp_app_pwm_gen_stop_ch4();
+		stop_calibration_sweep();
+		
+		for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		{
+			hwbp_app_pwm_gen_stop(i);
+			write_duty_cycle(i, low_limit_dc);
+		}
 		
-		app_write_REG_CHANNEL0_DUTY_CYCLE(&low_limit_dc);
-		app_write_REG_CHANNEL1_DUTY_CYCLE(&low_limit_dc);
-		app_write_REG_CHANNEL2_DUTY_CYCLE(&low_limit_dc);
-		app_write_REG_CHANNEL3_DUTY_CYCLE(&low_limit_dc);
-		app_write_REG_CHANNEL4_DUTY_CYCLE(&low_limit_dc);
+		if (app_regs.REG_WARM_START & B_WARM_START_EEPROM)
+			save_warm_start();
 	}
+	
+	/* Starting or stopping the flow is a setpoint change for every channel */
+	if ((reg ^ app_regs.REG_ENABLE_FLOW) & B_START)
+		restart_flow_settle(MSK_FLOW_CHANNELS);
+	
+	started = reg & ~app_regs.REG_ENABLE_FLOW & B_START;
 				
 	app_regs.REG_ENABLE_FLOW = reg;
 	
+	if (started && (app_regs.REG_WARM_START & B_WARM_START))
+		warm_start_channels();
+	
 	return true;
 }
 
@@ -304,19 +527,7 @@ bool app_write_REG_CHANNEL0_USER_CALIBRATION(void *a)
 {
 	uint16_t *reg = ((uint16_t*)a);
 
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[0] = reg[0];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[1] = reg[1];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[2] = reg[2];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[3] = reg[3];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[4] = reg[4];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[5] = reg[5];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[6] = reg[6];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[7] = reg[7];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[8] = reg[8];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[9] = reg[9];
-	app_regs.REG_CHANNEL0_USER_CALIBRATION[10] = reg[10];
-	
-	return true;
+	return write_user_calibration(0, app_regs.REG_CHANNEL0_USER_CALIBRATION, reg);
 }
 
 
@@ -334,19 +545,7 @@ bool app_write_REG_CHANNEL1_USER_CALIBRATION(void *a)
 {
 	uint16_t *reg = ((uint16_t*)a);
 
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[0] = reg[0];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[1] = reg[1];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[2] = reg[2];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[3] = reg[3];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[4] = reg[4];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[5] = reg[5];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[6] = reg[6];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[7] = reg[7];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[8] = reg[8];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[9] = reg[9];
-	app_regs.REG_CHANNEL1_USER_CALIBRATION[10] = reg[10];
-	
-	return true;
+	return write_user_calibration(1, app_regs.REG_CHANNEL1_USER_CALIBRATION, reg);
 }
 
 
@@ -364,18 +563,7 @@ bool app_write_REG_CHANNEL2_USER_CALIBRATION(void *a)
 {
 	uint16_t *reg = ((uint16_t*)a);
 
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[0] = reg[0];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[1] = reg[1];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[2] = reg[2];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[3] = reg[3];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[4] = reg[4];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[5] = reg[5];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[6] = reg[6];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[7] = reg[7];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[8] = reg[8];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[9] = reg[9];
-	app_regs.REG_CHANNEL2_USER_CALIBRATION[10] = reg[10];
-	return true;
+	return write_user_calibration(2, app_regs.REG_CHANNEL2_USER_CALIBRATION, reg);
 }
 
 
@@ -393,18 +581,7 @@ bool app_write_REG_CHANNEL3_USER_CALIBRATION(void *a)
 {
 	uint16_t *reg = ((uint16_t*)a);
 
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[0] = reg[0];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[1] = reg[1];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[2] = reg[2];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[3] = reg[3];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[4] = reg[4];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[5] = reg[5];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[6] = reg[6];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[7] = reg[7];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[8] = reg[8];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[9] = reg[9];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION[10] = reg[10];
-	return true;
+	return write_user_calibration(3, app_regs.REG_CHANNEL3_USER_CALIBRATION, reg);
 }
 
 
@@ -422,18 +599,7 @@ bool app_write_REG_CHANNEL4_USER_CALIBRATION(void *a)
 {
 	uint16_t *reg = ((uint16_t*)a);
 
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[0] = reg[0];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[1] = reg[1];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[2] = reg[2];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[3] = reg[3];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[4] = reg[4];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[5] = reg[5];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[6] = reg[6];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[7] = reg[7];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[8] = reg[8];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[9] = reg[9];
-	app_regs.REG_CHANNEL4_USER_CALIBRATION[10] = reg[10];
-	return true;
+	return write_user_calibration(4, app_regs.REG_CHANNEL4_USER_CALIBRATION, reg);
 }
 
 
@@ -451,18 +617,7 @@ bool app_write_REG_CHANNEL3_USER_CALIBRATION_AUX(void *a)
 {
 	uint16_t *reg = ((uint16_t*)a);
 
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[0] = reg[0];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[1] = reg[1];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[2] = reg[2];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[3] = reg[3];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[4] = reg[4];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[5] = reg[5];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[6] = reg[6];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[7] = reg[7];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[8] = reg[8];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[9] = reg[9];
-	app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX[10] = reg[10];
-	return true;
+	return write_user_calibration(3, app_regs.REG_CHANNEL3_USER_CALIBRATION_AUX, reg);
 }
 
 
@@ -503,20 +658,7 @@ bool app_write_REG_CHANNEL0_TARGET_FLOW(void *a)
 {
 	float reg = *((float*)a);
 	
-	if (reg == 0)
-		hwbp_app_pwm_gen_stop_ch0();
-		
-	if (reg > 110)
-		app_regs.REG_CHANNEL0_TARGET_FLOW = 110;
-	else 
-		app_regs.REG_CHANNEL0_TARGET_FLOW = reg;
-		
-	app_regs.REG_CHANNELS_TARGET_FLOW[0] = app_regs.REG_CHANNEL0_TARGET_FLOW;
-
-	if(mfcs)
-		status_DC.flow0_update = 1;
-	
-	return true;
+	return write_target_flow(0, reg);
 }
 
 
@@ -533,20 +675,7 @@ bool app_write_REG_CHANNEL1_TARGET_FLOW(void *a)
 {
 	float reg = *((float*)a);
 	
-	if (reg == 0)
-		hwbp_app_pwm_gen_stop_ch1();
-	
-	if (reg > 110)
-		app_regs.REG_CHANNEL1_TARGET_FLOW = 110;
-	else
-		app_regs.REG_CHANNEL1_TARGET_FLOW = reg;
-		
-	app_regs.REG_CHANNELS_TARGET_FLOW[1] = app_regs.REG_CHANNEL1_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow1_update = 1;
-
-	return true;
+	return write_target_flow(1, reg);
 }
 
 
@@ -562,21 +691,8 @@ void app_read_REG_CHANNEL2_TARGET_FLOW(void)
 bool app_write_REG_CHANNEL2_TARGET_FLOW(void *a)
 {
 	float reg = *((float*)a);
-
-	if (reg == 0)
-		hwbp_app_pwm_gen_stop_ch2();
-	
-	if (reg > 110)
-		app_regs.REG_CHANNEL2_TARGET_FLOW = 110;
-	else
-		app_regs.REG_CHANNEL2_TARGET_FLOW = reg;
-		
-	app_regs.REG_CHANNELS_TARGET_FLOW[2] = app_regs.REG_CHANNEL2_TARGET_FLOW;
 	
-	if(mfcs)
-		status_DC.flow2_update = 1;	
-		
-	return true;
+	return write_target_flow(2, reg);
 }
 
 
@@ -593,28 +709,7 @@ bool app_write_REG_CHANNEL3_TARGET_FLOW(void *a)
 {
 	float reg = *((float*)a);
 	
-	if (reg == 0)
-		hwbp_app_pwm_gen_stop_ch3();
-	
-	if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-		if (reg > 110)
-			app_regs.REG_CHANNEL3_TARGET_FLOW = 110;
-		else
-			app_regs.REG_CHANNEL3_TARGET_FLOW = reg;
-	}
-	else{
-		if (reg > 1100)
-			app_regs.REG_CHANNEL3_TARGET_FLOW = 1100;
-		else
-			app_regs.REG_CHANNEL3_TARGET_FLOW = reg;
-	}
-	
-	app_regs.REG_CHANNELS_TARGET_FLOW[3] = app_regs.REG_CHANNEL3_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow3_update = 1;
-		
-	return true;
+	return write_target_flow(3, reg);
 }
 
 
@@ -630,21 +725,8 @@ void app_read_REG_CHANNEL4_TARGET_FLOW(void)
 bool app_write_REG_CHANNEL4_TARGET_FLOW(void *a)
 {
 	float reg = *((float*)a);
-
-	if (reg == 0)
-		hwbp_app_pwm_gen_stop_ch4();
-	
-	if (reg > 1100)
-		app_regs.REG_CHANNEL4_TARGET_FLOW = 1100;
-	else
-		app_regs.REG_CHANNEL4_TARGET_FLOW = reg;
-		
-	app_regs.REG_CHANNELS_TARGET_FLOW[4] = app_regs.REG_CHANNEL4_TARGET_FLOW;
 	
-	if(mfcs)
-		status_DC.flow4_update = 1;
-		
-	return true;
+	return write_target_flow(4, reg);
 }
 
 
@@ -662,81 +744,8 @@ bool app_write_REG_CHANNELS_TARGET_FLOW(void *a)
 {
 	float *reg = ((float*)a);
 	
-	if (reg[0] == 0)
-		hwbp_app_pwm_gen_stop_ch0();
-	
-	if (reg[0] > 110)
-		app_regs.REG_CHANNEL0_TARGET_FLOW = 110;
-	else
-		app_regs.REG_CHANNEL0_TARGET_FLOW = reg[0];
-	
-	app_regs.REG_CHANNELS_TARGET_FLOW[0] = app_regs.REG_CHANNEL0_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow0_update = 1;
-		
-	
-	if (reg[1] == 0)
-		hwbp_app_pwm_gen_stop_ch1();
-	
-	if (reg[1] > 110)
-		app_regs.REG_CHANNEL1_TARGET_FLOW = 110;
-	else
-		app_regs.REG_CHANNEL1_TARGET_FLOW = reg[1];
-		
-	app_regs.REG_CHANNELS_TARGET_FLOW[1] = app_regs.REG_CHANNEL1_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow1_update = 1;
-
-
-	if (reg[2] == 0)
-		hwbp_app_pwm_gen_stop_ch2();
-	
-	if (reg[2] > 110)
-		app_regs.REG_CHANNEL2_TARGET_FLOW = 110;
-	else
-		app_regs.REG_CHANNEL2_TARGET_FLOW = reg[2];
-	
-	app_regs.REG_CHANNELS_TARGET_FLOW[2] = app_regs.REG_CHANNEL2_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow2_update = 1;
-		
-	
-	if (reg[3] == 0)
-		hwbp_app_pwm_gen_stop_ch3();
-	
-	if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){ 
-		if (reg[3] > 110)
-			app_regs.REG_CHANNEL3_TARGET_FLOW = 110;
-		else
-			app_regs.REG_CHANNEL3_TARGET_FLOW = reg[3];
-	}
-	else{
-		if (reg[3] > 1100)
-			app_regs.REG_CHANNEL3_TARGET_FLOW = 1100;
-		else
-			app_regs.REG_CHANNEL3_TARGET_FLOW = reg[3];
-	}
-	app_regs.REG_CHANNELS_TARGET_FLOW[3] = app_regs.REG_CHANNEL3_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow3_update = 1;
-
-	
-	if (reg[4] == 0)
-		hwbp_app_pwm_gen_stop_ch4();
-	
-	if (reg[4] > 1100)
-		app_regs.REG_CHANNEL4_TARGET_FLOW = 1100;
-	else
-		app_regs.REG_CHANNEL4_TARGET_FLOW = reg[4];
-		
-	app_regs.REG_CHANNELS_TARGET_FLOW[4] = app_regs.REG_CHANNEL4_TARGET_FLOW;
-	
-	if(mfcs)
-		status_DC.flow4_update = 1;
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		write_target_flow(i, reg[i]);
 	
 	return true;
 }
@@ -845,12 +854,7 @@ bool app_write_REG_CHANNEL0_FREQUENCY(void *a)
 	uint16_t reg = *((uint16_t*)a);
 	//float reg = *((float*)a);
 	
-	if (reg < 100 || reg > 10000)
-		return false;
-
-	app_regs.REG_CHANNEL0_FREQUENCY = reg;
-	stop_and_update_ch0_temps();
-	return true;
+	return write_frequency(0, reg);
 }
 
 
@@ -868,12 +872,7 @@ bool app_write_REG_CHANNEL1_FREQUENCY(void *a)
 	uint16_t reg = *((uint16_t*)a);
 	//float reg = *((float*)a);
 	
-	if (reg < 100 || reg > 10000)
-		return false;
-
-	app_regs.REG_CHANNEL1_FREQUENCY = reg;
-	stop_and_update_ch1_temps();
-	return true;
+	return write_frequency(1, reg);
 }
 
 
@@ -891,12 +890,7 @@ bool app_write_REG_CHANNEL2_FREQUENCY(void *a)
 	uint16_t reg = *((uint16_t*)a);
 	//float reg = *((float*)a);
 	
-	if (reg < 100 || reg > 10000)
-		return false;
-
-	app_regs.REG_CHANNEL2_FREQUENCY = reg;
-	stop_and_update_ch2_temps();
-	return true;
+	return write_frequency(2, reg);
 }
 
 
@@ -914,12 +908,7 @@ bool app_write_REG_CHANNEL3_FREQUENCY(void *a)
 	uint16_t reg = *((uint16_t*)a);
 	//float reg = *((float*)a);
 	
-	if (reg < 100 || reg > 10000)
-		return false;
-
-	app_regs.REG_CHANNEL3_FREQUENCY = reg;
-	stop_and_update_ch3_temps();
-	return true;
+	return write_frequency(3, reg);
 }
 
 
@@ -937,12 +926,7 @@ bool app_write_REG_CHANNEL4_FREQUENCY(void *a)
 	uint16_t reg = *((uint16_t*)a);
 	//float reg = *((float*)a);
 	
-	if (reg < 100 || reg > 10000)
-		return false;
-
-	app_regs.REG_CHANNEL4_FREQUENCY = reg;
-	stop_and_update_ch4_temps();
-	return true;
+	return write_frequency(4, reg);
 }
 
 /************************************************************************/
@@ -957,20 +941,8 @@ void app_read_REG_CHANNEL0_DUTY_CYCLE(void)
 bool app_write_REG_CHANNEL0_DUTY_CYCLE(void *a)
 {
 	float reg = *((float*)a);
-	status_DC.DC0_ready = 1;
-		
-	if (reg <= 0.1 || reg >= 99.9)
-		return false;
-
-	app_regs.REG_CHANNEL0_DUTY_CYCLE = reg;
-	
-	if (app_regs.REG_ENABLE_FLOW & B_START){
-		if (!TCC0_CTRLA){
-			hwbp_app_pwm_gen_start_ch0();
-		}
-	}
 	
-	return true;
+	return write_duty_cycle(0, reg);
 }
 
 
@@ -986,20 +958,8 @@ void app_read_REG_CHANNEL1_DUTY_CYCLE(void)
 bool app_write_REG_CHANNEL1_DUTY_CYCLE(void *a)
 {
 	float reg = *((float*)a);
-	status_DC.DC1_ready = 1;
-	
-	if (reg <= 0.1 || reg >= 99.9)
-		return false;
-
-	app_regs.REG_CHANNEL1_DUTY_CYCLE = reg;
-	
-	if (app_regs.REG_ENABLE_FLOW & B_START){
-		if (!TCD0_CTRLA){
-			hwbp_app_pwm_gen_start_ch1();
-		}
-	}
 	
-	return true;
+	return write_duty_cycle(1, reg);
 }
 
 
@@ -1015,20 +975,8 @@ void app_read_REG_CHANNEL2_DUTY_CYCLE(void)
 bool app_write_REG_CHANNEL2_DUTY_CYCLE(void *a)
 {
 	float reg = *((float*)a);
-	status_DC.DC2_ready = 1;
-	
-	if (reg <= 0.1 || reg >= 99.9)
-		return false;
-
-	app_regs.REG_CHANNEL2_DUTY_CYCLE = reg;
 	
-	if (app_regs.REG_ENABLE_FLOW & B_START){
-		if (!TCE0_CTRLA){
-			hwbp_app_pwm_gen_start_ch2();
-		}
-	}
-
-	return true;
+	return write_duty_cycle(2, reg);
 }
 
 
@@ -1044,20 +992,8 @@ void app_read_REG_CHANNEL3_DUTY_CYCLE(void)
 bool app_write_REG_CHANNEL3_DUTY_CYCLE(void *a)
 {
 	float reg = *((float*)a);
-	status_DC.DC3_ready = 1;
-
-	if (reg <= 0.1 || reg >= 99.9)
-		return false;
-
-	app_regs.REG_CHANNEL3_DUTY_CYCLE = reg;
 	
-	if (app_regs.REG_ENABLE_FLOW & B_START){
-		if (!TCF0_CTRLA){
-			hwbp_app_pwm_gen_start_ch3();
-		}
-	}
-
-	return true;
+	return write_duty_cycle(3, reg);
 }
 
 
@@ -1073,20 +1009,8 @@ void app_read_REG_CHANNEL4_DUTY_CYCLE(void)
 bool app_write_REG_CHANNEL4_DUTY_CYCLE(void *a)
 {
 	float reg = *((float*)a);
-	status_DC.DC4_ready = 1; 
-
-	if (reg <= 0.1 || reg >= 99.9)
-		return false;
-
-	app_regs.REG_CHANNEL4_DUTY_CYCLE = reg;
 	
-	if (app_regs.REG_ENABLE_FLOW & B_START){
-		if (!TCD1_CTRLA){
-			hwbp_app_pwm_gen_start_ch4();
-		}
-	}
-
-	return true;
+	return write_duty_cycle(4, reg);
 }
 
 
@@ -1132,7 +1056,7 @@ bool app_write_REG_OUTPUT_CLEAR(void *a)
 	if((app_regs.REG_DO0_SYNC & MSK_DOUT0_CONF) == GM_DOUT0_SOFTWARE)
 		if (reg & B_DOUT0) clr_OUT0;
 	
-	if((app_regs.REG_DO0_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_SOFTWARE)
+	if((app_regs.REG_DO1_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_SOFTWARE)
 		if (reg & B_DOUT1) clr_OUT1;
 	
 	app_regs.REG_OUTPUT_STATE &= ~reg;
@@ -1158,7 +1082,7 @@ bool app_write_REG_OUTPUT_TOGGLE(void *a)
 	if((app_regs.REG_DO0_SYNC & MSK_DOUT0_CONF) == GM_DOUT0_SOFTWARE)
 		if (reg & B_DOUT0) { if (read_OUT0) tgl_OUT0; else set_OUT0;}
 		
-	if((app_regs.REG_DO0_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_SOFTWARE)
+	if((app_regs.REG_DO1_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_SOFTWARE)
 		if (reg & B_DOUT1) { if (read_OUT1) tgl_OUT1; else set_OUT1;}
 
 	app_regs.REG_OUTPUT_STATE ^= reg;
@@ -1186,7 +1110,7 @@ bool app_write_REG_OUTPUT_STATE(void *a)
 	if((app_regs.REG_DO0_SYNC & MSK_DOUT0_CONF) == GM_DOUT0_SOFTWARE){
 		if (reg & B_DOUT0) set_OUT0; else clr_OUT0;}
 	
-	if((app_regs.REG_DO0_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_SOFTWARE){
+	if((app_regs.REG_DO1_SYNC & MSK_DOUT1_CONF) == GM_DOUT1_SOFTWARE){
 		if (reg & B_DOUT1) set_OUT1; else clr_OUT1;}
 	
 	app_regs.REG_OUTPUT_STATE = reg;
@@ -1224,19 +1148,12 @@ void app_read_REG_VALVES_SET(void)
 bool app_write_REG_VALVES_SET(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
-				
-	if (reg & B_VALVE0) start_VALVE0;
-	if (reg & B_VALVE1) start_VALVE1;
-	if (reg & B_VALVE2) start_VALVE2;
-	if (reg & B_VALVE3) start_VALVE3;
-	if (reg & B_ENDVALVE0) start_VALVEAUX0;
-	if (reg & B_ENDVALVE1) start_VALVEAUX1;
-	if (reg & B_DUMMYVALVE) start_VALVEDUMMY;
-	
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0) && (reg & B_CHECK_VALVE0)) start_VALVE0CHK;
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1) && (reg & B_CHECK_VALVE1)) start_VALVE1CHK;
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2) && (reg & B_CHECK_VALVE2)) start_VALVE2CHK;
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3) && (reg & B_CHECK_VALVE3)) start_VALVE3CHK;
+	
+	/* Check valves in sync mode are driven by their odor valve */
+	reg &= ~(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & MSK_CHECK_VALVES);
+	
+	write_valves(reg, 0);
+	arm_valves_countdown(reg, 0);
 	
 	app_regs.REG_CHECK_VALVES_STATE |= reg;
 	app_regs.REG_VALVES_STATE |= reg;
@@ -1262,19 +1179,11 @@ void app_read_REG_VALVES_CLEAR(void)
 bool app_write_REG_VALVES_CLEAR(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
-
-	if (reg & B_VALVE0) stop_VALVE0;
-	if (reg & B_VALVE1) stop_VALVE1;
-	if (reg & B_VALVE2) stop_VALVE2;
-	if (reg & B_VALVE3) stop_VALVE3;
-	if (reg & B_ENDVALVE0) clr_ENDVALVE0;
-	if (reg & B_ENDVALVE1) clr_ENDVALVE1;
-	if (reg & B_DUMMYVALVE) clr_DUMMYVALVE;
 	
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0) && (reg & B_CHECK_VALVE0)) clr_VALVE0CHK;
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1) && (reg & B_CHECK_VALVE1)) clr_VALVE1CHK;
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2) && (reg & B_CHECK_VALVE2)) clr_VALVE2CHK;
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3) && (reg & B_CHECK_VALVE3)) clr_VALVE3CHK;
+	reg &= ~(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & MSK_CHECK_VALVES);
+	
+	write_valves(0, reg);
+	arm_valves_countdown(0, reg);
 	
 	app_regs.REG_CHECK_VALVES_STATE &= ~reg;
 	app_regs.REG_VALVES_STATE &= ~reg;
@@ -1300,20 +1209,12 @@ void app_read_REG_VALVES_TOGGLE(void)
 bool app_write_REG_VALVES_TOGGLE(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
+	uint16_t valves = read_valves();
 	
-	if (reg & B_VALVE0) { if (read_VALVE0) stop_VALVE0; else start_VALVE0;}
-	if (reg & B_VALVE1) { if (read_VALVE1) stop_VALVE1; else start_VALVE1;}
-	if (reg & B_VALVE2) { if (read_VALVE2) stop_VALVE2; else start_VALVE2;}
-	if (reg & B_VALVE3) { if (read_VALVE3) stop_VALVE3; else start_VALVE3;}
-
-	if (reg & B_ENDVALVE0) { if (read_ENDVALVE0) tgl_ENDVALVE0; else start_VALVEAUX0;}
-	if (reg & B_ENDVALVE1) { if (read_ENDVALVE1) tgl_ENDVALVE1; else start_VALVEAUX1;}
-	if (reg & B_DUMMYVALVE) { if (read_DUMMYVALVE) tgl_DUMMYVALVE; else start_VALVEDUMMY;}
-		
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0) && (reg & B_CHECK_VALVE0)) {if (read_VALVE0CHK) tgl_VALVE0CHK; else start_VALVE0CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1) && (reg & B_CHECK_VALVE1)) {if (read_VALVE1CHK) tgl_VALVE1CHK; else start_VALVE1CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2) && (reg & B_CHECK_VALVE2)) {if (read_VALVE2CHK) tgl_VALVE2CHK; else start_VALVE2CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3) && (reg & B_CHECK_VALVE3)) {if (read_VALVE3CHK) tgl_VALVE3CHK; else start_VALVE3CHK;}
+	reg &= ~(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & MSK_CHECK_VALVES);
+	
+	write_valves(reg & ~valves, reg & valves);
+	arm_valves_countdown(reg & ~valves, reg & valves);
 			
 	app_regs.REG_CHECK_VALVES_STATE ^= reg;
 	app_regs.REG_VALVES_STATE ^= reg;
@@ -1352,19 +1253,10 @@ void app_read_REG_VALVES_STATE(void)
 bool app_write_REG_VALVES_STATE(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
+	uint16_t mask = MSK_VALVES & ~(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & MSK_CHECK_VALVES);
 	
-	if (reg & B_VALVE0) start_VALVE0; else stop_VALVE0;
-	if (reg & B_VALVE1) start_VALVE1; else stop_VALVE1;
-	if (reg & B_VALVE2) start_VALVE2; else stop_VALVE2;
-	if (reg & B_VALVE3) start_VALVE3; else stop_VALVE3;
-	if (reg & B_ENDVALVE0) start_VALVEAUX0; else clr_ENDVALVE0;
-	if (reg & B_ENDVALVE1) start_VALVEAUX1; else clr_ENDVALVE1;
-	if (reg & B_DUMMYVALVE) start_VALVEDUMMY; else clr_DUMMYVALVE;
-
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0)) {if (reg & B_CHECK_VALVE0) start_VALVE0CHK; else clr_VALVE0CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1)) {if (reg & B_CHECK_VALVE1) start_VALVE1CHK; else clr_VALVE1CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2)) {if (reg & B_CHECK_VALVE2) start_VALVE2CHK; else clr_VALVE2CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3)) {if (reg & B_CHECK_VALVE3) start_VALVE3CHK; else clr_VALVE3CHK;}
+	write_valves(reg & mask, ~reg & mask);
+	arm_valves_countdown(reg & mask, ~reg & mask);
 		
 	app_regs.REG_VALVES_STATE = reg;
 	return true;
@@ -1388,11 +1280,10 @@ void app_read_REG_CHECK_VALVES_STATE(void)
 bool app_write_REG_CHECK_VALVES_STATE(void *a)
 {
 	uint16_t reg = *((uint16_t*)a);
+	uint16_t mask = MSK_CHECK_VALVES & ~app_regs.REG_ENABLE_CHECK_VALVES_SYNC;
 	
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0)) {if (reg & B_CHECK_VALVE0) start_VALVE0CHK; else clr_VALVE0CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1)) {if (reg & B_CHECK_VALVE1) start_VALVE1CHK; else clr_VALVE1CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2)) {if (reg & B_CHECK_VALVE2) start_VALVE2CHK; else clr_VALVE2CHK;}
-	if(!(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3)) {if (reg & B_CHECK_VALVE3) start_VALVE3CHK; else clr_VALVE3CHK;}
+	write_valves(reg & mask, ~reg & mask);
+	arm_valves_countdown(reg & mask, ~reg & mask);
 		
 	app_regs.REG_CHECK_VALVES_STATE = reg;
 	return true;
@@ -1416,33 +1307,8 @@ bool app_write_REG_ODOR_VALVES_STATE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
-	if (reg & B_VALVE0){ 
-		start_VALVE0; 
-	} 
-	else{
-		stop_VALVE0;
-	}
-		
-	if (reg & B_VALVE1){
-		start_VALVE1;
-	}
-	else{ 
-		stop_VALVE1;
-	}
-		
-	if (reg & B_VALVE2){
-		start_VALVE2;
-	}
-	else{ 
-		stop_VALVE2;
-	}
-	
-	if (reg & B_VALVE3){ 
-		start_VALVE3;
-	}
-	else{	
-		stop_VALVE3;
-	}
+	write_valves(reg & MSK_ODOR_VALVES, ~reg & MSK_ODOR_VALVES);
+	arm_valves_countdown(reg & MSK_ODOR_VALVES, ~reg & MSK_ODOR_VALVES);
 		
 	app_regs.REG_ODOR_VALVES_STATE = reg;
 	return true;
@@ -1466,9 +1332,8 @@ bool app_write_REG_END_VALVES_STATE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
-	if (reg & B_ENDVALVE0) start_VALVEAUX0; else clr_ENDVALVE0;
-	if (reg & B_ENDVALVE1) start_VALVEAUX1; else clr_ENDVALVE1;
-	if (reg & B_DUMMYVALVE) start_VALVEDUMMY; else clr_DUMMYVALVE;
+	write_valves(reg & MSK_END_VALVES, ~reg & MSK_END_VALVES);
+	arm_valves_countdown(reg & MSK_END_VALVES, ~reg & MSK_END_VALVES);
 
 	app_regs.REG_END_VALVES_STATE = reg;
 	return true;
@@ -1703,6 +1568,17 @@ void app_read_REG_DO0_SYNC(void)
 bool app_write_REG_DO0_SYNC(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_DOUT0_FLOW4_SETTLED || (reg > GM_DOUT0_SEQUENCE_PULSE && reg < GM_DOUT0_FLOW0_SETTLED))
+		return false;
+	
+	/* Start from a known level, the firmware drives the output from now on */
+	if (reg == GM_DOUT0_START)
+	{
+		if (app_regs.REG_ENABLE_FLOW & B_START) set_OUT0; else clr_OUT0;
+	}
+	else if (reg != GM_DOUT0_SOFTWARE)
+		clr_OUT0;
 
 	app_regs.REG_DO0_SYNC = reg;
 	return true;
@@ -1721,6 +1597,17 @@ void app_read_REG_DO1_SYNC(void)
 bool app_write_REG_DO1_SYNC(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_DOUT1_FLOW4_SETTLED || (reg > GM_DOUT1_SEQUENCE_PULSE && reg < GM_DOUT1_FLOW0_SETTLED))
+		return false;
+	
+	/* Start from a known level, the firmware drives the output from now on */
+	if (reg == GM_DOUT1_START)
+	{
+		if (app_regs.REG_ENABLE_FLOW & B_START) set_OUT1; else clr_OUT1;
+	}
+	else if (reg != GM_DOUT1_SOFTWARE)
+		clr_OUT1;
 
 	app_regs.REG_DO1_SYNC = reg;
 	return true;
@@ -1757,6 +1644,11 @@ void app_read_REG_MIMIC_ODOR_VALVE0(void)
 bool app_write_REG_MIMIC_ODOR_VALVE0(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(0, reg);
 
 	app_regs.REG_MIMIC_ODOR_VALVE0 = reg;
 	return true;
@@ -1775,6 +1667,11 @@ void app_read_REG_MIMIC_ODOR_VALVE1(void)
 bool app_write_REG_MIMIC_ODOR_VALVE1(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(1, reg);
 
 	app_regs.REG_MIMIC_ODOR_VALVE1 = reg;
 	return true;
@@ -1793,6 +1690,11 @@ void app_read_REG_MIMIC_ODOR_VALVE2(void)
 bool app_write_REG_MIMIC_ODOR_VALVE2(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(2, reg);
 
 	app_regs.REG_MIMIC_ODOR_VALVE2 = reg;
 	return true;
@@ -1811,6 +1713,11 @@ void app_read_REG_MIMIC_ODOR_VALVE3(void)
 bool app_write_REG_MIMIC_ODOR_VALVE3(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(3, reg);
 
 	app_regs.REG_MIMIC_ODOR_VALVE3 = reg;
 	return true;
@@ -1828,6 +1735,11 @@ void app_read_REG_MIMIC_CHECK_VALVE0(void)
 bool app_write_REG_MIMIC_CHECK_VALVE0(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(8, reg);
 
 	app_regs.REG_MIMIC_CHECK_VALVE0 = reg;
 	return true;
@@ -1846,6 +1758,11 @@ void app_read_REG_MIMIC_CHECK_VALVE1(void)
 bool app_write_REG_MIMIC_CHECK_VALVE1(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(9, reg);
 
 	app_regs.REG_MIMIC_CHECK_VALVE1 = reg;
 	return true;
@@ -1864,6 +1781,11 @@ void app_read_REG_MIMIC_CHECK_VALVE2(void)
 bool app_write_REG_MIMIC_CHECK_VALVE2(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(10, reg);
 
 	app_regs.REG_MIMIC_CHECK_VALVE2 = reg;
 	return true;
@@ -1882,6 +1804,11 @@ void app_read_REG_MIMIC_CHECK_VALVE3(void)
 bool app_write_REG_MIMIC_CHECK_VALVE3(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(11, reg);
 
 	app_regs.REG_MIMIC_CHECK_VALVE3 = reg;
 	return true;
@@ -1900,6 +1827,11 @@ void app_read_REG_MIMIC_END_VALVE0(void)
 bool app_write_REG_MIMIC_END_VALVE0(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(4, reg);
 
 	app_regs.REG_MIMIC_END_VALVE0 = reg;
 	return true;
@@ -1918,6 +1850,11 @@ void app_read_REG_MIMIC_END_VALVE1(void)
 bool app_write_REG_MIMIC_END_VALVE1(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(5, reg);
 
 	app_regs.REG_MIMIC_END_VALVE1 = reg;
 	return true;
@@ -1936,6 +1873,11 @@ void app_read_REG_MIMIC_DUMMY_VALVE(void)
 bool app_write_REG_MIMIC_DUMMY_VALVE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_MIMIC)
+		return false;
+	
+	update_valve_mimic(6, reg);
 
 	app_regs.REG_MIMIC_DUMMY_VALVE = reg;
 	return true;
@@ -1953,6 +1895,14 @@ void app_read_REG_ENABLE_VALVE_EXT_CTRL(void)
 bool app_write_REG_ENABLE_VALVE_EXT_CTRL(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	/* The first input change after enabling applies the state of all inputs */
+	if (reg == B_EXT_CTRL_ENABLED && app_regs.REG_ENABLE_VALVE_EXT_CTRL != B_EXT_CTRL_ENABLED)
+	{
+		aux_isolation = 0;
+		aux_end = 0;
+		aux_check = 0;
+	}
 
 	app_regs.REG_ENABLE_VALVE_EXT_CTRL = reg;
 	return true;
@@ -1971,18 +1921,15 @@ void app_read_REG_CHANNEL3_RANGE(void)
 bool app_write_REG_CHANNEL3_RANGE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_FLOW_AUTO)
+		return false;
 
 	app_regs.REG_CHANNEL3_RANGE = reg;
+	update_channel3_range();
 	
-	float reg_ch3_target_flow = app_regs.REG_CHANNEL3_TARGET_FLOW;
-	
-	if((app_regs.REG_CHANNEL3_RANGE & MSK_CHANNEL3_RANGE_CONFIG) == GM_FLOW_100){
-		if (reg_ch3_target_flow > 110){
-			reg_ch3_target_flow = 110;
-		}
-	}
-	
-	app_write_REG_CHANNEL3_TARGET_FLOW(&reg_ch3_target_flow);
+	/* Clamps the target to the new range */
+	write_target_flow(3, app_regs.REG_CHANNEL3_TARGET_FLOW);
 	
 	init_calibration_values();
 		
@@ -2076,4 +2023,1123 @@ bool app_write_REG_ENABLE_EVENTS(void *a)
 
 	app_regs.REG_ENABLE_EVENTS = reg;
 	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVES_EVENT                                                     */
+/************************************************************************/
+void app_read_REG_VALVES_EVENT(void)
+{
+	//app_regs.REG_VALVES_EVENT[0] = 0;
+
+}
+
+bool app_write_REG_VALVES_EVENT(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_VALVE0_TRAIN                                                     */
+/************************************************************************/
+void app_read_REG_VALVE0_TRAIN(void)
+{
+	//app_regs.REG_VALVE0_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_VALVE0_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_VALVE0_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_VALVE0_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_VALVE0_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_VALVE0_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVE1_TRAIN                                                     */
+/************************************************************************/
+void app_read_REG_VALVE1_TRAIN(void)
+{
+	//app_regs.REG_VALVE1_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_VALVE1_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_VALVE1_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_VALVE1_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_VALVE1_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_VALVE1_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVE2_TRAIN                                                     */
+/************************************************************************/
+void app_read_REG_VALVE2_TRAIN(void)
+{
+	//app_regs.REG_VALVE2_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_VALVE2_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_VALVE2_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_VALVE2_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_VALVE2_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_VALVE2_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVE3_TRAIN                                                     */
+/************************************************************************/
+void app_read_REG_VALVE3_TRAIN(void)
+{
+	//app_regs.REG_VALVE3_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_VALVE3_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_VALVE3_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_VALVE3_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_VALVE3_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_VALVE3_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_END_VALVE0_TRAIN                                                 */
+/************************************************************************/
+void app_read_REG_END_VALVE0_TRAIN(void)
+{
+	//app_regs.REG_END_VALVE0_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_END_VALVE0_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_END_VALVE0_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_END_VALVE0_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_END_VALVE0_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_END_VALVE0_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_END_VALVE1_TRAIN                                                 */
+/************************************************************************/
+void app_read_REG_END_VALVE1_TRAIN(void)
+{
+	//app_regs.REG_END_VALVE1_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_END_VALVE1_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_END_VALVE1_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_END_VALVE1_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_END_VALVE1_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_END_VALVE1_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DUMMY_VALVE_TRAIN                                                */
+/************************************************************************/
+void app_read_REG_DUMMY_VALVE_TRAIN(void)
+{
+	//app_regs.REG_DUMMY_VALVE_TRAIN[0] = 0;
+
+}
+
+bool app_write_REG_DUMMY_VALVE_TRAIN(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[TRAIN_ON] < 1 || reg[TRAIN_OFF] < 1)
+		return false;
+
+	app_regs.REG_DUMMY_VALVE_TRAIN[TRAIN_DELAY] = reg[TRAIN_DELAY];
+	app_regs.REG_DUMMY_VALVE_TRAIN[TRAIN_ON] = reg[TRAIN_ON];
+	app_regs.REG_DUMMY_VALVE_TRAIN[TRAIN_OFF] = reg[TRAIN_OFF];
+	app_regs.REG_DUMMY_VALVE_TRAIN[TRAIN_PULSES] = reg[TRAIN_PULSES];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVES_TRAIN_START                                               */
+/************************************************************************/
+void app_read_REG_VALVES_TRAIN_START(void)
+{
+	//app_regs.REG_VALVES_TRAIN_START = 0;
+
+}
+
+bool app_write_REG_VALVES_TRAIN_START(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg & ~(MSK_ODOR_VALVES | MSK_END_VALVES))
+		return false;
+	
+	start_valves_train(reg);
+
+	app_regs.REG_VALVES_TRAIN_START = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVES_TRAIN_STOP                                                */
+/************************************************************************/
+void app_read_REG_VALVES_TRAIN_STOP(void)
+{
+	//app_regs.REG_VALVES_TRAIN_STOP = 0;
+
+}
+
+bool app_write_REG_VALVES_TRAIN_STOP(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg & ~(MSK_ODOR_VALVES | MSK_END_VALVES))
+		return false;
+	
+	stop_valves_train(reg);
+
+	app_regs.REG_VALVES_TRAIN_STOP = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_VALVES_TRAIN_DONE                                                */
+/************************************************************************/
+void app_read_REG_VALVES_TRAIN_DONE(void)
+{
+	//app_regs.REG_VALVES_TRAIN_DONE = 0;
+
+}
+
+bool app_write_REG_VALVES_TRAIN_DONE(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_CONTROL                                                 */
+/************************************************************************/
+void app_read_REG_SEQUENCE_CONTROL(void)
+{
+	//app_regs.REG_SEQUENCE_CONTROL = 0;
+
+}
+
+/* The steps are run in table order, so their times must not decrease */
+static bool sequence_in_order(void)
+{
+	for (uint8_t i = 1; i < app_regs.REG_SEQUENCE_LENGTH; i++)
+		if (sequence_steps[i].time < sequence_steps[i - 1].time)
+			return false;
+	
+	return true;
+}
+
+/* A channel a step sets to no flow never settles */
+static bool sequence_settles(void)
+{
+	for (uint8_t i = 0; i < app_regs.REG_SEQUENCE_LENGTH; i++)
+		for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+			if ((sequence_steps[i].settle & (1 << channel)) && sequence_steps[i].flows[channel] == 0)
+				return false;
+	
+	return true;
+}
+
+bool app_write_REG_SEQUENCE_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg != GM_SEQUENCE_IDLE && (!sequence_in_order() || !sequence_settles()))
+		return false;
+	
+	switch (reg)
+	{
+		case GM_SEQUENCE_IDLE:
+			stop_sequence();
+			break;
+		case GM_SEQUENCE_ARMED:
+			if (app_regs.REG_SEQUENCE_LENGTH == 0 || app_regs.REG_SEQUENCE_CONTROL == GM_SEQUENCE_RUNNING)
+				return false;
+			app_regs.REG_SEQUENCE_CONTROL = GM_SEQUENCE_ARMED;
+			break;
+		case GM_SEQUENCE_RUNNING:
+			if (app_regs.REG_SEQUENCE_LENGTH == 0)
+				return false;
+			start_sequence();
+			break;
+		default:
+			return false;
+	}
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_LENGTH                                                  */
+/************************************************************************/
+void app_read_REG_SEQUENCE_LENGTH(void)
+{
+	//app_regs.REG_SEQUENCE_LENGTH = 0;
+
+}
+
+bool app_write_REG_SEQUENCE_LENGTH(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > SEQUENCE_MAX_STEPS || app_regs.REG_SEQUENCE_CONTROL == GM_SEQUENCE_RUNNING)
+		return false;
+
+	app_regs.REG_SEQUENCE_LENGTH = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_STEP_INDEX                                              */
+/************************************************************************/
+void app_read_REG_SEQUENCE_STEP_INDEX(void)
+{
+	//app_regs.REG_SEQUENCE_STEP_INDEX = 0;
+
+}
+
+bool app_write_REG_SEQUENCE_STEP_INDEX(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg >= SEQUENCE_MAX_STEPS)
+		return false;
+
+	app_regs.REG_SEQUENCE_STEP_INDEX = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_STEP                                                    */
+/************************************************************************/
+void app_read_REG_SEQUENCE_STEP(void)
+{
+	sequence_step_t *step = &sequence_steps[app_regs.REG_SEQUENCE_STEP_INDEX];
+	
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_TIME] = step->time;
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_VALVES] = step->valves;
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_OUTPUTS] = step->outputs;
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_SETTLE] = step->settle;
+}
+
+bool app_write_REG_SEQUENCE_STEP(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	sequence_step_t *step = &sequence_steps[app_regs.REG_SEQUENCE_STEP_INDEX];
+	
+	if ((reg[SEQUENCE_VALVES] & ~MSK_VALVES) || (reg[SEQUENCE_OUTPUTS] & ~(B_DOUT0 | B_DOUT1)) || (reg[SEQUENCE_SETTLE] & ~MSK_FLOW_CHANNELS))
+		return false;
+	
+	if (app_regs.REG_SEQUENCE_CONTROL == GM_SEQUENCE_RUNNING)
+		return false;
+	
+	/* Written from the first step, each one no earlier than the one before */
+	if (app_regs.REG_SEQUENCE_STEP_INDEX > 0 && reg[SEQUENCE_TIME] < sequence_steps[app_regs.REG_SEQUENCE_STEP_INDEX - 1].time)
+		return false;
+	
+	step->time = reg[SEQUENCE_TIME];
+	step->valves = reg[SEQUENCE_VALVES];
+	step->outputs = reg[SEQUENCE_OUTPUTS];
+	step->settle = reg[SEQUENCE_SETTLE];
+
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_TIME] = reg[SEQUENCE_TIME];
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_VALVES] = reg[SEQUENCE_VALVES];
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_OUTPUTS] = reg[SEQUENCE_OUTPUTS];
+	app_regs.REG_SEQUENCE_STEP[SEQUENCE_SETTLE] = reg[SEQUENCE_SETTLE];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_STEP_FLOWS                                              */
+/************************************************************************/
+void app_read_REG_SEQUENCE_STEP_FLOWS(void)
+{
+	sequence_step_t *step = &sequence_steps[app_regs.REG_SEQUENCE_STEP_INDEX];
+	
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_SEQUENCE_STEP_FLOWS[i] = step->flows[i];
+}
+
+bool app_write_REG_SEQUENCE_STEP_FLOWS(void *a)
+{
+	float *reg = ((float*)a);
+	sequence_step_t *step = &sequence_steps[app_regs.REG_SEQUENCE_STEP_INDEX];
+	
+	if (app_regs.REG_SEQUENCE_CONTROL == GM_SEQUENCE_RUNNING)
+		return false;
+	
+	for (uint8_t i = 0; i < 5; i++)
+	{
+		step->flows[i] = reg[i];
+		app_regs.REG_SEQUENCE_STEP_FLOWS[i] = reg[i];
+	}
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_DI0_DEBOUNCE                                                     */
+/************************************************************************/
+void app_read_REG_DI0_DEBOUNCE(void)
+{
+	//app_regs.REG_DI0_DEBOUNCE = 0;
+
+}
+
+bool app_write_REG_DI0_DEBOUNCE(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_DI0_DEBOUNCE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FLOW_SETTLE_TOLERANCE                                            */
+/************************************************************************/
+void app_read_REG_FLOW_SETTLE_TOLERANCE(void)
+{
+	//app_regs.REG_FLOW_SETTLE_TOLERANCE = 0;
+
+}
+
+bool app_write_REG_FLOW_SETTLE_TOLERANCE(void *a)
+{
+	float reg = *((float*)a);
+	
+	if (!(reg >= 0.1 && reg <= 100))
+		return false;
+
+	app_regs.REG_FLOW_SETTLE_TOLERANCE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FLOW_SETTLE_DWELL                                                */
+/************************************************************************/
+void app_read_REG_FLOW_SETTLE_DWELL(void)
+{
+	//app_regs.REG_FLOW_SETTLE_DWELL = 0;
+
+}
+
+bool app_write_REG_FLOW_SETTLE_DWELL(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+
+	app_regs.REG_FLOW_SETTLE_DWELL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_FLOW_SETTLED                                                     */
+/************************************************************************/
+void app_read_REG_FLOW_SETTLED(void)
+{
+	//app_regs.REG_FLOW_SETTLED = 0;
+
+}
+
+bool app_write_REG_FLOW_SETTLED(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_FLOW_SETTLE_TIME                                                 */
+/************************************************************************/
+void app_read_REG_FLOW_SETTLE_TIME(void)
+{
+	//app_regs.REG_FLOW_SETTLE_TIME[0] = 0;
+
+}
+
+bool app_write_REG_FLOW_SETTLE_TIME(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_PWM_DITHER                                                       */
+/************************************************************************/
+void app_read_REG_PWM_DITHER(void)
+{
+	//app_regs.REG_PWM_DITHER = 0;
+
+}
+
+bool app_write_REG_PWM_DITHER(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_FLOW_CHANNELS)
+		return false;
+
+	app_regs.REG_PWM_DITHER = reg;
+	hwbp_app_pwm_gen_update_dither();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PWM_PHASE                                                        */
+/************************************************************************/
+void app_read_REG_PWM_PHASE(void)
+{
+	//app_regs.REG_PWM_PHASE[0] = 0;
+
+}
+
+bool app_write_REG_PWM_PHASE(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+	
+	for (uint8_t i = 0; i < 5; i++)
+		if (reg[i] > 99)
+			return false;
+
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_PWM_PHASE[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNELS_ENABLE                                                  */
+/************************************************************************/
+void app_read_REG_CHANNELS_ENABLE(void)
+{
+	//app_regs.REG_CHANNELS_ENABLE = 0;
+
+}
+
+bool app_write_REG_CHANNELS_ENABLE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	uint8_t changed = reg ^ app_regs.REG_CHANNELS_ENABLE;
+	
+	if (reg & ~MSK_FLOW_CHANNELS)
+		return false;
+	
+	app_regs.REG_CHANNELS_ENABLE = reg;
+	
+	/* Only the channels that changed are touched, the others keep running */
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+	{
+		if (!(changed & (1 << i)))
+			continue;
+		
+		if (!(reg & (1 << i)))
+			hwbp_app_pwm_gen_stop(i);
+		else if ((app_regs.REG_ENABLE_FLOW & B_START) && *flow_channels[i].target_flow != 0)
+			hwbp_app_pwm_gen_start(i);
+	}
+	
+	restart_flow_settle(changed);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNELS_ENABLE_EVENTS                                           */
+/************************************************************************/
+void app_read_REG_CHANNELS_ENABLE_EVENTS(void)
+{
+	//app_regs.REG_CHANNELS_ENABLE_EVENTS = 0;
+
+}
+
+bool app_write_REG_CHANNELS_ENABLE_EVENTS(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_FLOW_CHANNELS)
+		return false;
+
+	app_regs.REG_CHANNELS_ENABLE_EVENTS = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_WARM_START                                                       */
+/************************************************************************/
+void app_read_REG_WARM_START(void)
+{
+	//app_regs.REG_WARM_START = 0;
+
+}
+
+bool app_write_REG_WARM_START(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_WARM_START | B_WARM_START_EEPROM | B_WARM_START_CLEAR))
+		return false;
+	
+	app_regs.REG_WARM_START = reg & ~B_WARM_START_CLEAR;
+	
+	if (reg & B_WARM_START_CLEAR)
+		clear_warm_start();
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_PROFILE                                              */
+/************************************************************************/
+void app_read_REG_CALIBRATION_PROFILE(void)
+{
+	//app_regs.REG_CALIBRATION_PROFILE[0] = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_PROFILE(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+	
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
+		if (reg[i] > CALIBRATION_PROFILES)
+			return false;
+	
+	return select_calibration_profiles(reg);
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_PROFILE_NAME                                         */
+/************************************************************************/
+void app_read_REG_CALIBRATION_PROFILE_NAME(void)
+{
+	//app_regs.REG_CALIBRATION_PROFILE_NAME[0] = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_PROFILE_NAME(void *a)
+{
+	uint8_t *reg = ((uint8_t*)a);
+	
+	for (uint8_t i = 0; i < CALIBRATION_PROFILE_NAME_SIZE; i++)
+		app_regs.REG_CALIBRATION_PROFILE_NAME[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_PROFILE_SAVE                                         */
+/************************************************************************/
+void app_read_REG_CALIBRATION_PROFILE_SAVE(void)
+{
+	//app_regs.REG_CALIBRATION_PROFILE_SAVE = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_PROFILE_SAVE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	uint8_t channel = reg & MSK_PROFILE_CHANNEL;
+	uint8_t slot = (reg & MSK_PROFILE_SLOT) >> 4;
+	
+	if ((reg & ~(MSK_PROFILE_CHANNEL | MSK_PROFILE_SLOT)) || channel >= FLOW_CHANNELS || slot == 0)
+		return false;
+	
+	/* Refused while the previous profile is still being written */
+	if (!save_calibration_profile(channel, slot))
+		return false;
+	
+	app_regs.REG_CALIBRATION_PROFILE_SAVE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_CURVE                                                */
+/************************************************************************/
+void app_read_REG_CALIBRATION_CURVE(void)
+{
+	//app_regs.REG_CALIBRATION_CURVE[0] = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_CURVE(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (!compile_calibration_curve(reg))
+		return false;
+	
+	for (uint8_t i = 0; i < CALIBRATION_CURVE_SIZE; i++)
+		app_regs.REG_CALIBRATION_CURVE[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_SWEEP                                                */
+/************************************************************************/
+void app_read_REG_CALIBRATION_SWEEP(void)
+{
+	//app_regs.REG_CALIBRATION_SWEEP = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_SWEEP(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(MSK_SWEEP_CHANNEL | B_SWEEP_RUN))
+		return false;
+	
+	if (!(reg & B_SWEEP_RUN))
+	{
+		stop_calibration_sweep();
+		return true;
+	}
+	
+	return start_calibration_sweep(reg & MSK_SWEEP_CHANNEL);
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_SWEEP_CONFIG                                         */
+/************************************************************************/
+void app_read_REG_CALIBRATION_SWEEP_CONFIG(void)
+{
+	//app_regs.REG_CALIBRATION_SWEEP_CONFIG[0] = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_SWEEP_CONFIG(void *a)
+{
+	uint16_t *reg = ((uint16_t*)a);
+	
+	if (reg[0] < 10 || reg[1] > 990 || reg[0] >= reg[1])
+		return false;
+	if (reg[2] < 2 || reg[2] > 255 || reg[3] < 2 || reg[4] < 2)
+		return false;
+	
+	/* Not while a sweep is using it */
+	if (app_regs.REG_CALIBRATION_SWEEP & B_SWEEP_RUN)
+		return false;
+	
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_CALIBRATION_SWEEP_CONFIG[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_SWEEP_DATA                                           */
+/************************************************************************/
+void app_read_REG_CALIBRATION_SWEEP_DATA(void)
+{
+	//app_regs.REG_CALIBRATION_SWEEP_DATA[0] = 0;
+
+}
+
+bool app_write_REG_CALIBRATION_SWEEP_DATA(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_CHANNELS_TOTAL_VOLUME                                            */
+/************************************************************************/
+void app_read_REG_CHANNELS_TOTAL_VOLUME(void)
+{
+	//app_regs.REG_CHANNELS_TOTAL_VOLUME[0] = 0;
+
+}
+
+bool app_write_REG_CHANNELS_TOTAL_VOLUME(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_CHANNELS_TOTAL_VOLUME_LATCHED                                    */
+/************************************************************************/
+void app_read_REG_CHANNELS_TOTAL_VOLUME_LATCHED(void)
+{
+	//app_regs.REG_CHANNELS_TOTAL_VOLUME_LATCHED[0] = 0;
+
+}
+
+bool app_write_REG_CHANNELS_TOTAL_VOLUME_LATCHED(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_TOTAL_VOLUME_COMMAND                                             */
+/************************************************************************/
+void app_read_REG_TOTAL_VOLUME_COMMAND(void)
+{
+	//app_regs.REG_TOTAL_VOLUME_COMMAND = 0;
+
+}
+
+bool app_write_REG_TOTAL_VOLUME_COMMAND(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(MSK_FLOW_CHANNELS | B_TOTAL_VOLUME_LATCH | B_TOTAL_VOLUME_RESET))
+		return false;
+	
+	command_total_volume(reg);
+	
+	app_regs.REG_TOTAL_VOLUME_COMMAND = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_TOTAL_VOLUME_GATED                                               */
+/************************************************************************/
+void app_read_REG_TOTAL_VOLUME_GATED(void)
+{
+	//app_regs.REG_TOTAL_VOLUME_GATED = 0;
+
+}
+
+bool app_write_REG_TOTAL_VOLUME_GATED(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	/* Channels 0 to 3 each feed the odor valve with the same number */
+	if (reg & ~MSK_ODOR_VALVES)
+		return false;
+	
+	app_regs.REG_TOTAL_VOLUME_GATED = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MIX_TOTAL_FLOW                                                   */
+/************************************************************************/
+void app_read_REG_MIX_TOTAL_FLOW(void)
+{
+	//app_regs.REG_MIX_TOTAL_FLOW = 0;
+
+}
+
+bool app_write_REG_MIX_TOTAL_FLOW(void *a)
+{
+	float reg = *((float*)a);
+	
+	return write_mix(reg, app_regs.REG_MIX_CONCENTRATIONS);
+}
+
+
+/************************************************************************/
+/* REG_MIX_CONCENTRATIONS                                               */
+/************************************************************************/
+void app_read_REG_MIX_CONCENTRATIONS(void)
+{
+	//app_regs.REG_MIX_CONCENTRATIONS[0] = 0;
+
+}
+
+bool app_write_REG_MIX_CONCENTRATIONS(void *a)
+{
+	float *reg = ((float*)a);
+	
+	return write_mix(app_regs.REG_MIX_TOTAL_FLOW, reg);
+}
+
+
+/************************************************************************/
+/* REG_MIX_ENABLE                                                       */
+/************************************************************************/
+void app_read_REG_MIX_ENABLE(void)
+{
+	//app_regs.REG_MIX_ENABLE = 0;
+
+}
+
+bool app_write_REG_MIX_ENABLE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~B_MIX_ENABLE)
+		return false;
+	
+	app_regs.REG_MIX_ENABLE = reg;
+	
+	/* The setpoints follow the mix from the next tick */
+	if (reg & B_MIX_ENABLE)
+		mix_pending = true;
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROFILER_CONTROL                                                 */
+/************************************************************************/
+void app_read_REG_PROFILER_CONTROL(void)
+{
+#ifdef ENABLE_PROFILER
+	app_regs.REG_PROFILER_CONTROL = B_PROFILER_AVAILABLE;
+#else
+	app_regs.REG_PROFILER_CONTROL = 0;
+#endif
+}
+
+bool app_write_REG_PROFILER_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_PROFILER_RESET | B_PROFILER_AVAILABLE))
+		return false;
+	
+	if (reg & B_PROFILER_RESET)
+		profiler_reset();
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROFILER_SITE                                                    */
+/************************************************************************/
+void app_read_REG_PROFILER_SITE(void)
+{
+	//app_regs.REG_PROFILER_SITE = 0;
+
+}
+
+bool app_write_REG_PROFILER_SITE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg >= PROFILER_SITES)
+		return false;
+	
+	app_regs.REG_PROFILER_SITE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_PROFILER_DATA                                                    */
+/************************************************************************/
+void app_read_REG_PROFILER_DATA(void)
+{
+	profiler_read(app_regs.REG_PROFILER_SITE, app_regs.REG_PROFILER_DATA);
+}
+
+bool app_write_REG_PROFILER_DATA(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_CPU_LOAD                                                         */
+/************************************************************************/
+void app_read_REG_CPU_LOAD(void)
+{
+	//app_regs.REG_CPU_LOAD[0] = 0;
+
+}
+
+bool app_write_REG_CPU_LOAD(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_CPU_LOAD_CONTROL                                                 */
+/************************************************************************/
+void app_read_REG_CPU_LOAD_CONTROL(void)
+{
+	//app_regs.REG_CPU_LOAD_CONTROL = 0;
+
+}
+
+bool app_write_REG_CPU_LOAD_CONTROL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_CPU_LOAD_EVENT | B_CPU_LOAD_CLEAR))
+		return false;
+	
+	if (reg & B_CPU_LOAD_CLEAR)
+	{
+		uint8_t sreg = SREG;
+		cli();
+		app_regs.REG_CPU_LOAD[3] = 0;
+		SREG = sreg;
+	}
+	
+	app_regs.REG_CPU_LOAD_CONTROL = reg & B_CPU_LOAD_EVENT;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOOP_LATENCY_CHANNEL                                             */
+/************************************************************************/
+void app_read_REG_LOOP_LATENCY_CHANNEL(void)
+{
+	//app_regs.REG_LOOP_LATENCY_CHANNEL = 0;
+
+}
+
+bool app_write_REG_LOOP_LATENCY_CHANNEL(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg >= FLOW_CHANNELS)
+		return false;
+	
+	app_regs.REG_LOOP_LATENCY_CHANNEL = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_LOOP_LATENCY                                                     */
+/************************************************************************/
+void app_read_REG_LOOP_LATENCY(void)
+{
+	loop_latency_read(app_regs.REG_LOOP_LATENCY_CHANNEL, app_regs.REG_LOOP_LATENCY);
+}
+
+bool app_write_REG_LOOP_LATENCY(void *a)
+{
+	return false;
+}
+
+
+/************************************************************************/
+/* REG_LOOP_LATENCY_RESET                                               */
+/************************************************************************/
+void app_read_REG_LOOP_LATENCY_RESET(void)
+{
+	//app_regs.REG_LOOP_LATENCY_RESET = 0;
+
+}
+
+bool app_write_REG_LOOP_LATENCY_RESET(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_FLOW_CHANNELS)
+		return false;
+	
+	loop_latency_reset(reg);
+	
+	app_regs.REG_LOOP_LATENCY_RESET = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SEQUENCE_SETTLE_TIMEOUT                                          */
+/************************************************************************/
+void app_read_REG_SEQUENCE_SETTLE_TIMEOUT(void)
+{
+	//app_regs.REG_SEQUENCE_SETTLE_TIMEOUT = 0;
+
+}
+
+bool app_write_REG_SEQUENCE_SETTLE_TIMEOUT(void *a)
+{
+	uint16_t reg = *((uint16_t*)a);
+	
+	if (reg == 0)
+		return false;
+	
+	app_regs.REG_SEQUENCE_SETTLE_TIMEOUT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CALIBRATION_SOURCE                                               */
+/************************************************************************/
+void app_read_REG_CALIBRATION_SOURCE(void)
+{
+	app_regs.REG_CALIBRATION_SOURCE = calibration_source | (calibration_record_damaged ? B_CALIBRATION_RECORD_DAMAGED : 0);
+}
+
+bool app_write_REG_CALIBRATION_SOURCE(void *a)
+{
+	return false;
 }
\ No newline at end of file
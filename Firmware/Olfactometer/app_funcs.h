@@ -16,28 +16,43 @@
 #define false 0
 #endif
 
-#define start_VALVE0 do {set_VALVE0; if (app_regs.REG_ENABLE_VALVES_PULSE & B_VALVE0) pulse_countdown.valve0 = app_regs.REG_VALVE0_PULSE_DURATION + 1;\
-if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0) pulse_countdown.delayvalve0chk = app_regs.REG_VALVE0CHK_DELAY + 1;} while(0)
-#define start_VALVE1 do {set_VALVE1; if (app_regs.REG_ENABLE_VALVES_PULSE & B_VALVE1) pulse_countdown.valve1 = app_regs.REG_VALVE1_PULSE_DURATION + 1;\
-if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1) pulse_countdown.delayvalve1chk = app_regs.REG_VALVE1CHK_DELAY + 1;} while(0)
-#define start_VALVE2 do {set_VALVE2; if (app_regs.REG_ENABLE_VALVES_PULSE & B_VALVE2) pulse_countdown.valve2 = app_regs.REG_VALVE2_PULSE_DURATION + 1;\
-if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2) pulse_countdown.delayvalve2chk = app_regs.REG_VALVE2CHK_DELAY + 1;} while(0)
-#define start_VALVE3 do {set_VALVE3; if (app_regs.REG_ENABLE_VALVES_PULSE & B_VALVE3) pulse_countdown.valve3 = app_regs.REG_VALVE3_PULSE_DURATION + 1;\
-if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3) pulse_countdown.delayvalve3chk = app_regs.REG_VALVE3CHK_DELAY + 1;} while(0)
+/************************************************************************/
+/* Arm the pulse and check valves countdowns after a group switch       */
+/************************************************************************/
+void arm_valves_countdown(uint16_t started, uint16_t stopped);
+
+/************************************************************************/
+/* Flow channels register writes, shared by the per channel registers   */
+/************************************************************************/
+uint16_t target_flow_limit(uint8_t channel);
+bool write_target_flow(uint8_t channel, float target_flow);
+bool write_frequency(uint8_t channel, uint16_t frequency);
+bool write_duty_cycle(uint8_t channel, float duty_cycle);
+bool write_user_calibration(uint8_t channel, uint16_t *calibration, uint16_t *values);
+
+/************************************************************************/
+/* Calibration profiles, from app.c                                     */
+/************************************************************************/
+bool select_calibration_profiles(uint8_t *profiles);
+bool calibration_increasing(uint16_t *calibration);
+bool save_calibration_profile(uint8_t channel, uint8_t slot);
+bool compile_calibration_curve(uint16_t *curve);
+bool start_calibration_sweep(uint8_t channel);
 
-#define stop_VALVE0 do {clr_VALVE0; if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE0) pulse_countdown.delayvalve0chk = app_regs.REG_VALVE0CHK_DELAY + 1;} while(0)
-#define stop_VALVE1 do {clr_VALVE1; if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE1) pulse_countdown.delayvalve1chk = app_regs.REG_VALVE1CHK_DELAY + 1;} while(0)
-#define stop_VALVE2 do {clr_VALVE2; if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE2) pulse_countdown.delayvalve2chk = app_regs.REG_VALVE2CHK_DELAY + 1;} while(0)
-#define stop_VALVE3 do {clr_VALVE3; if(app_regs.REG_ENABLE_CHECK_VALVES_SYNC & B_CHECK_VALVE3) pulse_countdown.delayvalve3chk = app_regs.REG_VALVE3CHK_DELAY + 1;} while(0)
+/************************************************************************/
+/* Concentration mix, from app.c                                        */
+/************************************************************************/
+bool write_mix(float total_flow, float *concentrations);
 
-#define start_VALVE0CHK do {set_VALVE0CHK; if (app_regs.REG_ENABLE_VALVES_PULSE & B_CHECK_VALVE0) pulse_countdown.chkvalve0 = app_regs.REG_VALVE0CHK_DELAY + 1;} while(0)
-#define start_VALVE1CHK do {set_VALVE1CHK; if (app_regs.REG_ENABLE_VALVES_PULSE & B_CHECK_VALVE1) pulse_countdown.chkvalve1 = app_regs.REG_VALVE1CHK_DELAY + 1; } while(0)
-#define start_VALVE2CHK do {set_VALVE2CHK; if (app_regs.REG_ENABLE_VALVES_PULSE & B_CHECK_VALVE2) pulse_countdown.chkvalve2 = app_regs.REG_VALVE2CHK_DELAY + 1; } while(0)
-#define start_VALVE3CHK do {set_VALVE3CHK; if (app_regs.REG_ENABLE_VALVES_PULSE & B_CHECK_VALVE3) pulse_countdown.chkvalve3 = app_regs.REG_VALVE3CHK_DELAY + 1; } while(0)
+/************************************************************************/
+/* Send an event with a timestamp latched before                        */
+/************************************************************************/
+void send_event_at(uint8_t add, uint32_t seconds, uint16_t useconds);
 
-#define start_VALVEAUX0 do {set_ENDVALVE0; if (app_regs.REG_ENABLE_VALVES_PULSE & B_ENDVALVE0) pulse_countdown.valveaux0 = app_regs.REG_END_VALVE0_PULSE_DURATION + 1; } while(0)
-#define start_VALVEAUX1 do {set_ENDVALVE1; if (app_regs.REG_ENABLE_VALVES_PULSE & B_ENDVALVE1) pulse_countdown.valveaux1 = app_regs.REG_END_VALVE1_PULSE_DURATION + 1; } while(0)
-#define start_VALVEDUMMY do {set_DUMMYVALVE; if (app_regs.REG_ENABLE_VALVES_PULSE & B_DUMMYVALVE) pulse_countdown.valvedummy = app_regs.REG_DUMMY_VALVE_PULSE_DURATION + 1; } while(0)
+/************************************************************************/
+/* Send a valves transition with the timestamp of the port write        */
+/************************************************************************/
+void send_valves_event(uint16_t changed, uint16_t state, uint32_t seconds, uint16_t useconds);
 
 /************************************************************************/
 /* Prototypes                                                           */
@@ -117,6 +132,56 @@ void app_read_REG_TEMPERATURE_VALUE(void);
 void app_read_REG_ENABLE_TEMP_CALIBRATION(void);
 void app_read_REG_TEMP_USER_CALIBRATION(void);
 void app_read_REG_ENABLE_EVENTS(void);
+void app_read_REG_VALVES_EVENT(void);
+void app_read_REG_VALVE0_TRAIN(void);
+void app_read_REG_VALVE1_TRAIN(void);
+void app_read_REG_VALVE2_TRAIN(void);
+void app_read_REG_VALVE3_TRAIN(void);
+void app_read_REG_END_VALVE0_TRAIN(void);
+void app_read_REG_END_VALVE1_TRAIN(void);
+void app_read_REG_DUMMY_VALVE_TRAIN(void);
+void app_read_REG_VALVES_TRAIN_START(void);
+void app_read_REG_VALVES_TRAIN_STOP(void);
+void app_read_REG_VALVES_TRAIN_DONE(void);
+void app_read_REG_SEQUENCE_CONTROL(void);
+void app_read_REG_SEQUENCE_LENGTH(void);
+void app_read_REG_SEQUENCE_STEP_INDEX(void);
+void app_read_REG_SEQUENCE_STEP(void);
+void app_read_REG_SEQUENCE_STEP_FLOWS(void);
+void app_read_REG_DI0_DEBOUNCE(void);
+void app_read_REG_FLOW_SETTLE_TOLERANCE(void);
+void app_read_REG_FLOW_SETTLE_DWELL(void);
+void app_read_REG_FLOW_SETTLED(void);
+void app_read_REG_FLOW_SETTLE_TIME(void);
+void app_read_REG_PWM_DITHER(void);
+void app_read_REG_PWM_PHASE(void);
+void app_read_REG_CHANNELS_ENABLE(void);
+void app_read_REG_CHANNELS_ENABLE_EVENTS(void);
+void app_read_REG_WARM_START(void);
+void app_read_REG_CALIBRATION_PROFILE(void);
+void app_read_REG_CALIBRATION_PROFILE_NAME(void);
+void app_read_REG_CALIBRATION_PROFILE_SAVE(void);
+void app_read_REG_CALIBRATION_CURVE(void);
+void app_read_REG_CALIBRATION_SWEEP(void);
+void app_read_REG_CALIBRATION_SWEEP_CONFIG(void);
+void app_read_REG_CALIBRATION_SWEEP_DATA(void);
+void app_read_REG_CHANNELS_TOTAL_VOLUME(void);
+void app_read_REG_CHANNELS_TOTAL_VOLUME_LATCHED(void);
+void app_read_REG_TOTAL_VOLUME_COMMAND(void);
+void app_read_REG_TOTAL_VOLUME_GATED(void);
+void app_read_REG_MIX_TOTAL_FLOW(void);
+void app_read_REG_MIX_CONCENTRATIONS(void);
+void app_read_REG_MIX_ENABLE(void);
+void app_read_REG_PROFILER_CONTROL(void);
+void app_read_REG_PROFILER_SITE(void);
+void app_read_REG_PROFILER_DATA(void);
+void app_read_REG_CPU_LOAD(void);
+void app_read_REG_CPU_LOAD_CONTROL(void);
+void app_read_REG_LOOP_LATENCY_CHANNEL(void);
+void app_read_REG_LOOP_LATENCY(void);
+void app_read_REG_LOOP_LATENCY_RESET(void);
+void app_read_REG_SEQUENCE_SETTLE_TIMEOUT(void);
+void app_read_REG_CALIBRATION_SOURCE(void);
 
 bool app_write_REG_ENABLE_FLOW(void *a);
 bool app_write_REG_FLOWMETER_ANALOG_OUTPUTS(void *a);
@@ -193,6 +258,56 @@ bool app_write_REG_TEMPERATURE_VALUE(void *a);
 bool app_write_REG_ENABLE_TEMP_CALIBRATION(void *a);
 bool app_write_REG_TEMP_USER_CALIBRATION(void *a);
 bool app_write_REG_ENABLE_EVENTS(void *a);
+bool app_write_REG_VALVES_EVENT(void *a);
+bool app_write_REG_VALVE0_TRAIN(void *a);
+bool app_write_REG_VALVE1_TRAIN(void *a);
+bool app_write_REG_VALVE2_TRAIN(void *a);
+bool app_write_REG_VALVE3_TRAIN(void *a);
+bool app_write_REG_END_VALVE0_TRAIN(void *a);
+bool app_write_REG_END_VALVE1_TRAIN(void *a);
+bool app_write_REG_DUMMY_VALVE_TRAIN(void *a);
+bool app_write_REG_VALVES_TRAIN_START(void *a);
+bool app_write_REG_VALVES_TRAIN_STOP(void *a);
+bool app_write_REG_VALVES_TRAIN_DONE(void *a);
+bool app_write_REG_SEQUENCE_CONTROL(void *a);
+bool app_write_REG_SEQUENCE_LENGTH(void *a);
+bool app_write_REG_SEQUENCE_STEP_INDEX(void *a);
+bool app_write_REG_SEQUENCE_STEP(void *a);
+bool app_write_REG_SEQUENCE_STEP_FLOWS(void *a);
+bool app_write_REG_DI0_DEBOUNCE(void *a);
+bool app_write_REG_FLOW_SETTLE_TOLERANCE(void *a);
+bool app_write_REG_FLOW_SETTLE_DWELL(void *a);
+bool app_write_REG_FLOW_SETTLED(void *a);
+bool app_write_REG_FLOW_SETTLE_TIME(void *a);
+bool app_write_REG_PWM_DITHER(void *a);
+bool app_write_REG_PWM_PHASE(void *a);
+bool app_write_REG_CHANNELS_ENABLE(void *a);
+bool app_write_REG_CHANNELS_ENABLE_EVENTS(void *a);
+bool app_write_REG_WARM_START(void *a);
+bool app_write_REG_CALIBRATION_PROFILE(void *a);
+bool app_write_REG_CALIBRATION_PROFILE_NAME(void *a);
+bool app_write_REG_CALIBRATION_PROFILE_SAVE(void *a);
+bool app_write_REG_CALIBRATION_CURVE(void *a);
+bool app_write_REG_CALIBRATION_SWEEP(void *a);
+bool app_write_REG_CALIBRATION_SWEEP_CONFIG(void *a);
+bool app_write_REG_CALIBRATION_SWEEP_DATA(void *a);
+bool app_write_REG_CHANNELS_TOTAL_VOLUME(void *a);
+bool app_write_REG_CHANNELS_TOTAL_VOLUME_LATCHED(void *a);
+bool app_write_REG_TOTAL_VOLUME_COMMAND(void *a);
+bool app_write_REG_TOTAL_VOLUME_GATED(void *a);
+bool app_write_REG_MIX_TOTAL_FLOW(void *a);
+bool app_write_REG_MIX_CONCENTRATIONS(void *a);
+bool app_write_REG_MIX_ENABLE(void *a);
+bool app_write_REG_PROFILER_CONTROL(void *a);
+bool app_write_REG_PROFILER_SITE(void *a);
+bool app_write_REG_PROFILER_DATA(void *a);
+bool app_write_REG_CPU_LOAD(void *a);
+bool app_write_REG_CPU_LOAD_CONTROL(void *a);
+bool app_write_REG_LOOP_LATENCY_CHANNEL(void *a);
+bool app_write_REG_LOOP_LATENCY(void *a);
+bool app_write_REG_LOOP_LATENCY_RESET(void *a);
+bool app_write_REG_SEQUENCE_SETTLE_TIMEOUT(void *a);
+bool app_write_REG_CALIBRATION_SOURCE(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
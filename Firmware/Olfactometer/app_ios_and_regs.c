@@ -1,6 +1,9 @@
 #include <avr/io.h>
 #include "hwbp_core_types.h"
 #include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "hwbp_core.h"
+#include "profiler.h"
 
 //to be accessed in app_ios_regs.c
 extern AppRegs app_regs; 
@@ -8,24 +11,139 @@ extern AppRegs app_regs;
 /************************************************************************/
 /* Set the corresponding MIMIC functions                                */
 /************************************************************************/
-void mimic_valves (uint8_t reg, uint8_t function)
+/* The masks are compiled when a REG_MIMIC_ register is written, so the */
+/* valve macros only need to write them to PORTH (OUT0 is PH4 and OUT1  */
+/* is PH5).                                                             */
+uint8_t valve_mimic[12];
+
+void update_valve_mimic (uint8_t valve, uint8_t reg)
 {
-	switch (reg)
+	uint8_t mask = 0;
+	
+	if (reg & GM_MIMIC_DO0) mask |= (1<<4);
+	if (reg & GM_MIMIC_DO1) mask |= (1<<5);
+	
+	valve_mimic[valve] = mask;
+}
+
+
+/************************************************************************/
+/* Switch a group of valves at once                                     */
+/************************************************************************/
+/* The port masks are computed first, so that all the valves and the    */
+/* mimic outputs change inside the same block of OUTCLR/OUTSET writes   */
+/* instead of one after the other. When B_EVT3 is enabled, the Harp     */
+/* time of the write is latched and sent with the valves that changed.  */
+void write_valves (uint16_t set_mask, uint16_t clear_mask)
+{
+	uint8_t set_c = 0, set_d = 0, set_e = 0, set_f = 0, set_j = 0, set_h = 0;
+	uint8_t clr_c = 0, clr_d = 0, clr_e = 0, clr_f = 0, clr_j = 0, clr_h = 0;
+	uint8_t sreg;
+	bool event = app_regs.REG_ENABLE_EVENTS & B_EVT3;
+	uint16_t before = 0, after;
+	uint32_t seconds = 0;
+	uint16_t useconds = 0;
+
+	if (set_mask & B_VALVE0)       { set_c |= (1<<1); set_h |= valve_mimic[0]; }
+	if (set_mask & B_VALVE1)       { set_d |= (1<<1); set_h |= valve_mimic[1]; }
+	if (set_mask & B_VALVE2)       { set_e |= (1<<1); set_h |= valve_mimic[2]; }
+	if (set_mask & B_VALVE3)       { set_f |= (1<<1); set_h |= valve_mimic[3]; }
+	if (set_mask & B_ENDVALVE0)    { set_d |= (1<<2); set_h |= valve_mimic[4]; }
+	if (set_mask & B_ENDVALVE1)    { set_d |= (1<<3); set_h |= valve_mimic[5]; }
+	if (set_mask & B_DUMMYVALVE)   { set_j |= (1<<1); set_h |= valve_mimic[6]; }
+	if (set_mask & B_CHECK_VALVE0) { set_d |= (1<<5); set_h |= valve_mimic[8]; }
+	if (set_mask & B_CHECK_VALVE1) { set_d |= (1<<7); set_h |= valve_mimic[9]; }
+	if (set_mask & B_CHECK_VALVE2) { set_e |= (1<<3); set_h |= valve_mimic[10]; }
+	if (set_mask & B_CHECK_VALVE3) { set_f |= (1<<5); set_h |= valve_mimic[11]; }
+
+	if (clear_mask & B_VALVE0)       { clr_c |= (1<<1); clr_h |= valve_mimic[0]; }
+	if (clear_mask & B_VALVE1)       { clr_d |= (1<<1); clr_h |= valve_mimic[1]; }
+	if (clear_mask & B_VALVE2)       { clr_e |= (1<<1); clr_h |= valve_mimic[2]; }
+	if (clear_mask & B_VALVE3)       { clr_f |= (1<<1); clr_h |= valve_mimic[3]; }
+	if (clear_mask & B_ENDVALVE0)    { clr_d |= (1<<2); clr_h |= valve_mimic[4]; }
+	if (clear_mask & B_ENDVALVE1)    { clr_d |= (1<<3); clr_h |= valve_mimic[5]; }
+	if (clear_mask & B_DUMMYVALVE)   { clr_j |= (1<<1); clr_h |= valve_mimic[6]; }
+	if (clear_mask & B_CHECK_VALVE0) { clr_d |= (1<<5); clr_h |= valve_mimic[8]; }
+	if (clear_mask & B_CHECK_VALVE1) { clr_d |= (1<<7); clr_h |= valve_mimic[9]; }
+	if (clear_mask & B_CHECK_VALVE2) { clr_e |= (1<<3); clr_h |= valve_mimic[10]; }
+	if (clear_mask & B_CHECK_VALVE3) { clr_f |= (1<<5); clr_h |= valve_mimic[11]; }
+
+	/* A mimic output shared by an opening and a closing valve stays set */
+	clr_h &= ~set_h;
+
+	sreg = SREG;
+	cli();
+	if (event)
+		before = read_valves();
+	PORTC.OUTCLR = clr_c;
+	PORTD.OUTCLR = clr_d;
+	PORTE.OUTCLR = clr_e;
+	PORTF.OUTCLR = clr_f;
+	PORTJ.OUTCLR = clr_j;
+	PORTH.OUTCLR = clr_h;
+	PORTC.OUTSET = set_c;
+	PORTD.OUTSET = set_d;
+	PORTE.OUTSET = set_e;
+	PORTF.OUTSET = set_f;
+	PORTJ.OUTSET = set_j;
+	PORTH.OUTSET = set_h;
+	if (event)
+	{
+		seconds = core_func_read_R_TIMESTAMP_SECOND();
+		useconds = core_func_read_R_TIMESTAMP_MICRO();
+	}
+	SREG = sreg;
+	
+	if (event)
 	{
-		case GM_MIMIC_DO0:  
-			if (function == _SET_IO_) set_OUT0;          
-			if (function == _CLR_IO_) clr_OUT0;            
-			if (function == _TGL_IO_) tgl_OUT0; 
-			break;
-		case GM_MIMIC_DO1:  
-			if (function == _SET_IO_) set_OUT1;          
-			if (function == _CLR_IO_) clr_OUT1;            
-			if (function == _TGL_IO_) tgl_OUT1;
-			break;
+		after = ((before & ~clear_mask) | set_mask) & MSK_VALVES;
+		if (before ^ after)
+			send_valves_event(before ^ after, after, seconds, useconds);
 	}
 }
 
 
+/************************************************************************/
+/* Read the state of all valves                                         */
+/************************************************************************/
+uint16_t read_valves (void)
+{
+	uint16_t valves = 0;
+
+	if (read_VALVE0) valves |= B_VALVE0;
+	if (read_VALVE1) valves |= B_VALVE1;
+	if (read_VALVE2) valves |= B_VALVE2;
+	if (read_VALVE3) valves |= B_VALVE3;
+	if (read_ENDVALVE0) valves |= B_ENDVALVE0;
+	if (read_ENDVALVE1) valves |= B_ENDVALVE1;
+	if (read_DUMMYVALVE) valves |= B_DUMMYVALVE;
+	if (read_VALVE0CHK) valves |= B_CHECK_VALVE0;
+	if (read_VALVE1CHK) valves |= B_CHECK_VALVE1;
+	if (read_VALVE2CHK) valves |= B_CHECK_VALVE2;
+	if (read_VALVE3CHK) valves |= B_CHECK_VALVE3;
+
+	return valves;
+}
+
+
+/************************************************************************/
+/* Update the mimic outputs of a group of valves                        */
+/************************************************************************/
+void write_valves_mimic (uint16_t set_mask, uint16_t clear_mask)
+{
+	uint8_t set_h = 0, clr_h = 0;
+	
+	for (uint8_t i = 0; i < 12; i++)
+	{
+		if (set_mask & (1<<i)) set_h |= valve_mimic[i];
+		if (clear_mask & (1<<i)) clr_h |= valve_mimic[i];
+	}
+	
+	PORTH.OUTCLR = clr_h & ~set_h;
+	PORTH.OUTSET = set_h;
+}
+
+
 /************************************************************************/
 /* Configure and initialize IOs                                         */
 /************************************************************************/
@@ -61,6 +179,17 @@ void init_ios(void)
 	io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<4), false);                 // ENDVALVECTRL
 	io_set_int(&PORTA, INT_LEVEL_LOW, 0, (1<<5), false);                 // FLUSHVALVECTRL
 	
+	/* Capture IN0 edges on TCE1 through the event channel 7 (2 us per count) */
+	EVSYS_CH7MUX = EVSYS_CHMUX_PORTB_PIN0_gc;
+	EVSYS_CH7CTRL = EVSYS_DIGFILT_1SAMPLE_gc;
+	TCE1.CTRLB = TC1_CCAEN_bm | TC_WGMODE_NORMAL_gc;
+	TCE1.CTRLD = TC_EVACT_CAPT_gc | TC_EVSEL_CH7_gc;
+	TCE1.PER = 0xFFFF;
+	TCE1.CTRLA = TC_CLKSEL_DIV64_gc;
+	
+	/* TCF1 counts CPU cycles for the time measurements */
+	init_cycle_counter();
+	
 	/* Configure output pins */
 	io_pin2out(&PORTH, 4, OUT_IO_DIGITAL, IN_EN_IO_DIS);                 // OUT0
 	io_pin2out(&PORTH, 5, OUT_IO_DIGITAL, IN_EN_IO_DIS);                 // OUT1
@@ -209,6 +338,56 @@ uint8_t app_regs_type[] = {
 	TYPE_U8,
 	TYPE_U8,
 	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_FLOAT,
+	TYPE_U16,
+	TYPE_FLOAT,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U32,
+	TYPE_U32,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_FLOAT,
+	TYPE_FLOAT,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U8,
+	TYPE_U16,
+	TYPE_U8,
+	TYPE_U16,
 	TYPE_U8
 };
 
@@ -287,6 +466,56 @@ uint16_t app_regs_n_elements[] = {
 	1,
 	1,
 	1,
+	1,
+	2,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	4,
+	1,
+	1,
+	1,
+	1,
+	1,
+	1,
+	4,
+	5,
+	1,
+	1,
+	1,
+	1,
+	5,
+	1,
+	5,
+	1,
+	1,
+	1,
+	5,
+	8,
+	1,
+	66,
+	1,
+	5,
+	18,
+	5,
+	5,
+	1,
+	1,
+	1,
+	4,
+	1,
+	1,
+	1,
+	12,
+	4,
+	1,
+	1,
+	34,
+	1,
+	1,
 	1
 };
 
@@ -365,5 +594,55 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_TEMPERATURE_VALUE),
 	(uint8_t*)(&app_regs.REG_ENABLE_TEMP_CALIBRATION),
 	(uint8_t*)(&app_regs.REG_TEMP_USER_CALIBRATION),
-	(uint8_t*)(&app_regs.REG_ENABLE_EVENTS)
+	(uint8_t*)(&app_regs.REG_ENABLE_EVENTS),
+	(uint8_t*)(app_regs.REG_VALVES_EVENT),
+	(uint8_t*)(app_regs.REG_VALVE0_TRAIN),
+	(uint8_t*)(app_regs.REG_VALVE1_TRAIN),
+	(uint8_t*)(app_regs.REG_VALVE2_TRAIN),
+	(uint8_t*)(app_regs.REG_VALVE3_TRAIN),
+	(uint8_t*)(app_regs.REG_END_VALVE0_TRAIN),
+	(uint8_t*)(app_regs.REG_END_VALVE1_TRAIN),
+	(uint8_t*)(app_regs.REG_DUMMY_VALVE_TRAIN),
+	(uint8_t*)(&app_regs.REG_VALVES_TRAIN_START),
+	(uint8_t*)(&app_regs.REG_VALVES_TRAIN_STOP),
+	(uint8_t*)(&app_regs.REG_VALVES_TRAIN_DONE),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_CONTROL),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_LENGTH),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_STEP_INDEX),
+	(uint8_t*)(app_regs.REG_SEQUENCE_STEP),
+	(uint8_t*)(app_regs.REG_SEQUENCE_STEP_FLOWS),
+	(uint8_t*)(&app_regs.REG_DI0_DEBOUNCE),
+	(uint8_t*)(&app_regs.REG_FLOW_SETTLE_TOLERANCE),
+	(uint8_t*)(&app_regs.REG_FLOW_SETTLE_DWELL),
+	(uint8_t*)(&app_regs.REG_FLOW_SETTLED),
+	(uint8_t*)(app_regs.REG_FLOW_SETTLE_TIME),
+	(uint8_t*)(&app_regs.REG_PWM_DITHER),
+	(uint8_t*)(app_regs.REG_PWM_PHASE),
+	(uint8_t*)(&app_regs.REG_CHANNELS_ENABLE),
+	(uint8_t*)(&app_regs.REG_CHANNELS_ENABLE_EVENTS),
+	(uint8_t*)(&app_regs.REG_WARM_START),
+	(uint8_t*)(app_regs.REG_CALIBRATION_PROFILE),
+	(uint8_t*)(app_regs.REG_CALIBRATION_PROFILE_NAME),
+	(uint8_t*)(&app_regs.REG_CALIBRATION_PROFILE_SAVE),
+	(uint8_t*)(app_regs.REG_CALIBRATION_CURVE),
+	(uint8_t*)(&app_regs.REG_CALIBRATION_SWEEP),
+	(uint8_t*)(app_regs.REG_CALIBRATION_SWEEP_CONFIG),
+	(uint8_t*)(app_regs.REG_CALIBRATION_SWEEP_DATA),
+	(uint8_t*)(app_regs.REG_CHANNELS_TOTAL_VOLUME),
+	(uint8_t*)(app_regs.REG_CHANNELS_TOTAL_VOLUME_LATCHED),
+	(uint8_t*)(&app_regs.REG_TOTAL_VOLUME_COMMAND),
+	(uint8_t*)(&app_regs.REG_TOTAL_VOLUME_GATED),
+	(uint8_t*)(&app_regs.REG_MIX_TOTAL_FLOW),
+	(uint8_t*)(app_regs.REG_MIX_CONCENTRATIONS),
+	(uint8_t*)(&app_regs.REG_MIX_ENABLE),
+	(uint8_t*)(&app_regs.REG_PROFILER_CONTROL),
+	(uint8_t*)(&app_regs.REG_PROFILER_SITE),
+	(uint8_t*)(app_regs.REG_PROFILER_DATA),
+	(uint8_t*)(app_regs.REG_CPU_LOAD),
+	(uint8_t*)(&app_regs.REG_CPU_LOAD_CONTROL),
+	(uint8_t*)(&app_regs.REG_LOOP_LATENCY_CHANNEL),
+	(uint8_t*)(app_regs.REG_LOOP_LATENCY),
+	(uint8_t*)(&app_regs.REG_LOOP_LATENCY_RESET),
+	(uint8_t*)(&app_regs.REG_SEQUENCE_SETTLE_TIMEOUT),
+	(uint8_t*)(&app_regs.REG_CALIBRATION_SOURCE)
 };
\ No newline at end of file
@@ -3,11 +3,13 @@
 #include "cpu.h"
 
 void init_ios(void);
-void mimic_valves (uint8_t reg, uint8_t function);
+void update_valve_mimic (uint8_t valve, uint8_t reg);
+void write_valves (uint16_t set_mask, uint16_t clear_mask);
+uint16_t read_valves (void);
+void write_valves_mimic (uint16_t set_mask, uint16_t clear_mask);
 
-#define _SET_IO_ 0
-#define _CLR_IO_ 1
-#define _TGL_IO_ 2
+/* PORTH bits of the outputs that mimic each valve, indexed by the valve bit */
+extern uint8_t valve_mimic[12];
 
 /************************************************************************/
 /* Definition of input pins                                             */
@@ -109,51 +111,51 @@ void mimic_valves (uint8_t reg, uint8_t function);
 #define read_PWM4 read_io(PORTD, 4)
 
 /* VALVE0 */
-#define set_VALVE0 do { set_io(PORTC, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE0, _SET_IO_); } while(0)
-#define clr_VALVE0 do { clear_io(PORTC, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE0, _CLR_IO_); } while(0)
-#define tgl_VALVE0 do { toggle_io(PORTC, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE0, _TGL_IO_); } while(0)
+#define set_VALVE0 do { set_io(PORTC, 1); PORTH.OUTSET = valve_mimic[0]; } while(0)
+#define clr_VALVE0 do { clear_io(PORTC, 1); PORTH.OUTCLR = valve_mimic[0]; } while(0)
+#define tgl_VALVE0 do { toggle_io(PORTC, 1); PORTH.OUTTGL = valve_mimic[0]; } while(0)
 #define read_VALVE0 read_io(PORTC, 1)
 
 /* VALVE1 */
-#define set_VALVE1 do { set_io(PORTD, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE1, _SET_IO_); } while(0)
-#define clr_VALVE1 do { clear_io(PORTD, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE1, _CLR_IO_); } while(0)
-#define tgl_VALVE1 do { toggle_io(PORTD, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE1, _TGL_IO_); } while(0)
+#define set_VALVE1 do { set_io(PORTD, 1); PORTH.OUTSET = valve_mimic[1]; } while(0)
+#define clr_VALVE1 do { clear_io(PORTD, 1); PORTH.OUTCLR = valve_mimic[1]; } while(0)
+#define tgl_VALVE1 do { toggle_io(PORTD, 1); PORTH.OUTTGL = valve_mimic[1]; } while(0)
 #define read_VALVE1 read_io(PORTD, 1)
 
 /* VALVE2 */
-#define set_VALVE2 do { set_io(PORTE, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE2, _SET_IO_); } while(0)
-#define clr_VALVE2 do { clear_io(PORTE, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE2, _CLR_IO_); } while(0)
-#define tgl_VALVE2 do { toggle_io(PORTE, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE2, _TGL_IO_); } while(0)
+#define set_VALVE2 do { set_io(PORTE, 1); PORTH.OUTSET = valve_mimic[2]; } while(0)
+#define clr_VALVE2 do { clear_io(PORTE, 1); PORTH.OUTCLR = valve_mimic[2]; } while(0)
+#define tgl_VALVE2 do { toggle_io(PORTE, 1); PORTH.OUTTGL = valve_mimic[2]; } while(0)
 #define read_VALVE2 read_io(PORTE, 1)
 
 /* VALVE3 */
-#define set_VALVE3 do { set_io(PORTF, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE3, _SET_IO_); } while(0)
-#define clr_VALVE3 do { clear_io(PORTF, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE3, _CLR_IO_); } while(0)
-#define tgl_VALVE3 do { toggle_io(PORTF, 1); mimic_valves(app_regs.REG_MIMIC_ODOR_VALVE3, _TGL_IO_); } while(0)
+#define set_VALVE3 do { set_io(PORTF, 1); PORTH.OUTSET = valve_mimic[3]; } while(0)
+#define clr_VALVE3 do { clear_io(PORTF, 1); PORTH.OUTCLR = valve_mimic[3]; } while(0)
+#define tgl_VALVE3 do { toggle_io(PORTF, 1); PORTH.OUTTGL = valve_mimic[3]; } while(0)
 #define read_VALVE3 read_io(PORTF, 1)
 
 /* VALVE0CHK */
-#define set_VALVE0CHK do { set_io(PORTD, 5); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE0, _SET_IO_); } while(0)
-#define clr_VALVE0CHK do { clear_io(PORTD, 5); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE0, _CLR_IO_); } while(0)
-#define tgl_VALVE0CHK do { toggle_io(PORTD, 5); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE0, _TGL_IO_); } while(0)
+#define set_VALVE0CHK do { set_io(PORTD, 5); PORTH.OUTSET = valve_mimic[8]; } while(0)
+#define clr_VALVE0CHK do { clear_io(PORTD, 5); PORTH.OUTCLR = valve_mimic[8]; } while(0)
+#define tgl_VALVE0CHK do { toggle_io(PORTD, 5); PORTH.OUTTGL = valve_mimic[8]; } while(0)
 #define read_VALVE0CHK read_io(PORTD, 5)
 
 /* VALVE1CHK */
-#define set_VALVE1CHK do { set_io(PORTD, 7); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE1, _SET_IO_); } while(0)
-#define clr_VALVE1CHK do { clear_io(PORTD, 7); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE1, _CLR_IO_); } while(0)
-#define tgl_VALVE1CHK do { toggle_io(PORTD, 7); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE1, _TGL_IO_); } while(0)
+#define set_VALVE1CHK do { set_io(PORTD, 7); PORTH.OUTSET = valve_mimic[9]; } while(0)
+#define clr_VALVE1CHK do { clear_io(PORTD, 7); PORTH.OUTCLR = valve_mimic[9]; } while(0)
+#define tgl_VALVE1CHK do { toggle_io(PORTD, 7); PORTH.OUTTGL = valve_mimic[9]; } while(0)
 #define read_VALVE1CHK read_io(PORTD, 7)
 
 /* VALVE2CHK */
-#define set_VALVE2CHK do { set_io(PORTE, 3); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE2, _SET_IO_); } while(0)
-#define clr_VALVE2CHK do { clear_io(PORTE, 3); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE2, _CLR_IO_); } while(0)
-#define tgl_VALVE2CHK do { toggle_io(PORTE, 3); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE2, _TGL_IO_); } while(0)
+#define set_VALVE2CHK do { set_io(PORTE, 3); PORTH.OUTSET = valve_mimic[10]; } while(0)
+#define clr_VALVE2CHK do { clear_io(PORTE, 3); PORTH.OUTCLR = valve_mimic[10]; } while(0)
+#define tgl_VALVE2CHK do { toggle_io(PORTE, 3); PORTH.OUTTGL = valve_mimic[10]; } while(0)
 #define read_VALVE2CHK read_io(PORTE, 3)
 
 /* VALVE3CHK */
-#define set_VALVE3CHK do { set_io(PORTF, 5); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE3, _SET_IO_); } while(0)
-#define clr_VALVE3CHK do { clear_io(PORTF, 5); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE3, _CLR_IO_); } while(0)
-#define tgl_VALVE3CHK do { toggle_io(PORTF, 5); mimic_valves(app_regs.REG_MIMIC_CHECK_VALVE3, _TGL_IO_); } while(0)
+#define set_VALVE3CHK do { set_io(PORTF, 5); PORTH.OUTSET = valve_mimic[11]; } while(0)
+#define clr_VALVE3CHK do { clear_io(PORTF, 5); PORTH.OUTCLR = valve_mimic[11]; } while(0)
+#define tgl_VALVE3CHK do { toggle_io(PORTF, 5); PORTH.OUTTGL = valve_mimic[11]; } while(0)
 #define read_VALVE3CHK read_io(PORTF, 5)
 
 /* RE_DE_5V_0 */
@@ -229,21 +231,21 @@ void mimic_valves (uint8_t reg, uint8_t function);
 #define read_DUMMY0 read_io(PORTJ, 0)
 
 /* DUMMYVALVE */
-#define set_DUMMYVALVE do { set_io(PORTJ, 1); mimic_valves(app_regs.REG_MIMIC_DUMMY_VALVE, _SET_IO_); } while(0)
-#define clr_DUMMYVALVE do { clear_io(PORTJ, 1); mimic_valves(app_regs.REG_MIMIC_DUMMY_VALVE, _CLR_IO_); } while(0)
-#define tgl_DUMMYVALVE do { toggle_io(PORTJ, 1); mimic_valves(app_regs.REG_MIMIC_DUMMY_VALVE, _TGL_IO_); } while(0)
+#define set_DUMMYVALVE do { set_io(PORTJ, 1); PORTH.OUTSET = valve_mimic[6]; } while(0)
+#define clr_DUMMYVALVE do { clear_io(PORTJ, 1); PORTH.OUTCLR = valve_mimic[6]; } while(0)
+#define tgl_DUMMYVALVE do { toggle_io(PORTJ, 1); PORTH.OUTTGL = valve_mimic[6]; } while(0)
 #define read_DUMMYVALVE read_io(PORTJ, 1)
 
 /* ENDVALVE0 */
-#define set_ENDVALVE0 do { set_io(PORTD, 2); mimic_valves(app_regs.REG_MIMIC_END_VALVE0, _SET_IO_); } while(0)
-#define clr_ENDVALVE0 do { clear_io(PORTD, 2); mimic_valves(app_regs.REG_MIMIC_END_VALVE0, _CLR_IO_); } while(0)
-#define tgl_ENDVALVE0 do { toggle_io(PORTD, 2); mimic_valves(app_regs.REG_MIMIC_END_VALVE0, _TGL_IO_); } while(0)
+#define set_ENDVALVE0 do { set_io(PORTD, 2); PORTH.OUTSET = valve_mimic[4]; } while(0)
+#define clr_ENDVALVE0 do { clear_io(PORTD, 2); PORTH.OUTCLR = valve_mimic[4]; } while(0)
+#define tgl_ENDVALVE0 do { toggle_io(PORTD, 2); PORTH.OUTTGL = valve_mimic[4]; } while(0)
 #define read_ENDVALVE0 read_io(PORTD, 2)
 
 /* ENDVALVE1 */
-#define set_ENDVALVE1 do { set_io(PORTD, 3); mimic_valves(app_regs.REG_MIMIC_END_VALVE1, _SET_IO_); } while(0)
-#define clr_ENDVALVE1 do { clear_io(PORTD, 3); mimic_valves(app_regs.REG_MIMIC_END_VALVE1, _CLR_IO_); } while(0)
-#define tgl_ENDVALVE1 do { toggle_io(PORTD, 3); mimic_valves(app_regs.REG_MIMIC_END_VALVE1, _TGL_IO_); } while(0)
+#define set_ENDVALVE1 do { set_io(PORTD, 3); PORTH.OUTSET = valve_mimic[5]; } while(0)
+#define clr_ENDVALVE1 do { clear_io(PORTD, 3); PORTH.OUTCLR = valve_mimic[5]; } while(0)
+#define tgl_ENDVALVE1 do { toggle_io(PORTD, 3); PORTH.OUTTGL = valve_mimic[5]; } while(0)
 #define read_ENDVALVE1 read_io(PORTD, 3)
 
 /* RANGE */
@@ -333,6 +335,56 @@ typedef struct
 	uint8_t REG_ENABLE_TEMP_CALIBRATION;
 	uint8_t REG_TEMP_USER_CALIBRATION;
 	uint8_t REG_ENABLE_EVENTS;
+	uint16_t REG_VALVES_EVENT[2];
+	uint16_t REG_VALVE0_TRAIN[4];
+	uint16_t REG_VALVE1_TRAIN[4];
+	uint16_t REG_VALVE2_TRAIN[4];
+	uint16_t REG_VALVE3_TRAIN[4];
+	uint16_t REG_END_VALVE0_TRAIN[4];
+	uint16_t REG_END_VALVE1_TRAIN[4];
+	uint16_t REG_DUMMY_VALVE_TRAIN[4];
+	uint16_t REG_VALVES_TRAIN_START;
+	uint16_t REG_VALVES_TRAIN_STOP;
+	uint16_t REG_VALVES_TRAIN_DONE;
+	uint8_t REG_SEQUENCE_CONTROL;
+	uint8_t REG_SEQUENCE_LENGTH;
+	uint8_t REG_SEQUENCE_STEP_INDEX;
+	uint16_t REG_SEQUENCE_STEP[4];
+	float REG_SEQUENCE_STEP_FLOWS[5];
+	uint16_t REG_DI0_DEBOUNCE;
+	float REG_FLOW_SETTLE_TOLERANCE;
+	uint16_t REG_FLOW_SETTLE_DWELL;
+	uint8_t REG_FLOW_SETTLED;
+	uint16_t REG_FLOW_SETTLE_TIME[5];
+	uint8_t REG_PWM_DITHER;
+	uint8_t REG_PWM_PHASE[5];
+	uint8_t REG_CHANNELS_ENABLE;
+	uint8_t REG_CHANNELS_ENABLE_EVENTS;
+	uint8_t REG_WARM_START;
+	uint8_t REG_CALIBRATION_PROFILE[5];
+	uint8_t REG_CALIBRATION_PROFILE_NAME[8];
+	uint8_t REG_CALIBRATION_PROFILE_SAVE;
+	uint16_t REG_CALIBRATION_CURVE[66];
+	uint8_t REG_CALIBRATION_SWEEP;
+	uint16_t REG_CALIBRATION_SWEEP_CONFIG[5];
+	uint16_t REG_CALIBRATION_SWEEP_DATA[18];
+	uint32_t REG_CHANNELS_TOTAL_VOLUME[5];
+	uint32_t REG_CHANNELS_TOTAL_VOLUME_LATCHED[5];
+	uint8_t REG_TOTAL_VOLUME_COMMAND;
+	uint8_t REG_TOTAL_VOLUME_GATED;
+	float REG_MIX_TOTAL_FLOW;
+	float REG_MIX_CONCENTRATIONS[4];
+	uint8_t REG_MIX_ENABLE;
+	uint8_t REG_PROFILER_CONTROL;
+	uint8_t REG_PROFILER_SITE;
+	uint16_t REG_PROFILER_DATA[12];
+	uint16_t REG_CPU_LOAD[4];
+	uint8_t REG_CPU_LOAD_CONTROL;
+	uint8_t REG_LOOP_LATENCY_CHANNEL;
+	uint16_t REG_LOOP_LATENCY[34];
+	uint8_t REG_LOOP_LATENCY_RESET;
+	uint16_t REG_SEQUENCE_SETTLE_TIMEOUT;
+	uint8_t REG_CALIBRATION_SOURCE;
 } AppRegs;
 
 /************************************************************************/
@@ -414,6 +466,56 @@ typedef struct
 #define ADD_REG_ENABLE_TEMP_CALIBRATION    104 // U8     Enable flow adjustment based on the temperature calibration
 #define ADD_REG_TEMP_CALIBRATION           105 // U8     Temperature value measured during the device calibration
 #define ADD_REG_ENABLE_EVENTS              106 // U8     Enable the Events
+#define ADD_REG_VALVES_EVENT               107 // U16    Valve transitions: [0] mask of the valves that changed, [1] new state of the valves
+#define ADD_REG_VALVE0_TRAIN               108 // U16    Pulse train of the odor valve 0: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_VALVE1_TRAIN               109 // U16    Pulse train of the odor valve 1: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_VALVE2_TRAIN               110 // U16    Pulse train of the odor valve 2: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_VALVE3_TRAIN               111 // U16    Pulse train of the odor valve 3: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_END_VALVE0_TRAIN           112 // U16    Pulse train of the end valve 0: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_END_VALVE1_TRAIN           113 // U16    Pulse train of the end valve 1: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_DUMMY_VALVE_TRAIN          114 // U16    Pulse train of the dummy valve: [0] start delay, [1] on time, [2] off time (ms), [3] pulses (0: until stopped)
+#define ADD_REG_VALVES_TRAIN_START         115 // U16    Write a mask of odor, end and dummy valves to start their pulse trains
+#define ADD_REG_VALVES_TRAIN_STOP          116 // U16    Write a mask of valves to stop their pulse trains and close them
+#define ADD_REG_VALVES_TRAIN_DONE          117 // U16    Event with the mask of the valves whose pulse train has completed
+#define ADD_REG_SEQUENCE_CONTROL           118 // U8     Write 0 to stop, 1 to arm (DI0 start) or 2 to start the sequence. Reads the sequence state
+#define ADD_REG_SEQUENCE_LENGTH            119 // U8     Number of steps of the sequence [0:16]
+#define ADD_REG_SEQUENCE_STEP_INDEX        120 // U8     Selects the step accessed through SEQUENCE_STEP and SEQUENCE_STEP_FLOWS [0:15]
+#define ADD_REG_SEQUENCE_STEP              121 // U16    Selected step: [0] time from the sequence start (ms), [1] valves state, [2] digital outputs state, [3] channels that must be settled before the step
+#define ADD_REG_SEQUENCE_STEP_FLOWS        122 // FLOAT  Selected step: target flow of each channel. A negative value keeps the current target
+#define ADD_REG_DI0_DEBOUNCE               123 // U16    Time DI0 must stay at a new level before the edge is accepted [us] (0: disabled)
+#define ADD_REG_FLOW_SETTLE_TOLERANCE      124 // FLOAT  Maximum flow error, in percentage of the target, for a channel to be settled ]0:100]
+#define ADD_REG_FLOW_SETTLE_DWELL          125 // U16    Time the flow error must stay within the tolerance for a channel to be settled (ms)
+#define ADD_REG_FLOW_SETTLED               126 // U8     Mask of the channels whose flow is settled
+#define ADD_REG_FLOW_SETTLE_TIME           127 // U16    Time from the last target change until each channel settled (ms)
+#define ADD_REG_PWM_DITHER                 128 // U8     Mask of the channels whose PWM duty cycle is dithered across periods with 1/256 count resolution
+#define ADD_REG_PWM_PHASE                  129 // U8     Phase offset of each channel PWM, in percentage of the period [0:99]
+#define ADD_REG_CHANNELS_ENABLE            130 // U8     Mask of the channels that run while ENABLE_FLOW is on. A disabled channel keeps its duty cycle for a bumpless restart
+#define ADD_REG_CHANNELS_ENABLE_EVENTS     131 // U8     Mask of the channels that send CHANNELx_ACTUAL_FLOW events while EVT2 is enabled
+#define ADD_REG_WARM_START                 132 // U8     Restart each channel from its last converged duty cycle. Bit 1 keeps the table in EEPROM, bit 2 clears it
+#define ADD_REG_CALIBRATION_PROFILE        133 // U8     Selects the calibration profile of each channel (0 is the factory or user calibration)
+#define ADD_REG_CALIBRATION_PROFILE_NAME   134 // U8     Name of the calibration profile to save, or of the last one selected
+#define ADD_REG_CALIBRATION_PROFILE_SAVE   135 // U8     Saves the user calibration of a channel as a calibration profile
+#define ADD_REG_CALIBRATION_CURVE          136 // U16    Calibration curve of one channel: options, points, then pairs of code and flow (0.1 ml/min)
+#define ADD_REG_CALIBRATION_SWEEP          137 // U8     Starts or stops the calibration sweep of a channel
+#define ADD_REG_CALIBRATION_SWEEP_CONFIG   138 // U16    First and last duty cycle (0.1 %), steps, settle and average time (ms)
+#define ADD_REG_CALIBRATION_SWEEP_DATA     139 // U16    First step and number of points, then pairs of duty cycle (0.1 %) and mean ADC code
+#define ADD_REG_CHANNELS_TOTAL_VOLUME      140 // U32    Volume delivered by each channel (ul)
+#define ADD_REG_CHANNELS_TOTAL_VOLUME_LATCHED 141 // U32    Volumes copied by TOTAL_VOLUME_COMMAND (ul)
+#define ADD_REG_TOTAL_VOLUME_COMMAND       142 // U8     Latches and/or resets the volume of the channels selected
+#define ADD_REG_TOTAL_VOLUME_GATED         143 // U8     Channels that only add volume while their odor valve is open
+#define ADD_REG_MIX_TOTAL_FLOW             144 // Float  Total flow of the mix (ml/min)
+#define ADD_REG_MIX_CONCENTRATIONS         145 // Float  Fraction of the total flow from each odor channel (0 to 1)
+#define ADD_REG_MIX_ENABLE                 146 // U8     Sets the channels setpoints from the mix registers
+#define ADD_REG_PROFILER_CONTROL           147 // U8     Resets the profiler, reads if it is compiled in
+#define ADD_REG_PROFILER_SITE              148 // U8     Site reported by PROFILER_DATA
+#define ADD_REG_PROFILER_DATA              149 // U16    Count, min, max, mean (cycles) and histogram of the site
+#define ADD_REG_CPU_LOAD                   150 // U16    Last second CPU load and peak 1 ms load (0.1 %), missed ticks in it and since reset
+#define ADD_REG_CPU_LOAD_CONTROL           151 // U8     Sends CPU_LOAD each second, clears the missed ticks
+#define ADD_REG_LOOP_LATENCY_CHANNEL       152 // U8     Channel reported by LOOP_LATENCY
+#define ADD_REG_LOOP_LATENCY               153 // U16    Min and max (us) and histogram of the ADC start to duty cycle update time
+#define ADD_REG_LOOP_LATENCY_RESET         154 // U8     Clears the latency of the channels selected
+#define ADD_REG_SEQUENCE_SETTLE_TIMEOUT    155 // U16    Longest wait of a step for its channels to settle before the sequence is aborted (ms)
+#define ADD_REG_CALIBRATION_SOURCE         156 // U8     Where the factory calibration was read from, and if the EEPROM record was damaged
 
 /************************************************************************/
 /* Olfactometer  registers' memory limits                               */
@@ -423,8 +525,8 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x6A
-#define APP_NBYTES_OF_REG_BANK              291
+#define APP_REGS_ADD_MAX                    0x9C
+#define APP_NBYTES_OF_REG_BANK              786
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -444,27 +546,90 @@ typedef struct
 #define B_CHECK_VALVE1                     (1<<9)       // Check valve 1 //(1<<6) 
 #define B_CHECK_VALVE2                     (1<<10)      // Check valve 2 //(1<<1) 
 #define B_CHECK_VALVE3                     (1<<11)      // Check valve 3 //(1<<5)  
-#define MSK_DOUT0_CONF                     (3<<0)       // Select DOUT0 function
+#define MSK_ODOR_VALVES                    (B_VALVE0 | B_VALVE1 | B_VALVE2 | B_VALVE3)                          // All odor valves
+#define MSK_END_VALVES                     (B_ENDVALVE0 | B_ENDVALVE1 | B_DUMMYVALVE)                           // End valves and dummy valve
+#define MSK_CHECK_VALVES                   (B_CHECK_VALVE0 | B_CHECK_VALVE1 | B_CHECK_VALVE2 | B_CHECK_VALVE3)  // All check valves
+#define MSK_VALVES                         (MSK_ODOR_VALVES | MSK_END_VALVES | MSK_CHECK_VALVES)                // All valves
+#define TRAIN_DELAY                        0            // Index of the start delay in the VALVEx_TRAIN registers
+#define TRAIN_ON                           1            // Index of the on time
+#define TRAIN_OFF                          2            // Index of the off time
+#define TRAIN_PULSES                       3            // Index of the number of pulses
+#define GM_SEQUENCE_IDLE                   0            // Sequence stopped
+#define GM_SEQUENCE_ARMED                  1            // Sequence waiting for a DI0 rising edge
+#define GM_SEQUENCE_RUNNING                2            // Sequence running
+#define GM_SEQUENCE_SETTLE_FAILED          3            // Sequence aborted, the channels of a step did not settle
+#define SEQUENCE_MAX_STEPS                 16           // Steps of the sequence table
+#define SEQUENCE_TIME                      0            // Index of the step time in the SEQUENCE_STEP register
+#define SEQUENCE_VALVES                    1            // Index of the valves state
+#define SEQUENCE_OUTPUTS                   2            // Index of the digital outputs state
+#define SEQUENCE_SETTLE                    3            // Index of the mask of channels gating the step
+#define MSK_FLOW_CHANNELS                  0x1F         // All flow channels
+#define MSK_DOUT0_CONF                     (15<<0)      // Select DOUT0 function
 #define GM_DOUT0_SOFTWARE                  (0<<0)       // Digital output 0 controlled by software
 #define GM_DOUT0_START                     (1<<0)       // Equal to bit START
-#define MSK_DOUT1_CONF                     (3<<0)       // Select DOUT1 function
+#define GM_DOUT0_ADC_CLOCK                 (2<<0)       // Toggles on each ADC conversion start
+#define GM_DOUT0_HEARTBEAT                 (3<<0)       // Toggles on each closed loop iteration
+#define GM_DOUT0_SEQUENCE_PULSE            (4<<0)       // Pulses when a sequence starts
+#define GM_DOUT0_FLOW0_SETTLED             (8<<0)       // High while channel 0 flow is settled
+#define GM_DOUT0_FLOW1_SETTLED             (9<<0)       // High while channel 1 flow is settled
+#define GM_DOUT0_FLOW2_SETTLED             (10<<0)      // High while channel 2 flow is settled
+#define GM_DOUT0_FLOW3_SETTLED             (11<<0)      // High while channel 3 flow is settled
+#define GM_DOUT0_FLOW4_SETTLED             (12<<0)      // High while channel 4 flow is settled
+#define MSK_DOUT1_CONF                     (15<<0)      // Select DOUT1 function
 #define GM_DOUT1_SOFTWARE                  (0<<0)       // Digital output 1 controlled by software
 #define GM_DOUT1_START                     (1<<0)       // Equal to bit START
+#define GM_DOUT1_ADC_CLOCK                 (2<<0)       // Toggles on each ADC conversion start
+#define GM_DOUT1_HEARTBEAT                 (3<<0)       // Toggles on each closed loop iteration
+#define GM_DOUT1_SEQUENCE_PULSE            (4<<0)       // Pulses when a sequence starts
+#define GM_DOUT1_FLOW0_SETTLED             (8<<0)       // High while channel 0 flow is settled
+#define GM_DOUT1_FLOW1_SETTLED             (9<<0)       // High while channel 1 flow is settled
+#define GM_DOUT1_FLOW2_SETTLED             (10<<0)      // High while channel 2 flow is settled
+#define GM_DOUT1_FLOW3_SETTLED             (11<<0)      // High while channel 3 flow is settled
+#define GM_DOUT1_FLOW4_SETTLED             (12<<0)      // High while channel 4 flow is settled
 #define MSK_DIN0_CONF                      (3<<0)       // Select IN0 function
 #define GM_DIN0_SYNC                       (0<<0)       // Config as regular digital input
 #define GM_DIN0_RISE_START_FALL_STOP       (1<<0)       // On a rising edge will start the flowmeter and on a falling will stop it
 #define GM_DIN0_VALVE_TOGGLE               (2<<0)       // Toggles the end valves with a rising and falling edge
+#define GM_DIN0_START_SEQUENCE             (3<<0)       // On a rising edge will start the armed sequence
 #define MSK_MIMIC                          (3<<0)       //
 #define GM_MIMIC_NONE                      (0<<0)       // No mimic is selected
 #define GM_MIMIC_DO0                       (1<<0)       // Signal is reflected on DO0
 #define GM_MIMIC_DO1                       (2<<0)       // Signal is reflected on DO1
+#define GM_MIMIC_DO0_DO1                   (3<<0)       // Signal is reflected on DO0 and DO1
 #define B_EXT_CTRL_ENABLED                 (1<<0)       // Enabled the valves external control
+#define B_WARM_START                       (1<<0)       // Start the channels from their last converged duty cycle
+#define B_WARM_START_EEPROM                (1<<1)       // Save the warm start table to the EEPROM when the flow stops
+#define B_WARM_START_CLEAR                 (1<<2)       // Clear the warm start table
+#define MSK_PROFILE_CHANNEL                (7<<0)       // Channel of the calibration profile to save
+#define MSK_PROFILE_SLOT                   (3<<4)       // Slot of the calibration profile to save (1 to 3)
+#define MSK_CURVE_CHANNEL                  (7<<0)       // Channel of the calibration curve
+#define B_CURVE_SPLINE                     (1<<8)       // Sample a monotone spline through the points instead of straight segments
+#define MSK_SWEEP_CHANNEL                  (7<<0)       // Channel of the calibration sweep
+#define B_SWEEP_RUN                        (1<<7)       // The calibration sweep is running
+#define B_TOTAL_VOLUME_LATCH               (1<<6)       // Copy the volume of the channels to CHANNELS_TOTAL_VOLUME_LATCHED
+#define B_TOTAL_VOLUME_RESET               (1<<7)       // Restart the volume of the channels from zero
+#define B_MIX_ENABLE                       (1<<0)       // The setpoints are set from the total flow and the concentrations
+#define B_PROFILER_RESET                   (1<<0)       // Clears the data of every profiler site
+#define B_PROFILER_AVAILABLE               (1<<7)       // The firmware was built with ENABLE_PROFILER
+#define B_CPU_LOAD_EVENT                   (1<<0)       // Send CPU_LOAD each second
+#define B_CPU_LOAD_CLEAR                   (1<<1)       // Clear the missed ticks since reset
+#define MSK_CALIBRATION_SOURCE             (3<<0)       // Where the factory calibration in use was read from
+#define GM_CALIBRATION_BUILT_IN            (0<<0)       // Nothing valid in the EEPROM, the built-in tables are used
+#define GM_CALIBRATION_LEGACY              (1<<0)       // Legacy rows
+#define GM_CALIBRATION_RECORD              (2<<0)       // CRC checked record
+#define B_CALIBRATION_RECORD_DAMAGED       (1<<7)       // A record was found but failed its check
 #define MSK_CHANNEL3_RANGE_CONFIG          (3<<0)       // Available flow ranges for channel 3 (ml/min)
 #define GM_FLOW_100                        (0<<0)       // Range is 0-100ml/min
 #define GM_FLOW_1000                       (1<<0)       // Range is 0-1000ml/min
+#define GM_FLOW_AUTO                       (2<<0)       // Range follows the setpoint and the measured flow
 #define MSK_CHECK_VALVES_CONFIG            (3<<0)       // Check valves control configuration
 #define B_EVT0                             (1<<0)       // Events of register FLOWMETER_ANALOG_OUTPUTS
 #define B_EVT1                             (1<<1)       // Events of register DI0_STATE
 #define B_EVT2                             (1<<2)       // Events of register CHANNELS_ACTUAL_FLOW
+#define B_EVT3                             (1<<3)       // Events of register VALVES_EVENT
+#define B_EVT4                             (1<<4)       // Events of register VALVES_TRAIN_DONE
+#define B_EVT5                             (1<<5)       // Events of register SEQUENCE_CONTROL
+#define B_EVT6                             (1<<6)       // Events of registers FLOW_SETTLED and FLOW_SETTLE_TIME
+#define B_EVT7                             (1<<7)       // Events of registers CALIBRATION_SWEEP and CALIBRATION_SWEEP_DATA
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
@@ -3,14 +3,9 @@
 #include "app_funcs.h"
 #include "aux_funcs.h"
 
-extern status_PWM_DC_t status_DC;
 extern countdown_t pulse_countdown;
-extern uint8_t PWM_DC0_ready;
-extern uint8_t PWM_DC1_ready;
-extern uint8_t PWM_DC2_ready;
-extern uint8_t PWM_DC3_ready;
-extern uint8_t PWM_DC4_ready;
 extern AppRegs app_regs;
+extern flow_channel_t flow_channels[];
 
 
 /************************************************************************/
@@ -31,277 +26,201 @@ uint16_t get_divider(uint8_t prescaler)
 	}
 }
 
-uint8_t prescaler0, prescaler1, prescaler2, prescaler3, prescaler4;
-uint16_t target_count0, target_count1, target_count2, target_count3 ,target_count4;
-uint16_t duty_cycle0, duty_cycle1, duty_cycle2, duty_cycle3, duty_cycle4;
+uint8_t pwm_prescaler[FLOW_CHANNELS];
+uint16_t pwm_target_count[FLOW_CHANNELS];
+uint16_t pwm_duty_count[FLOW_CHANNELS];
+float pwm_duty_scale[FLOW_CHANNELS];
+uint8_t duty_fraction[FLOW_CHANNELS], dither_accumulator[FLOW_CHANNELS];
+
+#define DITHER_STEPS 256 // duty cycle resolution, in steps per timer count
+#define DITHER_INT_LEVEL(channel) ((app_regs.REG_PWM_DITHER & (1 << (channel))) ? INT_LEVEL_LOW : INT_LEVEL_OFF)
 
 /************************************************************************/
-/* Calculate valves PWM duty cycle value                                */
+/* Calculate valves PWM timer parameters                                */
 /************************************************************************/
-void hwbp_app_pwm_gen_update_dc0(void)
+/* Prescaler, period and the duty cycle scale only depend on the        */
+/* frequency, so they are computed here once and cached. The scale is   */
+/* in 1/DITHER_STEPS of a timer count.                                  */
+void hwbp_app_pwm_gen_update_dc(uint8_t channel)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CHANNEL0_FREQUENCY, &prescaler0, &target_count0))
+	if (calculate_timer_16bits(32000000, *flow_channels[channel].frequency, &pwm_prescaler[channel], &pwm_target_count[channel]))
 	{
-		duty_cycle0 = (((float)((uint16_t)(app_regs.REG_CHANNEL0_DUTY_CYCLE/100.0 * target_count0 + 0.5)) / target_count0)) * target_count0 + 0.5;
+		pwm_duty_scale[channel] = pwm_target_count[channel] * (DITHER_STEPS / 100.0);
+		hwbp_app_pwm_gen_set_dc(channel);
 	}
 }
 
-void hwbp_app_pwm_gen_update_dc1(void)
+
+/************************************************************************/
+/* Update valves PWM duty cycle                                         */
+/************************************************************************/
+/* The new compare value goes to CCABUF and only reaches CCA on the     */
+/* next period boundary, so a running PWM never sees a glitch. With     */
+/* dithering the fraction of a count is kept for the overflow ISR.      */
+static uint16_t duty_to_count(float duty_cycle, float duty_scale, uint8_t channel)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CHANNEL1_FREQUENCY, &prescaler1, &target_count1))
+	uint32_t steps = duty_cycle * duty_scale + 0.5;
+	
+	if (app_regs.REG_PWM_DITHER & (1 << channel))
 	{
-		duty_cycle1 = (((float)((uint16_t)(app_regs.REG_CHANNEL1_DUTY_CYCLE/100.0 * target_count1 + 0.5)) / target_count1)) * target_count1 + 0.5;
+		duty_fraction[channel] = steps % DITHER_STEPS;
+		return steps / DITHER_STEPS;
 	}
+	
+	return (steps + DITHER_STEPS / 2) / DITHER_STEPS;
 }
 
-void hwbp_app_pwm_gen_update_dc2(void)
+void hwbp_app_pwm_gen_set_dc(uint8_t channel)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CHANNEL2_FREQUENCY, &prescaler2, &target_count2))
-	{
-		duty_cycle2 = (((float)((uint16_t)(app_regs.REG_CHANNEL2_DUTY_CYCLE/100.0 * target_count2 + 0.5)) / target_count2)) * target_count2 + 0.5;
-	}
+	uint8_t sreg = SREG;
+	
+	cli();
+	pwm_duty_count[channel] = duty_to_count(*flow_channels[channel].duty_cycle, pwm_duty_scale[channel], channel);
+	flow_channels[channel].timer->CCABUF = pwm_duty_count[channel];
+	SREG = sreg;
 }
 
-void hwbp_app_pwm_gen_update_dc3(void)
-{	
-	if (calculate_timer_16bits(32000000, app_regs.REG_CHANNEL3_FREQUENCY, &prescaler3, &target_count3))
-	{
-		duty_cycle3 = (((float)((uint16_t)(app_regs.REG_CHANNEL3_DUTY_CYCLE/100.0 * target_count3 + 0.5)) / target_count3)) * target_count3 + 0.5;
-	}
-}
 
-void hwbp_app_pwm_gen_update_dc4(void)
+/************************************************************************/
+/* Enable or disable the duty cycle dithering                           */
+/************************************************************************/
+void hwbp_app_pwm_gen_update_dither(void)
 {
-	if (calculate_timer_16bits(32000000, app_regs.REG_CHANNEL4_FREQUENCY, &prescaler4, &target_count4))
+	for (uint8_t i = 0; i < FLOW_CHANNELS; i++)
 	{
-		duty_cycle4 = (((float)((uint16_t)(app_regs.REG_CHANNEL4_DUTY_CYCLE/100.0 * target_count4 + 0.5)) / target_count4)) * target_count4 + 0.5;
+		flow_channels[i].timer->INTCTRLA = DITHER_INT_LEVEL(i);
+		hwbp_app_pwm_gen_set_dc(i);
 	}
 }
 
 
 /************************************************************************/
-/* Start valves PWM generation                                          */
+/* Phase stagger of the valves PWM                                      */
 /************************************************************************/
-
-uint8_t hwbp_app_pwm_gen_start_ch0()
-{
-	if (!(TCC0_CTRLA))
+/* A channel that starts while another one runs with the same prescaler */
+/* and period is locked to it with the PWM_PHASE difference, so the     */
+/* coil inrush currents of the valves do not add up.                    */
+static void align_pwm_phase(uint8_t channel)
+{
+	TC0_t* timer = flow_channels[channel].timer;
+	TC0_t* reference = 0;
+	uint32_t period = (uint32_t)timer->PER + 1;
+	uint32_t shift;
+	uint32_t count;
+	uint8_t sreg;
+	uint8_t i;
+	
+	for (i = 0; i < FLOW_CHANNELS; i++)
 	{
-		timer_type0_pwm(&TCC0, prescaler0, target_count0, duty_cycle0, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		return 1;
-	}   
-    return 0;    
-}
-
-
-uint8_t hwbp_app_pwm_gen_start_ch1(void)
-{
-	if (!(TCD0_CTRLA))
-    {
-		timer_type0_pwm(&TCD0, prescaler1, target_count1, duty_cycle1, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		return 1;
-    }            
-    return 0;
+		reference = flow_channels[i].timer;
+		
+		if (i != channel && reference->CTRLA && reference->CTRLA == timer->CTRLA && reference->PER == timer->PER)
+			break;
+	}
+	
+	if (i == FLOW_CHANNELS)
+		return;
+	
+	/* The shift is worked out first, so only an add and a compare         */
+	/* sit between the read of the reference and the write of CNT          */
+	shift = (uint32_t)((app_regs.REG_PWM_PHASE[i] + 100 - app_regs.REG_PWM_PHASE[channel]) % 100) * period / 100;
+	
+	sreg = SREG;
+	cli();
+	count = reference->CNT + shift;
+	if (count >= period)
+		count -= period;
+	timer->CNT = count;
+	SREG = sreg;
 }
 
-uint8_t hwbp_app_pwm_gen_start_ch2(void)
-{
-	if (!(TCE0_CTRLA))
-    {
-		timer_type0_pwm(&TCE0, prescaler2, target_count2, duty_cycle2, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		return 1;
-    }            
-	return 0;
-}
 
-uint8_t hwbp_app_pwm_gen_start_ch3(void)
+/************************************************************************/
+/* Start valves PWM generation                                          */
+/************************************************************************/
+uint8_t hwbp_app_pwm_gen_start(uint8_t channel)
 {
-	if (!(TCF0_CTRLA))
+	TC0_t* timer = flow_channels[channel].timer;
+	
+	if (timer->CTRLA)
+		return 0;
+	
+	if (!flow_channels[channel].timer_type1)
 	{
-	    timer_type0_pwm(&TCF0, prescaler3, target_count3, duty_cycle3, INT_LEVEL_LOW, INT_LEVEL_LOW);
-		return 1;
-	}            
-    return 0;
-}
-
-uint8_t hwbp_app_pwm_gen_start_ch4(void)
-{
-	// PWM mode for this timer was not implemented in core
-	if (!(TCD1_CTRLA)){
-		
-		TC1_t* timer = &TCD1;
-		uint8_t prescaler = prescaler4;
-		uint16_t target_count = target_count4;
-		uint16_t duty_cycle_count = duty_cycle4;
-		uint8_t int_level_ovf = INT_LEVEL_LOW;
-		uint8_t int_level_cca = INT_LEVEL_LOW;
-		
+		timer_type0_pwm(timer, pwm_prescaler[channel], pwm_target_count[channel], pwm_duty_count[channel], DITHER_INT_LEVEL(channel), INT_LEVEL_OFF);
+	}
+	else
+	{
+		// PWM mode for this timer was not implemented in core
 		timer->CTRLA = TC_CLKSEL_OFF_gc;		// Make sure timer is stopped to make reset
 		timer->CTRLFSET = TC_CMD_RESET_gc;		// Timer reset (registers to initial value)
-		timer->PER = target_count-1;			// Set up target
-		timer->CCA = duty_cycle_count;		    // Set duty cycle
-		timer->INTCTRLA = int_level_ovf;		// Enable overflow interrupt
-		timer->INTCTRLB = int_level_cca;		// Enable compare interrupt on channel A
+		timer->PER = pwm_target_count[channel]-1;	// Set up target
+		timer->CCA = pwm_duty_count[channel];	// Set duty cycle
+		timer->INTCTRLA = DITHER_INT_LEVEL(channel);	// Enable overflow interrupt
+		timer->INTCTRLB = INT_LEVEL_OFF;		// Enable compare interrupt on channel A
 		timer->CTRLB = TC1_CCAEN_bm | TC_WGMODE_SINGLESLOPE_gc; // Enable channel B and single slope mode
-		timer->CTRLA = prescaler;				// Start timer
-		return 1;
+		timer->CTRLA = pwm_prescaler[channel];	// Start timer
 	}
-    return 0;    
+	
+	align_pwm_phase(channel);
+	return 1;
 }
 
 
 /************************************************************************/
 /* Stop valves PWM generation                                           */
 /************************************************************************/
-
-uint8_t hwbp_app_pwm_gen_stop_ch0(void)
+uint8_t hwbp_app_pwm_gen_stop(uint8_t channel)
 {
-	if (TCC0_CTRLA)
-    {
-        timer_type0_stop(&TCC0);
-		return 1;
-	}
+	TC0_t* timer = flow_channels[channel].timer;
 	
-	return 0;
-}
-
-
-uint8_t hwbp_app_pwm_gen_stop_ch1(void)
-{
-	if (TCD0_CTRLA)
-	{
-    	timer_type0_stop(&TCD0);
-		return 1;
-    }
-    
-    return 0;
-}
-
-uint8_t hwbp_app_pwm_gen_stop_ch2(void)
-{
-	if (TCE0_CTRLA)
-	{
-    	timer_type0_stop(&TCE0);
-		return 1;
-    }
-    
-    return 0;
+	if (!timer->CTRLA)
+		return 0;
+	
+	if (!flow_channels[channel].timer_type1)
+		timer_type0_stop(timer);
+	else
+		timer_type1_stop((TC1_t*)timer);
+	
+	return 1;
 }
 
-uint8_t hwbp_app_pwm_gen_stop_ch3(void)
-{
-	if (TCF0_CTRLA)
-	{
-    	timer_type0_stop(&TCF0);
-		return 1;
-    }
-    
-    return 0;
-}
-
-uint8_t hwbp_app_pwm_gen_stop_ch4(void)
-{
-	if (TCD1_CTRLA)
-	{
-    	timer_type1_stop(&TCD1);
-		return 1;
-    }
-    
-    return 0;
-}
 
 /************************************************************************/
-/* PWM interrupts                                                       */
+/* PWM dithering interrupts                                             */
 /************************************************************************/
-ISR(TCC0_OVF_vect, ISR_NAKED)
-{
-	if(status_DC.DC0_ready){
-		hwbp_app_pwm_gen_update_dc0();
-		TC0_t* timer = &TCC0;
-		timer->CCA = duty_cycle0;
-		status_DC.DC0_ready = 0;
-	}
-	reti();
-}
-
-ISR(TCC0_CCA_vect, ISR_NAKED)
-{
-	reti();
-}
-
-
-ISR(TCD1_OVF_vect, ISR_NAKED)
+/* Each period adds the duty fraction to an accumulator and the carry   */
+/* extends the next period by one count, so the average duty cycle has  */
+/* 1/DITHER_STEPS of a count resolution (first order sigma-delta).      */
+static inline void dither_pwm(uint8_t channel)
 {
-	if(status_DC.DC4_ready){
-		hwbp_app_pwm_gen_update_dc4();
-		TC1_t* timer = &TCD1;
-		timer->CCA = duty_cycle4;
-		status_DC.DC4_ready = 0;
-	}
-	reti();
-}
-
-ISR(TCD1_CCA_vect, ISR_NAKED)
-{
-	reti();
+	uint16_t accumulator = dither_accumulator[channel] + duty_fraction[channel];
+	
+	dither_accumulator[channel] = accumulator;
+	flow_channels[channel].timer->CCABUF = pwm_duty_count[channel] + accumulator / DITHER_STEPS;
 }
 
-
-ISR(TCD0_OVF_vect, ISR_NAKED)
+ISR(TCC0_OVF_vect)
 {
-	if(status_DC.DC1_ready){
-		hwbp_app_pwm_gen_update_dc1();
-		TC0_t* timer = &TCD0;
-		timer->CCA = duty_cycle1;
-		status_DC.DC1_ready = 0;
-	}
-	reti();
+	dither_pwm(0);
 }
 
-ISR(TCD0_CCA_vect, ISR_NAKED)
+ISR(TCD0_OVF_vect)
 {
-	reti();
+	dither_pwm(1);
 }
 
-ISR(TCE0_OVF_vect, ISR_NAKED)
+ISR(TCE0_OVF_vect)
 {
-	if(status_DC.DC2_ready){
-		hwbp_app_pwm_gen_update_dc2();
-		TC0_t* timer = &TCE0;
-		timer->CCA = duty_cycle2;
-		status_DC.DC2_ready = 0;
-	}
-	reti();
+	dither_pwm(2);
 }
 
-ISR(TCE0_CCA_vect, ISR_NAKED)
+ISR(TCF0_OVF_vect)
 {
-	reti();
+	dither_pwm(3);
 }
 
-
-ISR(TCF0_OVF_vect, ISR_NAKED)
+ISR(TCD1_OVF_vect)
 {
-	if(status_DC.DC3_ready){
-		hwbp_app_pwm_gen_update_dc3();
-		TC0_t* timer = &TCF0;
-		timer->CCA = duty_cycle3;
-		status_DC.DC3_ready = 0;
-	}
-	reti();
+	dither_pwm(4);
 }
-
-ISR(TCF0_CCA_vect, ISR_NAKED)
-{
-	reti();
-}
-
-
-
-
-
-
-
-
-
-
@@ -5,18 +5,75 @@
 /************************************************************************/
 /* Shared structures                                                    */
 /************************************************************************/
+#define FLOW_CHANNELS 5
+
 typedef struct
 {
-	uint8_t DC0_ready, DC1_ready, DC2_ready, DC3_ready, DC4_ready;
-	bool flow0_update, flow1_update, flow2_update, flow3_update, flow4_update;
+	bool flow_update[FLOW_CHANNELS];
 	
 } status_PWM_DC_t;
 
+#define CALIBRATION_POINTS 11           // Calibration points per table, one each 10% of the range
+#define CALIBRATION_PROFILES 3          // Calibration profiles stored per channel
+#define CALIBRATION_PROFILE_NAME_SIZE 8
+#define CALIBRATION_CURVE_POINTS 32     // Maximum points of an uploaded calibration curve
+#define CALIBRATION_CURVE_SIZE (2 + CALIBRATION_CURVE_POINTS * 2)
+#define CALIBRATION_LUT_POINTS (CALIBRATION_CURVE_POINTS + 2)
+#define CALIBRATION_LUT_BUCKETS 32      // One bucket each 1024 ADC codes
+
+/* Calibration compiled for the control loop: the points sorted by ADC  */
+/* code, from the zero code to past the last point, and for each bucket */
+/* of codes the first point above it, so a lookup only scans a few.     */
+typedef struct
+{
+	uint16_t code[CALIBRATION_LUT_POINTS];
+	float flow[CALIBRATION_LUT_POINTS];
+	uint8_t points;
+	uint8_t bucket[CALIBRATION_LUT_BUCKETS];
+} calibration_lut_t;
+
+/* Everything that differs between the flow channels. The control loop, */
+/* the PWM generation and the register handlers are written once and    */
+/* index this table, so a channel is added by adding a descriptor.      */
+typedef struct
+{
+	TC0_t *timer;                 // Valve PWM timer
+	bool timer_type1;             // The timer is a TC1_t, same offsets for the registers used
+	uint16_t *frequency;          // REG_CHANNELx_FREQUENCY
+	float *target_flow;           // REG_CHANNELx_TARGET_FLOW
+	float *actual_flow;           // REG_CHANNELx_ACTUAL_FLOW
+	float *duty_cycle;            // REG_CHANNELx_DUTY_CYCLE
+	uint16_t *calibration;        // Factory calibration, loaded from the EEPROM
+	uint16_t *user_calibration;   // REG_CHANNELx_USER_CALIBRATION
+	calibration_lut_t *lut;       // Compiled from the calibration in use
+	uint16_t full_scale;          // Flow range (ml/min)
+	uint16_t overflow_flow;       // Flow assumed above the last calibration point (ml/min)
+	float temperature_gain;       // Calibration counts per temperature unit
+	uint16_t gain_divider;        // The duty cycle moves by the flow error over this
+	uint8_t mfc;                  // MFC address, when the board drives MFCs
+	uint8_t mfc_divider;          // Scales the decade calibration used with MFCs
+	uint8_t add_actual_flow;      // ADD_REG_CHANNELx_ACTUAL_FLOW, sent as event
+} flow_channel_t;
+
 typedef struct
 {
 	uint16_t uart, valve0, valve1, valve2, valve3, valveaux0, valveaux1, valvedummy, chkvalve0, chkvalve1, chkvalve2, chkvalve3, delayvalve0chk, delayvalve1chk, delayvalve2chk, delayvalve3chk;
 } countdown_t;
 
+#define TRAIN_VALVES 7
+typedef struct
+{
+	uint16_t countdown[TRAIN_VALVES], remaining[TRAIN_VALVES];
+	uint8_t active, on;
+} trains_t;
+
+typedef struct
+{
+	uint16_t time, valves;
+	uint8_t outputs, settle;
+	float flows[FLOW_CHANNELS];
+} sequence_step_t;
+
 
 /************************************************************************/
 /* Get decimal divider from prescaler                                   */
@@ -24,30 +81,28 @@ typedef struct
 uint16_t get_divider(uint8_t prescaler);
 
 /************************************************************************/
-/* Calculate PWM duty cycle value                                       */
+/* Calculate PWM timer parameters (on frequency change)                 */
+/************************************************************************/
+void hwbp_app_pwm_gen_update_dc(uint8_t channel);
+
+/************************************************************************/
+/* Update PWM duty cycle (on duty cycle change)                         */
+/************************************************************************/
+void hwbp_app_pwm_gen_set_dc(uint8_t channel);
+
+/************************************************************************/
+/* Enable PWM dithering (on PWM_DITHER change)                          */
 /************************************************************************/
-void hwbp_app_pwm_gen_update_dc0(void);
-void hwbp_app_pwm_gen_update_dc1(void);
-void hwbp_app_pwm_gen_update_dc2(void);
-void hwbp_app_pwm_gen_update_dc3(void);
-void hwbp_app_pwm_gen_update_dc4(void);
+void hwbp_app_pwm_gen_update_dither(void);
 
 /************************************************************************/
 /* Start PWM generation                                                 */
 /************************************************************************/
-uint8_t hwbp_app_pwm_gen_start_ch0(void);
-uint8_t hwbp_app_pwm_gen_start_ch1(void);
-uint8_t hwbp_app_pwm_gen_start_ch2(void);
-uint8_t hwbp_app_pwm_gen_start_ch3(void);
-uint8_t hwbp_app_pwm_gen_start_ch4(void);
+uint8_t hwbp_app_pwm_gen_start(uint8_t channel);
 
 /************************************************************************/
 /* Stop PWM generation                                                  */
 /************************************************************************/
-uint8_t hwbp_app_pwm_gen_stop_ch0(void);
-uint8_t hwbp_app_pwm_gen_stop_ch1(void);
-uint8_t hwbp_app_pwm_gen_stop_ch2(void);
-uint8_t hwbp_app_pwm_gen_stop_ch3(void);
-uint8_t hwbp_app_pwm_gen_stop_ch4(void);
+uint8_t hwbp_app_pwm_gen_stop(uint8_t channel);
 
 #endif /* _AUX_FUNCS_H_ */
\ No newline at end of file
@@ -2,7 +2,9 @@
 #include "hwbp_core_types.h"
 #include "app_ios_and_regs.h"
 #include "app_funcs.h"
+#include "app.h"
 #include "hwbp_core.h"
+#include "profiler.h"
 
 
 /************************************************************************/
@@ -10,6 +12,7 @@
 /************************************************************************/
 extern AppRegs app_regs;
 
+/* Last state of the external control inputs, in valve bits */
 uint8_t aux_isolation = 0;
 uint8_t aux_end = 0;
 uint16_t aux_check = 0;
@@ -35,34 +38,89 @@ uint16_t aux_check = 0;
 /************************************************************************/
 /* External Valve Control Signals                                       */
 /************************************************************************/
-
-ISR(PORTA_INT0_vect, ISR_NAKED)
+/* The valves are switched with one OUTCLR and one OUTSET per port as   */
+/* soon as the ISR starts. Only the inputs that changed since the last  */
+/* interrupt are applied. Mimics, registers and countdowns are updated  */
+/* after the valves have already switched.                              */
+ISR(PORTA_INT0_vect)
 {
 
 	if (app_regs.REG_ENABLE_VALVE_EXT_CTRL == B_EXT_CTRL_ENABLED){
 		
-		aux_isolation = ( ((read_VALVE3CTRL) & 0x08) | ((read_VALVE2CTRL) & 0x04) | ((read_VALVE1CTRL) & 0x02) | ((read_VALVE0CTRL) & 0x01) );
-		aux_end = ( ((read_FLUSHVALVECTRL) & 0x20) | ((read_ENDVALVECTRL) & 0x10) );
+		/* PA0..PA5 are VALVE0CTRL..VALVE3CTRL, ENDVALVECTRL and FLUSHVALVECTRL, the same bits as B_VALVE0..B_ENDVALVE1 */
+		uint8_t in = PORTA.IN & (MSK_ODOR_VALVES | B_ENDVALVE0 | B_ENDVALVE1);
+		uint8_t changed = in ^ (aux_isolation | aux_end);
+		uint8_t on = in & changed;
+		uint8_t off = ~in & changed;
+		uint32_t seconds = 0;
+		uint16_t useconds = 0;
+		
+		PORTC.OUTCLR = (off << 1) & 0x02;                         // VALVE0
+		PORTD.OUTCLR = (off & 0x02) | ((off >> 2) & 0x0C);        // VALVE1, ENDVALVE0 and ENDVALVE1
+		PORTE.OUTCLR = (off >> 1) & 0x02;                         // VALVE2
+		PORTF.OUTCLR = (off >> 2) & 0x02;                         // VALVE3
+		PORTC.OUTSET = (on << 1) & 0x02;
+		PORTD.OUTSET = (on & 0x02) | ((on >> 2) & 0x0C);
+		PORTE.OUTSET = (on >> 1) & 0x02;
+		PORTF.OUTSET = (on >> 2) & 0x02;
+		
+		if ((app_regs.REG_ENABLE_EVENTS & B_EVT3) && changed)
+		{
+			seconds = core_func_read_R_TIMESTAMP_SECOND();
+			useconds = core_func_read_R_TIMESTAMP_MICRO();
+		}
+		
+		write_valves_mimic(on, off);
+		arm_valves_countdown(on, off);
+		
+		aux_isolation = in & MSK_ODOR_VALVES;
+		aux_end = in & (B_ENDVALVE0 | B_ENDVALVE1);
 		
-		app_write_REG_ODOR_VALVES_STATE(&aux_isolation);
-		app_write_REG_END_VALVES_STATE(&aux_end);
+		app_regs.REG_ODOR_VALVES_STATE = aux_isolation;
+		app_regs.REG_END_VALVES_STATE = (app_regs.REG_END_VALVES_STATE & B_DUMMYVALVE) | aux_end;
 		
+		if ((app_regs.REG_ENABLE_EVENTS & B_EVT3) && changed)
+			send_valves_event(changed, read_valves(), seconds, useconds);
 	}
-	
-	reti();
 }
 
-ISR(PORTK_INT0_vect, ISR_NAKED)
+ISR(PORTK_INT0_vect)
 {
 
 	if (app_regs.REG_ENABLE_VALVE_EXT_CTRL == B_EXT_CTRL_ENABLED){
 		
-		aux_check = ( ((read_VALVE3CHKCTRL) & 0x20) | ((read_VALVE2CHKCTRL) & 0x02) | ((read_VALVE1CHKCTRL) & 0x40) | ((read_VALVE0CHKCTRL) & 0x10) );
-
-		app_write_REG_CHECK_VALVES_STATE(&aux_check);
+		/* PK4, PK6, PK1 and PK5 are VALVE0CHKCTRL..VALVE3CHKCTRL */
+		uint8_t in = PORTK.IN;
+		uint16_t state = ((in & 0x10) ? B_CHECK_VALVE0 : 0) | ((in & 0x40) ? B_CHECK_VALVE1 : 0) |
+		                 ((in & 0x02) ? B_CHECK_VALVE2 : 0) | ((in & 0x20) ? B_CHECK_VALVE3 : 0);
+		uint16_t changed = (state ^ aux_check) & ~app_regs.REG_ENABLE_CHECK_VALVES_SYNC;
+		uint16_t on = state & changed;
+		uint16_t off = ~state & changed;
+		uint32_t seconds = 0;
+		uint16_t useconds = 0;
+		
+		PORTD.OUTCLR = ((off & B_CHECK_VALVE0) ? (1<<5) : 0) | ((off & B_CHECK_VALVE1) ? (1<<7) : 0);
+		PORTE.OUTCLR = (off & B_CHECK_VALVE2) ? (1<<3) : 0;
+		PORTF.OUTCLR = (off & B_CHECK_VALVE3) ? (1<<5) : 0;
+		PORTD.OUTSET = ((on & B_CHECK_VALVE0) ? (1<<5) : 0) | ((on & B_CHECK_VALVE1) ? (1<<7) : 0);
+		PORTE.OUTSET = (on & B_CHECK_VALVE2) ? (1<<3) : 0;
+		PORTF.OUTSET = (on & B_CHECK_VALVE3) ? (1<<5) : 0;
+		
+		if ((app_regs.REG_ENABLE_EVENTS & B_EVT3) && changed)
+		{
+			seconds = core_func_read_R_TIMESTAMP_SECOND();
+			useconds = core_func_read_R_TIMESTAMP_MICRO();
+		}
+		
+		write_valves_mimic(on, off);
+		arm_valves_countdown(on, off);
+		
+		aux_check = (aux_check & ~changed) | (state & changed);
+		app_regs.REG_CHECK_VALVES_STATE = (app_regs.REG_CHECK_VALVES_STATE & ~changed) | on;
+		
+		if ((app_regs.REG_ENABLE_EVENTS & B_EVT3) && changed)
+			send_valves_event(changed, read_valves(), seconds, useconds);
 	}
-	
-	reti();
 }
 
 
@@ -70,8 +128,10 @@ ISR(PORTK_INT0_vect, ISR_NAKED)
 /* Data ADC Busy Interrupt (CONVST-> BUSY)                              */
 /************************************************************************/
 
-ISR(PORTH_INT0_vect, ISR_NAKED)
+ISR(PORTH_INT0_vect)
 {
+	PROFILER_ENTRY(PROFILER_ADC_ISR);
+	
 	if (!read_BUSY)
 	{
 		clr_CONVST;
@@ -89,6 +149,7 @@ ISR(PORTH_INT0_vect, ISR_NAKED)
 		}
 		
 		clr_CS_ADC;
+		adc_frame_ready();
 		
 		if (app_regs.REG_ENABLE_EVENTS & B_EVT0)
 		{
@@ -96,48 +157,73 @@ ISR(PORTH_INT0_vect, ISR_NAKED)
 		}
 	}
 	
-	reti();
+	PROFILER_EXIT(PROFILER_ADC_ISR);
 }
 
 
 /************************************************************************/
 /* IN00                                                                 */
 /************************************************************************/
+/* IN0 edges are captured by TCE1 (2 us per count) through the event    */
+/* channel 7, so the edge time does not depend on the interrupt         */
+/* latency. With REG_DI0_DEBOUNCE, an edge is only accepted if the new  */
+/* level is still there once that time has passed since the last edge.  */
 uint8_t previous_in0;
+uint16_t in0_capture;
 
-ISR(PORTB_INT0_vect, ISR_NAKED)
+static void in0_timestamp(uint16_t capture, uint32_t *seconds, uint16_t *useconds)
 {
-	uint8_t aux = read_IN0;
+	uint16_t elapsed;
+	uint8_t sreg = SREG;
+	
+	cli();
+	*seconds = core_func_read_R_TIMESTAMP_SECOND();
+	*useconds = core_func_read_R_TIMESTAMP_MICRO();
+	elapsed = (uint16_t)(TCE1.CNT - capture) >> 4;     // 2 us counts to 32 us
+	SREG = sreg;
+	
+	if (*useconds < elapsed)
+	{
+		*useconds += 31250;
+		(*seconds)--;
+	}
+	*useconds -= elapsed;
+}
+
+static void in0_edge(uint8_t aux, uint16_t capture)
+{
+	uint32_t seconds;
+	uint16_t useconds;
 	
 	app_regs.REG_DI0_STATE = aux;
 	app_write_REG_DI0_STATE(&app_regs.REG_DI0_STATE);
 	
 	if (app_regs.REG_ENABLE_EVENTS & B_EVT1){
-		// transition from low to high
-		if(previous_in0 == 0 && aux == 1)
-		{
-			core_func_send_event(ADD_REG_DI0_STATE, true);
-		}
-		// transition from high to low
-		else{
-			core_func_send_event(ADD_REG_DI0_STATE, false);
-		}
+		in0_timestamp(capture, &seconds, &useconds);
+		send_event_at(ADD_REG_DI0_STATE, seconds, useconds);
 	}
 
 	if((app_regs.REG_DI0_TRIGGER & MSK_DIN0_CONF) == GM_DIN0_VALVE_TOGGLE ){
 	   
 		if(previous_in0 == 0 && aux == 1)
 		{
-			set_ENDVALVE0;
-			//set_ENDVALVE1;
+			write_valves(B_ENDVALVE0, 0);
+			//write_valves(B_ENDVALVE1, 0);
 		} else {
-			clr_ENDVALVE0;
-			//clr_ENDVALVE1;
+			write_valves(0, B_ENDVALVE0);
+			//write_valves(0, B_ENDVALVE1);
 		}
 	}
     
 
 	if((app_regs.REG_DI0_TRIGGER & MSK_DIN0_CONF) == GM_DIN0_SYNC ) {}
+	
+	if((app_regs.REG_DI0_TRIGGER & MSK_DIN0_CONF) == GM_DIN0_START_SEQUENCE )
+	{
+		// transition from low to high - start the armed sequence
+		if(previous_in0 == 0 && aux == 1 && app_regs.REG_SEQUENCE_CONTROL == GM_SEQUENCE_ARMED)
+			start_sequence();
+	}
 		
 		
 	if((app_regs.REG_DI0_TRIGGER & MSK_DIN0_CONF) == GM_DIN0_RISE_START_FALL_STOP )
@@ -156,6 +242,45 @@ ISR(PORTB_INT0_vect, ISR_NAKED)
 	}
 	
 	previous_in0 = aux;
+}
+
+ISR(PORTB_INT0_vect)
+{
+	uint16_t capture;
+	uint16_t debounce = app_regs.REG_DI0_DEBOUNCE >> 1;
+	uint8_t aux;
+	
+	/* Keep the most recent capture, or the current count without one */
+	if (TCE1.INTFLAGS & TC1_CCAIF_bm)
+	{
+		do {
+			capture = TCE1.CCA;
+		} while (TCE1.INTFLAGS & TC1_CCAIF_bm);
+	}
+	else
+		capture = TCE1.CNT;
+	
+	if (debounce == 0 || (uint16_t)(TCE1.CNT - capture) >= debounce)
+	{
+		aux = read_IN0;
+		if (aux != previous_in0)
+			in0_edge(aux, capture);
+	}
+	else
+	{
+		in0_capture = capture;
+		TCE1.CCB = capture + debounce;
+		TCE1.INTFLAGS = TC1_CCBIF_bm;
+		TCE1.INTCTRLB = TC_CCBINTLVL_LO_gc;
+	}
+}
+
+ISR(TCE1_CCB_vect)
+{
+	uint8_t aux = read_IN0;
+	
+	TCE1.INTCTRLB = TC_CCBINTLVL_OFF_gc;
 	
-	reti();
+	if (aux != previous_in0)
+		in0_edge(aux, in0_capture);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 
 #include "app.h"
 #include "app_ios_and_regs.h"
+#include "profiler.h"
 
 int main(void)
 {
@@ -11,7 +12,8 @@ int main(void)
 	/* Enable interrupts */
 	hwbp_app_enable_interrupts;
 	
-	/* Infinite loop */
-	while(1);
+	/* Infinite loop, counting the cycles the interrupts leave */
+	while(1)
+		idle_loop();
 		//__asm volatile("sleep");
 }
\ No newline at end of file
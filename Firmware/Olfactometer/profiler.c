@@ -0,0 +1,279 @@
+#include "cpu.h"
+#include "hwbp_core.h"
+#include "app_ios_and_regs.h"
+#include "app_funcs.h"
+#include "aux_funcs.h"
+#include "profiler.h"
+
+extern AppRegs app_regs;
+
+
+/************************************************************************/
+/* Free running cycle counter                                           */
+/************************************************************************/
+uint16_t cycle_count_high;
+
+void init_cycle_counter(void)
+{
+	CYCLE_COUNTER.CTRLA = TC_CLKSEL_OFF_gc;
+	CYCLE_COUNTER.CTRLB = TC_WGMODE_NORMAL_gc;
+	CYCLE_COUNTER.PER = 0xFFFF;
+	CYCLE_COUNTER.CNT = 0;
+	CYCLE_COUNTER.INTCTRLA = INT_LEVEL_HIGH;
+	CYCLE_COUNTER.CTRLA = TC_CLKSEL_DIV1_gc;
+}
+
+ISR(TCF1_OVF_vect)
+{
+	cycle_count_high++;
+}
+
+/* An overflow not yet served belongs to a low count read after it */
+uint32_t cycle_count32(void)
+{
+	uint8_t sreg = SREG;
+	uint16_t high;
+	uint16_t low;
+	
+	cli();
+	high = cycle_count_high;
+	low = cycle_count();
+	if ((CYCLE_COUNTER.INTFLAGS & TC1_OVFIF_bm) && low < 0x8000)
+		high++;
+	SREG = sreg;
+	
+	return ((uint32_t)high << 16) | low;
+}
+
+
+/************************************************************************/
+/* Execution time profiler                                              */
+/************************************************************************/
+/* Recorded from the site itself, usually an interrupt, so it only      */
+/* compares and adds. The mean is divided out when it is read. The      */
+/* count stops at 65535 so the sum cannot overflow, min and max go on.  */
+profiler_site_t profiler_sites[PROFILER_SITES];
+
+void profiler_record(uint8_t site, uint16_t cycles)
+{
+	profiler_site_t *data = &profiler_sites[site];
+	uint8_t bin = 0;
+	uint16_t bound = 256;
+
+	if (data->count == 0 || cycles < data->min)
+		data->min = cycles;
+	if (cycles > data->max)
+		data->max = cycles;
+
+	if (data->count < 0xFFFF)
+	{
+		data->count++;
+		data->sum += cycles;
+	}
+
+	while (bin < PROFILER_BINS - 1 && cycles >= bound)
+	{
+		bin++;
+		bound <<= 1;
+	}
+
+	if (data->bins[bin] < 0xFFFF)
+		data->bins[bin]++;
+}
+
+void profiler_reset(void)
+{
+	uint8_t sreg = SREG;
+
+	cli();
+	for (uint8_t i = 0; i < sizeof(profiler_sites); i++)
+		((uint8_t*)profiler_sites)[i] = 0;
+	SREG = sreg;
+}
+
+/* data: count, min, max, mean and the bins, in cycles */
+void profiler_read(uint8_t site, uint16_t *data)
+{
+	profiler_site_t copy;
+	uint8_t sreg = SREG;
+
+	cli();
+	copy = profiler_sites[site];
+	SREG = sreg;
+
+	data[0] = copy.count;
+	data[1] = copy.min;
+	data[2] = copy.max;
+	data[3] = copy.count ? copy.sum / copy.count : 0;
+
+	for (uint8_t i = 0; i < PROFILER_BINS; i++)
+		data[4 + i] = copy.bins[i];
+}
+
+
+/************************************************************************/
+/* CPU load                                                             */
+/************************************************************************/
+/* The main loop only reads the cycle counter. A gap longer than one    */
+/* pass of the loop is time taken by the interrupts, the shorter ones   */
+/* are added as idle. The 1 ms tick turns the idle time of the slot     */
+/* into its load and a missed tick, the new second publishes them.      */
+#define IDLE_GAP 64           // cycles, more than one pass of the idle loop
+#define MISSED_TICK_CYCLES (CYCLES_PER_MS * 3 / 2)
+
+uint32_t idle_cycles;         // idle cycles since boot, wraps
+uint32_t load_slot_start;
+uint32_t load_slot_idle;
+uint32_t load_second_start;
+uint32_t load_second_idle;
+uint16_t load_slot_peak;      // busy cycles of the busiest slot this second
+uint16_t load_second_missed;
+
+void idle_loop(void)
+{
+	uint16_t last = cycle_count();
+	uint16_t now;
+	uint16_t elapsed;
+	uint8_t sreg;
+	
+	while (1)
+	{
+		now = cycle_count();
+		elapsed = now - last;
+		last = now;
+		
+		if (elapsed < IDLE_GAP)
+		{
+			sreg = SREG;
+			cli();
+			idle_cycles += elapsed;
+			SREG = sreg;
+		}
+	}
+}
+
+void cpu_load_tick(void)
+{
+	uint32_t now = cycle_count32();
+	uint32_t idle = idle_cycles;
+	uint32_t elapsed = now - load_slot_start;
+	uint32_t idle_slot = idle - load_slot_idle;
+	uint32_t busy = (idle_slot < elapsed) ? elapsed - idle_slot : 0;
+	
+	/* Nothing to compare the first tick with */
+	if (load_slot_start)
+	{
+		if (busy > load_slot_peak)
+			load_slot_peak = (busy > 0xFFFF) ? 0xFFFF : busy;
+		
+		/* The ticks that should have come in between */
+		if (elapsed > MISSED_TICK_CYCLES)
+		{
+			uint16_t missed = (elapsed + CYCLES_PER_MS / 2) / CYCLES_PER_MS - 1;
+			
+			load_second_missed += missed;
+			app_regs.REG_CPU_LOAD[3] = (app_regs.REG_CPU_LOAD[3] > 0xFFFF - missed) ? 0xFFFF : app_regs.REG_CPU_LOAD[3] + missed;
+		}
+	}
+	
+	load_slot_start = now;
+	load_slot_idle = idle;
+}
+
+void cpu_load_second(void)
+{
+	uint32_t now = cycle_count32();
+	uint32_t idle = idle_cycles - load_second_idle;
+	uint32_t elapsed = now - load_second_start;
+	uint16_t peak = load_slot_peak / (CYCLES_PER_MS / 1000);
+	
+	app_regs.REG_CPU_LOAD[0] = (idle < elapsed) ? 1000 - (uint32_t)(idle / (elapsed / 1000)) : 0;
+	app_regs.REG_CPU_LOAD[1] = (peak > 1000) ? 1000 : peak;
+	app_regs.REG_CPU_LOAD[2] = load_second_missed;
+	
+	load_second_start = now;
+	load_second_idle = idle_cycles;
+	load_slot_peak = 0;
+	load_second_missed = 0;
+	
+	if (app_regs.REG_CPU_LOAD_CONTROL & B_CPU_LOAD_EVENT)
+		core_func_send_event(ADD_REG_CPU_LOAD, true);
+}
+
+
+/************************************************************************/
+/* Control loop latency                                                 */
+/************************************************************************/
+/* The frame read by the ADC interrupt carries the time its conversion  */
+/* was started, and the control loop measures from there to the moment  */
+/* it writes the new duty cycle of the channel.                         */
+uint32_t adc_convst_cycles;
+uint32_t adc_frame_cycles;    // conversion start of the frame in FLOWMETER_ANALOG_OUTPUTS
+
+uint32_t latency_min[FLOW_CHANNELS];
+uint32_t latency_max[FLOW_CHANNELS];
+uint16_t latency_bins[FLOW_CHANNELS][LATENCY_BINS];
+
+void adc_conversion_started(void)
+{
+	adc_convst_cycles = cycle_count32();
+}
+
+void adc_frame_ready(void)
+{
+	adc_frame_cycles = adc_convst_cycles;
+}
+
+void loop_latency_record(uint8_t channel, uint32_t sampled)
+{
+	uint32_t cycles = cycle_count32() - sampled;
+	uint32_t bin = cycles >> LATENCY_BIN_SHIFT;
+	
+	/* No frame was read yet */
+	if (sampled == 0)
+		return;
+	
+	if (latency_min[channel] == 0 || cycles < latency_min[channel])
+		latency_min[channel] = cycles;
+	if (cycles > latency_max[channel])
+		latency_max[channel] = cycles;
+	
+	if (bin > LATENCY_BINS - 1)
+		bin = LATENCY_BINS - 1;
+	if (latency_bins[channel][bin] < 0xFFFF)
+		latency_bins[channel][bin]++;
+}
+
+void loop_latency_reset(uint8_t mask)
+{
+	uint8_t sreg = SREG;
+	
+	cli();
+	for (uint8_t channel = 0; channel < FLOW_CHANNELS; channel++)
+	{
+		if (!(mask & (1 << channel)))
+			continue;
+		
+		latency_min[channel] = 0;
+		latency_max[channel] = 0;
+		for (uint8_t i = 0; i < LATENCY_BINS; i++)
+			latency_bins[channel][i] = 0;
+	}
+	SREG = sreg;
+}
+
+/* data: min and max in us, saturated, then the bins */
+void loop_latency_read(uint8_t channel, uint16_t *data)
+{
+	uint8_t sreg = SREG;
+	uint32_t us;
+	
+	cli();
+	us = latency_min[channel] / (CYCLES_PER_MS / 1000);
+	data[0] = (us > 0xFFFF) ? 0xFFFF : us;
+	us = latency_max[channel] / (CYCLES_PER_MS / 1000);
+	data[1] = (us > 0xFFFF) ? 0xFFFF : us;
+	for (uint8_t i = 0; i < LATENCY_BINS; i++)
+		data[2 + i] = latency_bins[channel][i];
+	SREG = sreg;
+}
@@ -0,0 +1,75 @@
+#ifndef _PROFILER_H_
+#define _PROFILER_H_
+#include <avr/io.h>
+
+
+/************************************************************************/
+/* Execution time profiler                                              */
+/************************************************************************/
+/* Uncomment to stamp the entry and exit of the sites below. Without    */
+/* it the PROFILER_ macros are empty and the PROFILER_ registers read   */
+/* zeros, nothing else changes in the firmware.                         */
+//#define ENABLE_PROFILER
+
+/* TCF1 counts the CPU clock (31.25 ns) and is never stopped or reset. */
+/* Its overflows extend it to 32 bits for the longer intervals.         */
+#define CYCLE_COUNTER TCF1
+#define CYCLES_PER_MS 32000
+#define cycle_count() (CYCLE_COUNTER.CNT)
+
+#define PROFILER_T_1MS 0
+#define PROFILER_T_500US 1
+#define PROFILER_CLOSED_LOOP 2
+#define PROFILER_READ_TEMPERATURE 3
+#define PROFILER_ADC_ISR 4
+#define PROFILER_UART1_RX_ISR 5
+#define PROFILER_UART1_TX_ISR 6
+#define PROFILER_SITES 7
+
+/* Bin n counts the durations below 256 << n cycles, the last one the rest */
+#define PROFILER_BINS 8
+
+typedef struct
+{
+	uint16_t count;
+	uint16_t min;
+	uint16_t max;
+	uint32_t sum;
+	uint16_t bins[PROFILER_BINS];
+} profiler_site_t;
+
+#ifdef ENABLE_PROFILER
+	#define PROFILER_ENTRY(site) uint16_t profiler_entry_##site = cycle_count()
+	#define PROFILER_EXIT(site) profiler_record(site, cycle_count() - profiler_entry_##site)
+#else
+	#define PROFILER_ENTRY(site)
+	#define PROFILER_EXIT(site)
+#endif
+
+void init_cycle_counter(void);
+uint32_t cycle_count32(void);
+void profiler_record(uint8_t site, uint16_t cycles);
+void profiler_reset(void);
+void profiler_read(uint8_t site, uint16_t *data);
+
+/************************************************************************/
+/* CPU load                                                             */
+/************************************************************************/
+void idle_loop(void);
+void cpu_load_tick(void);
+void cpu_load_second(void);
+
+/************************************************************************/
+/* Control loop latency                                                 */
+/************************************************************************/
+/* Bins of 4096 cycles (128 us), the last one takes the longer times */
+#define LATENCY_BIN_SHIFT 12
+#define LATENCY_BINS 32
+
+void adc_conversion_started(void);
+void adc_frame_ready(void);
+void loop_latency_record(uint8_t channel, uint32_t sampled);
+void loop_latency_reset(uint8_t mask);
+void loop_latency_read(uint8_t channel, uint16_t *data);
+
+#endif /* _PROFILER_H_ */
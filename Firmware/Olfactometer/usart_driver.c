@@ -2,6 +2,7 @@
 #include "app_ios_and_regs.h"
 #include <string.h>
 #include "aux_funcs.h"
+#include "profiler.h"
 
 
 extern countdown_t pulse_countdown;
@@ -76,6 +77,7 @@ void uart1_disable(void)
 /************************************************************************/
 UART1_TX_ROUTINE_
 {
+	PROFILER_ENTRY(PROFILER_UART1_TX_ISR);
 	
 	UART1_UART.STATUS |= USART_TXCIF_bm;
 	
@@ -87,6 +89,8 @@ UART1_TX_ROUTINE_
 	if (uart1_head == uart1_tail){
 		UART1_UART.CTRLA &= ~(USART_DREINTLVL_OFF_gc | USART_DREINTLVL_gm);
 	}
+	
+	PROFILER_EXIT(PROFILER_UART1_TX_ISR);
 	uart1_leave_interrupt;
 }
 
@@ -202,7 +206,9 @@ bool uart1_rcv_now(uint8_t * byte)
 
 UART1_RX_ROUTINE_
 {
+	PROFILER_ENTRY(PROFILER_UART1_RX_ISR);
 	uart1_rcv_byte_callback(UART1_DATA);
+	PROFILER_EXIT(PROFILER_UART1_RX_ISR);
 	uart1_leave_interrupt;
 }
 
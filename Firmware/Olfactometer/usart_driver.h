@@ -20,9 +20,9 @@
 #define UART1_RX_pin				6
 #define UART1_TX_pin				7
 
-#define UART1_RX_ROUTINE_		ISR(USARTF1_RXC_vect, ISR_NAKED)
-#define UART1_TX_ROUTINE_		ISR(USARTF1_DRE_vect, ISR_NAKED)
-#define UART1_TX_ROUTINENEWFLAG_		ISR(USARTF1_TXC_vect, ISR_NAKED)
+#define UART1_RX_ROUTINE_		ISR(USARTF1_RXC_vect/*, ISR_NAKED*/)
+#define UART1_TX_ROUTINE_		ISR(USARTF1_DRE_vect/*, ISR_NAKED*/)
+#define UART1_TX_ROUTINENEWFLAG_		ISR(USARTF1_TXC_vect/*, ISR_NAKED*/)
 //#define UART1_RX_ROUTINE_		ISR(USARTC1_RXC_vect)
 //#define UART1_TX_ROUTINE_		ISR(USARTC1_DRE_vect)
 
@@ -41,7 +41,7 @@
 //#define UART1_CTS_ROUTINE_		ISR(PORTD_INT0_vect)
 #define UART1_CTS_INT_N			0
 
-#define uart1_leave_interrupt /*return*/reti()
+#define uart1_leave_interrupt return/*reti();*/
 
 /************************************************************************/
 /* Prototypes                                                           */
@@ -111,7 +111,57 @@ namespace Harp.Olfactometer
             { 103, typeof(TemperatureValue) },
             { 104, typeof(EnableTemperatureCalibration) },
             { 105, typeof(TemperatureCalibrationValue) },
-            { 106, typeof(EnableEvents) }
+            { 106, typeof(EnableEvents) },
+            { 107, typeof(ValvesEvent) },
+            { 108, typeof(Valve0Train) },
+            { 109, typeof(Valve1Train) },
+            { 110, typeof(Valve2Train) },
+            { 111, typeof(Valve3Train) },
+            { 112, typeof(EndValve0Train) },
+            { 113, typeof(EndValve1Train) },
+            { 114, typeof(DummyValveTrain) },
+            { 115, typeof(StartValvesTrain) },
+            { 116, typeof(StopValvesTrain) },
+            { 117, typeof(ValvesTrainDone) },
+            { 118, typeof(SequenceControl) },
+            { 119, typeof(SequenceLength) },
+            { 120, typeof(SequenceStepIndex) },
+            { 121, typeof(SequenceStep) },
+            { 122, typeof(SequenceStepFlows) },
+            { 123, typeof(DI0Debounce) },
+            { 124, typeof(FlowSettleTolerance) },
+            { 125, typeof(FlowSettleDwell) },
+            { 126, typeof(FlowSettled) },
+            { 127, typeof(FlowSettleTime) },
+            { 128, typeof(PwmDither) },
+            { 129, typeof(PwmPhase) },
+            { 130, typeof(ChannelsEnable) },
+            { 131, typeof(ChannelsEnableEvents) },
+            { 132, typeof(WarmStart) },
+            { 133, typeof(CalibrationProfile) },
+            { 134, typeof(CalibrationProfileName) },
+            { 135, typeof(CalibrationProfileSave) },
+            { 136, typeof(CalibrationCurve) },
+            { 137, typeof(CalibrationSweep) },
+            { 138, typeof(CalibrationSweepConfig) },
+            { 139, typeof(CalibrationSweepData) },
+            { 140, typeof(ChannelsTotalVolume) },
+            { 141, typeof(ChannelsTotalVolumeLatched) },
+            { 142, typeof(TotalVolumeCommand) },
+            { 143, typeof(TotalVolumeGated) },
+            { 144, typeof(MixTotalFlow) },
+            { 145, typeof(MixConcentrations) },
+            { 146, typeof(MixEnable) },
+            { 147, typeof(ProfilerControl) },
+            { 148, typeof(ProfilerSite) },
+            { 149, typeof(ProfilerData) },
+            { 150, typeof(CpuLoad) },
+            { 151, typeof(CpuLoadControl) },
+            { 152, typeof(LoopLatencyChannel) },
+            { 153, typeof(LoopLatency) },
+            { 154, typeof(LoopLatencyReset) },
+            { 155, typeof(SequenceSettleTimeout) },
+            { 156, typeof(CalibrationSource) }
         };
 
         /// <summary>
@@ -393,6 +443,55 @@ namespace Harp.Olfactometer
     /// <seealso cref="EnableTemperatureCalibration"/>
     /// <seealso cref="TemperatureCalibrationValue"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="ValvesEvent"/>
+    /// <seealso cref="Valve0Train"/>
+    /// <seealso cref="Valve1Train"/>
+    /// <seealso cref="Valve2Train"/>
+    /// <seealso cref="Valve3Train"/>
+    /// <seealso cref="EndValve0Train"/>
+    /// <seealso cref="EndValve1Train"/>
+    /// <seealso cref="StartValvesTrain"/>
+    /// <seealso cref="StopValvesTrain"/>
+    /// <seealso cref="ValvesTrainDone"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceLength"/>
+    /// <seealso cref="SequenceStepIndex"/>
+    /// <seealso cref="SequenceStep"/>
+    /// <seealso cref="SequenceStepFlows"/>
+    /// <seealso cref="DI0Debounce"/>
+    /// <seealso cref="FlowSettleTolerance"/>
+    /// <seealso cref="FlowSettleDwell"/>
+    /// <seealso cref="FlowSettled"/>
+    /// <seealso cref="FlowSettleTime"/>
+    /// <seealso cref="PwmDither"/>
+    /// <seealso cref="PwmPhase"/>
+    /// <seealso cref="ChannelsEnable"/>
+    /// <seealso cref="ChannelsEnableEvents"/>
+    /// <seealso cref="WarmStart"/>
+    /// <seealso cref="CalibrationProfile"/>
+    /// <seealso cref="CalibrationProfileName"/>
+    /// <seealso cref="CalibrationProfileSave"/>
+    /// <seealso cref="CalibrationCurve"/>
+    /// <seealso cref="CalibrationSweep"/>
+    /// <seealso cref="CalibrationSweepConfig"/>
+    /// <seealso cref="CalibrationSweepData"/>
+    /// <seealso cref="ChannelsTotalVolume"/>
+    /// <seealso cref="ChannelsTotalVolumeLatched"/>
+    /// <seealso cref="TotalVolumeCommand"/>
+    /// <seealso cref="TotalVolumeGated"/>
+    /// <seealso cref="MixTotalFlow"/>
+    /// <seealso cref="MixConcentrations"/>
+    /// <seealso cref="MixEnable"/>
+    /// <seealso cref="ProfilerControl"/>
+    /// <seealso cref="ProfilerSite"/>
+    /// <seealso cref="ProfilerData"/>
+    /// <seealso cref="CpuLoad"/>
+    /// <seealso cref="CpuLoadControl"/>
+    /// <seealso cref="LoopLatencyChannel"/>
+    /// <seealso cref="LoopLatency"/>
+    /// <seealso cref="LoopLatencyReset"/>
+    /// <seealso cref="SequenceSettleTimeout"/>
+    /// <seealso cref="CalibrationSource"/>
     [XmlInclude(typeof(EnableFlow))]
     [XmlInclude(typeof(Flowmeter))]
     [XmlInclude(typeof(DI0State))]
@@ -461,6 +560,55 @@ namespace Harp.Olfactometer
     [XmlInclude(typeof(EnableTemperatureCalibration))]
     [XmlInclude(typeof(TemperatureCalibrationValue))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(ValvesEvent))]
+    [XmlInclude(typeof(Valve0Train))]
+    [XmlInclude(typeof(Valve1Train))]
+    [XmlInclude(typeof(Valve2Train))]
+    [XmlInclude(typeof(Valve3Train))]
+    [XmlInclude(typeof(EndValve0Train))]
+    [XmlInclude(typeof(EndValve1Train))]
+    [XmlInclude(typeof(StartValvesTrain))]
+    [XmlInclude(typeof(StopValvesTrain))]
+    [XmlInclude(typeof(ValvesTrainDone))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceLength))]
+    [XmlInclude(typeof(SequenceStepIndex))]
+    [XmlInclude(typeof(SequenceStep))]
+    [XmlInclude(typeof(SequenceStepFlows))]
+    [XmlInclude(typeof(DI0Debounce))]
+    [XmlInclude(typeof(FlowSettleTolerance))]
+    [XmlInclude(typeof(FlowSettleDwell))]
+    [XmlInclude(typeof(FlowSettled))]
+    [XmlInclude(typeof(FlowSettleTime))]
+    [XmlInclude(typeof(PwmDither))]
+    [XmlInclude(typeof(PwmPhase))]
+    [XmlInclude(typeof(ChannelsEnable))]
+    [XmlInclude(typeof(ChannelsEnableEvents))]
+    [XmlInclude(typeof(WarmStart))]
+    [XmlInclude(typeof(CalibrationProfile))]
+    [XmlInclude(typeof(CalibrationProfileName))]
+    [XmlInclude(typeof(CalibrationProfileSave))]
+    [XmlInclude(typeof(CalibrationCurve))]
+    [XmlInclude(typeof(CalibrationSweep))]
+    [XmlInclude(typeof(CalibrationSweepConfig))]
+    [XmlInclude(typeof(CalibrationSweepData))]
+    [XmlInclude(typeof(ChannelsTotalVolume))]
+    [XmlInclude(typeof(ChannelsTotalVolumeLatched))]
+    [XmlInclude(typeof(TotalVolumeCommand))]
+    [XmlInclude(typeof(TotalVolumeGated))]
+    [XmlInclude(typeof(MixTotalFlow))]
+    [XmlInclude(typeof(MixConcentrations))]
+    [XmlInclude(typeof(MixEnable))]
+    [XmlInclude(typeof(ProfilerControl))]
+    [XmlInclude(typeof(ProfilerSite))]
+    [XmlInclude(typeof(ProfilerData))]
+    [XmlInclude(typeof(CpuLoad))]
+    [XmlInclude(typeof(CpuLoadControl))]
+    [XmlInclude(typeof(LoopLatencyChannel))]
+    [XmlInclude(typeof(LoopLatency))]
+    [XmlInclude(typeof(LoopLatencyReset))]
+    [XmlInclude(typeof(SequenceSettleTimeout))]
+    [XmlInclude(typeof(CalibrationSource))]
     [Description("Filters register-specific messages reported by the Olfactometer device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -550,6 +698,55 @@ namespace Harp.Olfactometer
     /// <seealso cref="EnableTemperatureCalibration"/>
     /// <seealso cref="TemperatureCalibrationValue"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="ValvesEvent"/>
+    /// <seealso cref="Valve0Train"/>
+    /// <seealso cref="Valve1Train"/>
+    /// <seealso cref="Valve2Train"/>
+    /// <seealso cref="Valve3Train"/>
+    /// <seealso cref="EndValve0Train"/>
+    /// <seealso cref="EndValve1Train"/>
+    /// <seealso cref="StartValvesTrain"/>
+    /// <seealso cref="StopValvesTrain"/>
+    /// <seealso cref="ValvesTrainDone"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceLength"/>
+    /// <seealso cref="SequenceStepIndex"/>
+    /// <seealso cref="SequenceStep"/>
+    /// <seealso cref="SequenceStepFlows"/>
+    /// <seealso cref="DI0Debounce"/>
+    /// <seealso cref="FlowSettleTolerance"/>
+    /// <seealso cref="FlowSettleDwell"/>
+    /// <seealso cref="FlowSettled"/>
+    /// <seealso cref="FlowSettleTime"/>
+    /// <seealso cref="PwmDither"/>
+    /// <seealso cref="PwmPhase"/>
+    /// <seealso cref="ChannelsEnable"/>
+    /// <seealso cref="ChannelsEnableEvents"/>
+    /// <seealso cref="WarmStart"/>
+    /// <seealso cref="CalibrationProfile"/>
+    /// <seealso cref="CalibrationProfileName"/>
+    /// <seealso cref="CalibrationProfileSave"/>
+    /// <seealso cref="CalibrationCurve"/>
+    /// <seealso cref="CalibrationSweep"/>
+    /// <seealso cref="CalibrationSweepConfig"/>
+    /// <seealso cref="CalibrationSweepData"/>
+    /// <seealso cref="ChannelsTotalVolume"/>
+    /// <seealso cref="ChannelsTotalVolumeLatched"/>
+    /// <seealso cref="TotalVolumeCommand"/>
+    /// <seealso cref="TotalVolumeGated"/>
+    /// <seealso cref="MixTotalFlow"/>
+    /// <seealso cref="MixConcentrations"/>
+    /// <seealso cref="MixEnable"/>
+    /// <seealso cref="ProfilerControl"/>
+    /// <seealso cref="ProfilerSite"/>
+    /// <seealso cref="ProfilerData"/>
+    /// <seealso cref="CpuLoad"/>
+    /// <seealso cref="CpuLoadControl"/>
+    /// <seealso cref="LoopLatencyChannel"/>
+    /// <seealso cref="LoopLatency"/>
+    /// <seealso cref="LoopLatencyReset"/>
+    /// <seealso cref="SequenceSettleTimeout"/>
+    /// <seealso cref="CalibrationSource"/>
     [XmlInclude(typeof(EnableFlow))]
     [XmlInclude(typeof(Flowmeter))]
     [XmlInclude(typeof(DI0State))]
@@ -618,6 +815,55 @@ namespace Harp.Olfactometer
     [XmlInclude(typeof(EnableTemperatureCalibration))]
     [XmlInclude(typeof(TemperatureCalibrationValue))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(ValvesEvent))]
+    [XmlInclude(typeof(Valve0Train))]
+    [XmlInclude(typeof(Valve1Train))]
+    [XmlInclude(typeof(Valve2Train))]
+    [XmlInclude(typeof(Valve3Train))]
+    [XmlInclude(typeof(EndValve0Train))]
+    [XmlInclude(typeof(EndValve1Train))]
+    [XmlInclude(typeof(StartValvesTrain))]
+    [XmlInclude(typeof(StopValvesTrain))]
+    [XmlInclude(typeof(ValvesTrainDone))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceLength))]
+    [XmlInclude(typeof(SequenceStepIndex))]
+    [XmlInclude(typeof(SequenceStep))]
+    [XmlInclude(typeof(SequenceStepFlows))]
+    [XmlInclude(typeof(DI0Debounce))]
+    [XmlInclude(typeof(FlowSettleTolerance))]
+    [XmlInclude(typeof(FlowSettleDwell))]
+    [XmlInclude(typeof(FlowSettled))]
+    [XmlInclude(typeof(FlowSettleTime))]
+    [XmlInclude(typeof(PwmDither))]
+    [XmlInclude(typeof(PwmPhase))]
+    [XmlInclude(typeof(ChannelsEnable))]
+    [XmlInclude(typeof(ChannelsEnableEvents))]
+    [XmlInclude(typeof(WarmStart))]
+    [XmlInclude(typeof(CalibrationProfile))]
+    [XmlInclude(typeof(CalibrationProfileName))]
+    [XmlInclude(typeof(CalibrationProfileSave))]
+    [XmlInclude(typeof(CalibrationCurve))]
+    [XmlInclude(typeof(CalibrationSweep))]
+    [XmlInclude(typeof(CalibrationSweepConfig))]
+    [XmlInclude(typeof(CalibrationSweepData))]
+    [XmlInclude(typeof(ChannelsTotalVolume))]
+    [XmlInclude(typeof(ChannelsTotalVolumeLatched))]
+    [XmlInclude(typeof(TotalVolumeCommand))]
+    [XmlInclude(typeof(TotalVolumeGated))]
+    [XmlInclude(typeof(MixTotalFlow))]
+    [XmlInclude(typeof(MixConcentrations))]
+    [XmlInclude(typeof(MixEnable))]
+    [XmlInclude(typeof(ProfilerControl))]
+    [XmlInclude(typeof(ProfilerSite))]
+    [XmlInclude(typeof(ProfilerData))]
+    [XmlInclude(typeof(CpuLoad))]
+    [XmlInclude(typeof(CpuLoadControl))]
+    [XmlInclude(typeof(LoopLatencyChannel))]
+    [XmlInclude(typeof(LoopLatency))]
+    [XmlInclude(typeof(LoopLatencyReset))]
+    [XmlInclude(typeof(SequenceSettleTimeout))]
+    [XmlInclude(typeof(CalibrationSource))]
     [XmlInclude(typeof(TimestampedEnableFlow))]
     [XmlInclude(typeof(TimestampedFlowmeter))]
     [XmlInclude(typeof(TimestampedDI0State))]
@@ -686,6 +932,55 @@ namespace Harp.Olfactometer
     [XmlInclude(typeof(TimestampedEnableTemperatureCalibration))]
     [XmlInclude(typeof(TimestampedTemperatureCalibrationValue))]
     [XmlInclude(typeof(TimestampedEnableEvents))]
+    [XmlInclude(typeof(TimestampedValvesEvent))]
+    [XmlInclude(typeof(TimestampedValve0Train))]
+    [XmlInclude(typeof(TimestampedValve1Train))]
+    [XmlInclude(typeof(TimestampedValve2Train))]
+    [XmlInclude(typeof(TimestampedValve3Train))]
+    [XmlInclude(typeof(TimestampedEndValve0Train))]
+    [XmlInclude(typeof(TimestampedEndValve1Train))]
+    [XmlInclude(typeof(TimestampedStartValvesTrain))]
+    [XmlInclude(typeof(TimestampedStopValvesTrain))]
+    [XmlInclude(typeof(TimestampedValvesTrainDone))]
+    [XmlInclude(typeof(TimestampedSequenceControl))]
+    [XmlInclude(typeof(TimestampedSequenceLength))]
+    [XmlInclude(typeof(TimestampedSequenceStepIndex))]
+    [XmlInclude(typeof(TimestampedSequenceStep))]
+    [XmlInclude(typeof(TimestampedSequenceStepFlows))]
+    [XmlInclude(typeof(TimestampedDI0Debounce))]
+    [XmlInclude(typeof(TimestampedFlowSettleTolerance))]
+    [XmlInclude(typeof(TimestampedFlowSettleDwell))]
+    [XmlInclude(typeof(TimestampedFlowSettled))]
+    [XmlInclude(typeof(TimestampedFlowSettleTime))]
+    [XmlInclude(typeof(TimestampedPwmDither))]
+    [XmlInclude(typeof(TimestampedPwmPhase))]
+    [XmlInclude(typeof(TimestampedChannelsEnable))]
+    [XmlInclude(typeof(TimestampedChannelsEnableEvents))]
+    [XmlInclude(typeof(TimestampedWarmStart))]
+    [XmlInclude(typeof(TimestampedCalibrationProfile))]
+    [XmlInclude(typeof(TimestampedCalibrationProfileName))]
+    [XmlInclude(typeof(TimestampedCalibrationProfileSave))]
+    [XmlInclude(typeof(TimestampedCalibrationCurve))]
+    [XmlInclude(typeof(TimestampedCalibrationSweep))]
+    [XmlInclude(typeof(TimestampedCalibrationSweepConfig))]
+    [XmlInclude(typeof(TimestampedCalibrationSweepData))]
+    [XmlInclude(typeof(TimestampedChannelsTotalVolume))]
+    [XmlInclude(typeof(TimestampedChannelsTotalVolumeLatched))]
+    [XmlInclude(typeof(TimestampedTotalVolumeCommand))]
+    [XmlInclude(typeof(TimestampedTotalVolumeGated))]
+    [XmlInclude(typeof(TimestampedMixTotalFlow))]
+    [XmlInclude(typeof(TimestampedMixConcentrations))]
+    [XmlInclude(typeof(TimestampedMixEnable))]
+    [XmlInclude(typeof(TimestampedProfilerControl))]
+    [XmlInclude(typeof(TimestampedProfilerSite))]
+    [XmlInclude(typeof(TimestampedProfilerData))]
+    [XmlInclude(typeof(TimestampedCpuLoad))]
+    [XmlInclude(typeof(TimestampedCpuLoadControl))]
+    [XmlInclude(typeof(TimestampedLoopLatencyChannel))]
+    [XmlInclude(typeof(TimestampedLoopLatency))]
+    [XmlInclude(typeof(TimestampedLoopLatencyReset))]
+    [XmlInclude(typeof(TimestampedSequenceSettleTimeout))]
+    [XmlInclude(typeof(TimestampedCalibrationSource))]
     [Description("Filters and selects specific messages reported by the Olfactometer device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -772,6 +1067,55 @@ namespace Harp.Olfactometer
     /// <seealso cref="EnableTemperatureCalibration"/>
     /// <seealso cref="TemperatureCalibrationValue"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="ValvesEvent"/>
+    /// <seealso cref="Valve0Train"/>
+    /// <seealso cref="Valve1Train"/>
+    /// <seealso cref="Valve2Train"/>
+    /// <seealso cref="Valve3Train"/>
+    /// <seealso cref="EndValve0Train"/>
+    /// <seealso cref="EndValve1Train"/>
+    /// <seealso cref="StartValvesTrain"/>
+    /// <seealso cref="StopValvesTrain"/>
+    /// <seealso cref="ValvesTrainDone"/>
+    /// <seealso cref="SequenceControl"/>
+    /// <seealso cref="SequenceLength"/>
+    /// <seealso cref="SequenceStepIndex"/>
+    /// <seealso cref="SequenceStep"/>
+    /// <seealso cref="SequenceStepFlows"/>
+    /// <seealso cref="DI0Debounce"/>
+    /// <seealso cref="FlowSettleTolerance"/>
+    /// <seealso cref="FlowSettleDwell"/>
+    /// <seealso cref="FlowSettled"/>
+    /// <seealso cref="FlowSettleTime"/>
+    /// <seealso cref="PwmDither"/>
+    /// <seealso cref="PwmPhase"/>
+    /// <seealso cref="ChannelsEnable"/>
+    /// <seealso cref="ChannelsEnableEvents"/>
+    /// <seealso cref="WarmStart"/>
+    /// <seealso cref="CalibrationProfile"/>
+    /// <seealso cref="CalibrationProfileName"/>
+    /// <seealso cref="CalibrationProfileSave"/>
+    /// <seealso cref="CalibrationCurve"/>
+    /// <seealso cref="CalibrationSweep"/>
+    /// <seealso cref="CalibrationSweepConfig"/>
+    /// <seealso cref="CalibrationSweepData"/>
+    /// <seealso cref="ChannelsTotalVolume"/>
+    /// <seealso cref="ChannelsTotalVolumeLatched"/>
+    /// <seealso cref="TotalVolumeCommand"/>
+    /// <seealso cref="TotalVolumeGated"/>
+    /// <seealso cref="MixTotalFlow"/>
+    /// <seealso cref="MixConcentrations"/>
+    /// <seealso cref="MixEnable"/>
+    /// <seealso cref="ProfilerControl"/>
+    /// <seealso cref="ProfilerSite"/>
+    /// <seealso cref="ProfilerData"/>
+    /// <seealso cref="CpuLoad"/>
+    /// <seealso cref="CpuLoadControl"/>
+    /// <seealso cref="LoopLatencyChannel"/>
+    /// <seealso cref="LoopLatency"/>
+    /// <seealso cref="LoopLatencyReset"/>
+    /// <seealso cref="SequenceSettleTimeout"/>
+    /// <seealso cref="CalibrationSource"/>
     [XmlInclude(typeof(EnableFlow))]
     [XmlInclude(typeof(Flowmeter))]
     [XmlInclude(typeof(DI0State))]
@@ -840,6 +1184,55 @@ namespace Harp.Olfactometer
     [XmlInclude(typeof(EnableTemperatureCalibration))]
     [XmlInclude(typeof(TemperatureCalibrationValue))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(ValvesEvent))]
+    [XmlInclude(typeof(Valve0Train))]
+    [XmlInclude(typeof(Valve1Train))]
+    [XmlInclude(typeof(Valve2Train))]
+    [XmlInclude(typeof(Valve3Train))]
+    [XmlInclude(typeof(EndValve0Train))]
+    [XmlInclude(typeof(EndValve1Train))]
+    [XmlInclude(typeof(StartValvesTrain))]
+    [XmlInclude(typeof(StopValvesTrain))]
+    [XmlInclude(typeof(ValvesTrainDone))]
+    [XmlInclude(typeof(SequenceControl))]
+    [XmlInclude(typeof(SequenceLength))]
+    [XmlInclude(typeof(SequenceStepIndex))]
+    [XmlInclude(typeof(SequenceStep))]
+    [XmlInclude(typeof(SequenceStepFlows))]
+    [XmlInclude(typeof(DI0Debounce))]
+    [XmlInclude(typeof(FlowSettleTolerance))]
+    [XmlInclude(typeof(FlowSettleDwell))]
+    [XmlInclude(typeof(FlowSettled))]
+    [XmlInclude(typeof(FlowSettleTime))]
+    [XmlInclude(typeof(PwmDither))]
+    [XmlInclude(typeof(PwmPhase))]
+    [XmlInclude(typeof(ChannelsEnable))]
+    [XmlInclude(typeof(ChannelsEnableEvents))]
+    [XmlInclude(typeof(WarmStart))]
+    [XmlInclude(typeof(CalibrationProfile))]
+    [XmlInclude(typeof(CalibrationProfileName))]
+    [XmlInclude(typeof(CalibrationProfileSave))]
+    [XmlInclude(typeof(CalibrationCurve))]
+    [XmlInclude(typeof(CalibrationSweep))]
+    [XmlInclude(typeof(CalibrationSweepConfig))]
+    [XmlInclude(typeof(CalibrationSweepData))]
+    [XmlInclude(typeof(ChannelsTotalVolume))]
+    [XmlInclude(typeof(ChannelsTotalVolumeLatched))]
+    [XmlInclude(typeof(TotalVolumeCommand))]
+    [XmlInclude(typeof(TotalVolumeGated))]
+    [XmlInclude(typeof(MixTotalFlow))]
+    [XmlInclude(typeof(MixConcentrations))]
+    [XmlInclude(typeof(MixEnable))]
+    [XmlInclude(typeof(ProfilerControl))]
+    [XmlInclude(typeof(ProfilerSite))]
+    [XmlInclude(typeof(ProfilerData))]
+    [XmlInclude(typeof(CpuLoad))]
+    [XmlInclude(typeof(CpuLoadControl))]
+    [XmlInclude(typeof(LoopLatencyChannel))]
+    [XmlInclude(typeof(LoopLatency))]
+    [XmlInclude(typeof(LoopLatencyReset))]
+    [XmlInclude(typeof(SequenceSettleTimeout))]
+    [XmlInclude(typeof(CalibrationSource))]
     [Description("Formats a sequence of values as specific Olfactometer register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -1169,9 +1562,9 @@ namespace Harp.Olfactometer
     }
 
     /// <summary>
-    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
     /// </summary>
-    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
+    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
     public partial class Channel0UserCalibration
     {
         /// <summary>
@@ -1265,9 +1658,9 @@ namespace Harp.Olfactometer
     }
 
     /// <summary>
-    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
     /// </summary>
-    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
+    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
     public partial class Channel1UserCalibration
     {
         /// <summary>
@@ -1361,9 +1754,9 @@ namespace Harp.Olfactometer
     }
 
     /// <summary>
-    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
     /// </summary>
-    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
+    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
     public partial class Channel2UserCalibration
     {
         /// <summary>
@@ -1457,9 +1850,9 @@ namespace Harp.Olfactometer
     }
 
     /// <summary>
-    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// Represents a register that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
     /// </summary>
-    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
+    [Description("Calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
     public partial class Channel3UserCalibration
     {
         /// <summary>
@@ -7617,4140 +8010,13408 @@ namespace Harp.Olfactometer
         }
     }
 
+    /// <summary>
+    /// Represents a register that reports each valve transition, timestamped at the port write.
+    /// </summary>
+    [Description("Reports each valve transition, timestamped at the port write.")]
+    public partial class ValvesEvent
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ValvesEvent"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ValvesEvent"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ValvesEvent"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        static ValvesEventPayload ParsePayload(ushort[] payload)
+        {
+            ValvesEventPayload result;
+            result.Changed = (Valves)payload[0];
+            result.State = (Valves)payload[1];
+            return result;
+        }
+
+        static ushort[] FormatPayload(ValvesEventPayload value)
+        {
+            ushort[] result;
+            result = new ushort[2];
+            result[0] = (ushort)value.Changed;
+            result[1] = (ushort)value.State;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ValvesEvent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ValvesEventPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ValvesEvent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ValvesEventPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ValvesEvent"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ValvesEvent"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ValvesEventPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ValvesEvent"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ValvesEvent"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ValvesEventPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ValvesEvent register.
+    /// </summary>
+    /// <seealso cref="ValvesEvent"/>
+    [Description("Filters and selects timestamped messages from the ValvesEvent register.")]
+    public partial class TimestampedValvesEvent
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ValvesEvent"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ValvesEvent.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ValvesEvent"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ValvesEventPayload> GetPayload(HarpMessage message)
+        {
+            return ValvesEvent.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of Valve0.
+    /// </summary>
+    [Description("Sets the pulse train of Valve0.")]
+    public partial class Valve0Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve0Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 108;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Valve0Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Valve0Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static Valve0TrainPayload ParsePayload(ushort[] payload)
+        {
+            Valve0TrainPayload result;
+            result.Delay = payload[0];
+            result.OnTime = payload[1];
+            result.OffTime = payload[2];
+            result.Count = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(Valve0TrainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Delay;
+            result[1] = value.OnTime;
+            result[2] = value.OffTime;
+            result[3] = value.Count;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Valve0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valve0TrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Valve0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve0TrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Valve0Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve0Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valve0TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Valve0Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve0Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valve0TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Valve0Train register.
+    /// </summary>
+    /// <seealso cref="Valve0Train"/>
+    [Description("Filters and selects timestamped messages from the Valve0Train register.")]
+    public partial class TimestampedValve0Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve0Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Valve0Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Valve0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve0TrainPayload> GetPayload(HarpMessage message)
+        {
+            return Valve0Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of Valve1.
+    /// </summary>
+    [Description("Sets the pulse train of Valve1.")]
+    public partial class Valve1Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve1Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 109;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Valve1Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Valve1Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static Valve1TrainPayload ParsePayload(ushort[] payload)
+        {
+            Valve1TrainPayload result;
+            result.Delay = payload[0];
+            result.OnTime = payload[1];
+            result.OffTime = payload[2];
+            result.Count = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(Valve1TrainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Delay;
+            result[1] = value.OnTime;
+            result[2] = value.OffTime;
+            result[3] = value.Count;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Valve1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valve1TrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Valve1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve1TrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Valve1Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve1Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valve1TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Valve1Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve1Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valve1TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Valve1Train register.
+    /// </summary>
+    /// <seealso cref="Valve1Train"/>
+    [Description("Filters and selects timestamped messages from the Valve1Train register.")]
+    public partial class TimestampedValve1Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve1Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Valve1Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Valve1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve1TrainPayload> GetPayload(HarpMessage message)
+        {
+            return Valve1Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of Valve2.
+    /// </summary>
+    [Description("Sets the pulse train of Valve2.")]
+    public partial class Valve2Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve2Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 110;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Valve2Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Valve2Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static Valve2TrainPayload ParsePayload(ushort[] payload)
+        {
+            Valve2TrainPayload result;
+            result.Delay = payload[0];
+            result.OnTime = payload[1];
+            result.OffTime = payload[2];
+            result.Count = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(Valve2TrainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Delay;
+            result[1] = value.OnTime;
+            result[2] = value.OffTime;
+            result[3] = value.Count;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Valve2Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valve2TrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Valve2Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve2TrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Valve2Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve2Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valve2TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Valve2Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve2Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valve2TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Valve2Train register.
+    /// </summary>
+    /// <seealso cref="Valve2Train"/>
+    [Description("Filters and selects timestamped messages from the Valve2Train register.")]
+    public partial class TimestampedValve2Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve2Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Valve2Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Valve2Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve2TrainPayload> GetPayload(HarpMessage message)
+        {
+            return Valve2Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of Valve3.
+    /// </summary>
+    [Description("Sets the pulse train of Valve3.")]
+    public partial class Valve3Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve3Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 111;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Valve3Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Valve3Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static Valve3TrainPayload ParsePayload(ushort[] payload)
+        {
+            Valve3TrainPayload result;
+            result.Delay = payload[0];
+            result.OnTime = payload[1];
+            result.OffTime = payload[2];
+            result.Count = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(Valve3TrainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Delay;
+            result[1] = value.OnTime;
+            result[2] = value.OffTime;
+            result[3] = value.Count;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Valve3Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valve3TrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Valve3Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve3TrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Valve3Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve3Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valve3TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Valve3Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Valve3Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valve3TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Valve3Train register.
+    /// </summary>
+    /// <seealso cref="Valve3Train"/>
+    [Description("Filters and selects timestamped messages from the Valve3Train register.")]
+    public partial class TimestampedValve3Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Valve3Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Valve3Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Valve3Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valve3TrainPayload> GetPayload(HarpMessage message)
+        {
+            return Valve3Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of EndValve0.
+    /// </summary>
+    [Description("Sets the pulse train of EndValve0.")]
+    public partial class EndValve0Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EndValve0Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 112;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EndValve0Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EndValve0Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static EndValve0TrainPayload ParsePayload(ushort[] payload)
+        {
+            EndValve0TrainPayload result;
+            result.Delay = payload[0];
+            result.OnTime = payload[1];
+            result.OffTime = payload[2];
+            result.Count = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(EndValve0TrainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Delay;
+            result[1] = value.OnTime;
+            result[2] = value.OffTime;
+            result[3] = value.Count;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EndValve0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EndValve0TrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EndValve0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EndValve0TrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EndValve0Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EndValve0Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EndValve0TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EndValve0Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EndValve0Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EndValve0TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EndValve0Train register.
+    /// </summary>
+    /// <seealso cref="EndValve0Train"/>
+    [Description("Filters and selects timestamped messages from the EndValve0Train register.")]
+    public partial class TimestampedEndValve0Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EndValve0Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EndValve0Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EndValve0Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EndValve0TrainPayload> GetPayload(HarpMessage message)
+        {
+            return EndValve0Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of EndValve1.
+    /// </summary>
+    [Description("Sets the pulse train of EndValve1.")]
+    public partial class EndValve1Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EndValve1Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 113;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="EndValve1Train"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="EndValve1Train"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static EndValve1TrainPayload ParsePayload(ushort[] payload)
+        {
+            EndValve1TrainPayload result;
+            result.Delay = payload[0];
+            result.OnTime = payload[1];
+            result.OffTime = payload[2];
+            result.Count = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(EndValve1TrainPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Delay;
+            result[1] = value.OnTime;
+            result[2] = value.OffTime;
+            result[3] = value.Count;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="EndValve1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EndValve1TrainPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="EndValve1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EndValve1TrainPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="EndValve1Train"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EndValve1Train"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EndValve1TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="EndValve1Train"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="EndValve1Train"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EndValve1TrainPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// EndValve1Train register.
+    /// </summary>
+    /// <seealso cref="EndValve1Train"/>
+    [Description("Filters and selects timestamped messages from the EndValve1Train register.")]
+    public partial class TimestampedEndValve1Train
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="EndValve1Train"/> register. This field is constant.
+        /// </summary>
+        public const int Address = EndValve1Train.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="EndValve1Train"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EndValve1TrainPayload> GetPayload(HarpMessage message)
+        {
+            return EndValve1Train.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the pulse train of the dummy valve.
+    /// </summary>
+    [Description("Sets the pulse train of the dummy valve.")]
+    internal partial class DummyValveTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DummyValveTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 114;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DummyValveTrain"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DummyValveTrain"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+    }
+
+    /// <summary>
+    /// Represents a register that starts the pulse train of the specified odor, end and dummy valves.
+    /// </summary>
+    [Description("Starts the pulse train of the specified odor, end and dummy valves.")]
+    public partial class StartValvesTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 115;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StartValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StartValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StartValvesTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valves GetPayload(HarpMessage message)
+        {
+            return (Valves)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StartValvesTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valves> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((Valves)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StartValvesTrain"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartValvesTrain"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valves value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StartValvesTrain"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StartValvesTrain"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valves value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StartValvesTrain register.
+    /// </summary>
+    /// <seealso cref="StartValvesTrain"/>
+    [Description("Filters and selects timestamped messages from the StartValvesTrain register.")]
+    public partial class TimestampedStartValvesTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StartValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StartValvesTrain.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StartValvesTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valves> GetPayload(HarpMessage message)
+        {
+            return StartValvesTrain.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that stops the pulse train of the specified valves and closes them.
+    /// </summary>
+    [Description("Stops the pulse train of the specified valves and closes them.")]
+    public partial class StopValvesTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StopValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 116;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StopValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StopValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StopValvesTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valves GetPayload(HarpMessage message)
+        {
+            return (Valves)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StopValvesTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valves> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((Valves)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StopValvesTrain"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StopValvesTrain"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valves value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StopValvesTrain"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StopValvesTrain"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valves value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StopValvesTrain register.
+    /// </summary>
+    /// <seealso cref="StopValvesTrain"/>
+    [Description("Filters and selects timestamped messages from the StopValvesTrain register.")]
+    public partial class TimestampedStopValvesTrain
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StopValvesTrain"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StopValvesTrain.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StopValvesTrain"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valves> GetPayload(HarpMessage message)
+        {
+            return StopValvesTrain.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the valves whose pulse train has completed.
+    /// </summary>
+    [Description("Reports the valves whose pulse train has completed.")]
+    public partial class ValvesTrainDone
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ValvesTrainDone"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 117;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ValvesTrainDone"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ValvesTrainDone"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ValvesTrainDone"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Valves GetPayload(HarpMessage message)
+        {
+            return (Valves)message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ValvesTrainDone"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valves> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadUInt16();
+            return Timestamped.Create((Valves)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ValvesTrainDone"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ValvesTrainDone"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Valves value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, (ushort)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ValvesTrainDone"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ValvesTrainDone"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Valves value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, (ushort)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ValvesTrainDone register.
+    /// </summary>
+    /// <seealso cref="ValvesTrainDone"/>
+    [Description("Filters and selects timestamped messages from the ValvesTrainDone register.")]
+    public partial class TimestampedValvesTrainDone
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ValvesTrainDone"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ValvesTrainDone.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ValvesTrainDone"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Valves> GetPayload(HarpMessage message)
+        {
+            return ValvesTrainDone.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.
+    /// </summary>
+    [Description("Stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.")]
+    public partial class SequenceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 118;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SequenceState GetPayload(HarpMessage message)
+        {
+            return (SequenceState)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceState> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((SequenceState)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SequenceState value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SequenceState value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceControl register.
+    /// </summary>
+    /// <seealso cref="SequenceControl"/>
+    [Description("Filters and selects timestamped messages from the SequenceControl register.")]
+    public partial class TimestampedSequenceControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceState> GetPayload(HarpMessage message)
+        {
+            return SequenceControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that number of steps of the odor delivery sequence.
+    /// </summary>
+    [Description("Number of steps of the odor delivery sequence.")]
+    public partial class SequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 119;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceLength register.
+    /// </summary>
+    /// <seealso cref="SequenceLength"/>
+    [Description("Filters and selects timestamped messages from the SequenceLength register.")]
+    public partial class TimestampedSequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SequenceLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the step accessed through SequenceStep and SequenceStepFlows.
+    /// </summary>
+    [Description("Selects the step accessed through SequenceStep and SequenceStepFlows.")]
+    public partial class SequenceStepIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStepIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 120;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceStepIndex"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceStepIndex"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceStepIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceStepIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceStepIndex"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStepIndex"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceStepIndex"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStepIndex"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceStepIndex register.
+    /// </summary>
+    /// <seealso cref="SequenceStepIndex"/>
+    [Description("Filters and selects timestamped messages from the SequenceStepIndex register.")]
+    public partial class TimestampedSequenceStepIndex
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStepIndex"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceStepIndex.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceStepIndex"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return SequenceStepIndex.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time, valves, digital outputs and settle gate of the selected sequence step.
+    /// </summary>
+    [Description("Time, valves, digital outputs and settle gate of the selected sequence step.")]
+    public partial class SequenceStep
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStep"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 121;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceStep"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceStep"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static SequenceStepPayload ParsePayload(ushort[] payload)
+        {
+            SequenceStepPayload result;
+            result.Time = payload[0];
+            result.Valves = (Valves)payload[1];
+            result.DigitalOutputs = (DigitalOutputs)payload[2];
+            result.Settle = (FlowChannels)payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(SequenceStepPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Time;
+            result[1] = (ushort)value.Valves;
+            result[2] = (ushort)value.DigitalOutputs;
+            result[3] = (ushort)value.Settle;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceStep"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static SequenceStepPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceStep"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceStepPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceStep"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStep"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, SequenceStepPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceStep"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStep"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, SequenceStepPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceStep register.
+    /// </summary>
+    /// <seealso cref="SequenceStep"/>
+    [Description("Filters and selects timestamped messages from the SequenceStep register.")]
+    public partial class TimestampedSequenceStep
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStep"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceStep.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceStep"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<SequenceStepPayload> GetPayload(HarpMessage message)
+        {
+            return SequenceStep.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.
+    /// </summary>
+    [Description("Target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.")]
+    public partial class SequenceStepFlows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStepFlows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 122;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceStepFlows"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceStepFlows"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceStepFlows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceStepFlows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceStepFlows"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStepFlows"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceStepFlows"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceStepFlows"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceStepFlows register.
+    /// </summary>
+    /// <seealso cref="SequenceStepFlows"/>
+    [Description("Filters and selects timestamped messages from the SequenceStepFlows register.")]
+    public partial class TimestampedSequenceStepFlows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceStepFlows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceStepFlows.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceStepFlows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return SequenceStepFlows.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.
+    /// </summary>
+    [Description("Time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.")]
+    public partial class DI0Debounce
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DI0Debounce"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 123;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="DI0Debounce"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="DI0Debounce"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="DI0Debounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="DI0Debounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="DI0Debounce"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DI0Debounce"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="DI0Debounce"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="DI0Debounce"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// DI0Debounce register.
+    /// </summary>
+    /// <seealso cref="DI0Debounce"/>
+    [Description("Filters and selects timestamped messages from the DI0Debounce register.")]
+    public partial class TimestampedDI0Debounce
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="DI0Debounce"/> register. This field is constant.
+        /// </summary>
+        public const int Address = DI0Debounce.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="DI0Debounce"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return DI0Debounce.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that maximum flow error, in percentage of the target, for a channel to be considered settled.
+    /// </summary>
+    [Description("Maximum flow error, in percentage of the target, for a channel to be considered settled.")]
+    public partial class FlowSettleTolerance
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettleTolerance"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 124;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlowSettleTolerance"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlowSettleTolerance"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlowSettleTolerance"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlowSettleTolerance"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlowSettleTolerance"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettleTolerance"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlowSettleTolerance"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettleTolerance"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlowSettleTolerance register.
+    /// </summary>
+    /// <seealso cref="FlowSettleTolerance"/>
+    [Description("Filters and selects timestamped messages from the FlowSettleTolerance register.")]
+    public partial class TimestampedFlowSettleTolerance
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettleTolerance"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlowSettleTolerance.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlowSettleTolerance"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetPayload(HarpMessage message)
+        {
+            return FlowSettleTolerance.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.
+    /// </summary>
+    [Description("Time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.")]
+    public partial class FlowSettleDwell
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettleDwell"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 125;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlowSettleDwell"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlowSettleDwell"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlowSettleDwell"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlowSettleDwell"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlowSettleDwell"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettleDwell"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlowSettleDwell"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettleDwell"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlowSettleDwell register.
+    /// </summary>
+    /// <seealso cref="FlowSettleDwell"/>
+    [Description("Filters and selects timestamped messages from the FlowSettleDwell register.")]
+    public partial class TimestampedFlowSettleDwell
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettleDwell"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlowSettleDwell.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlowSettleDwell"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return FlowSettleDwell.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the channels whose flow is settled.
+    /// </summary>
+    [Description("The channels whose flow is settled.")]
+    public partial class FlowSettled
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettled"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 126;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlowSettled"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlowSettled"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlowSettled"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlowChannels GetPayload(HarpMessage message)
+        {
+            return (FlowChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlowSettled"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlowChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlowSettled"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettled"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlowSettled"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettled"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlowSettled register.
+    /// </summary>
+    /// <seealso cref="FlowSettled"/>
+    [Description("Filters and selects timestamped messages from the FlowSettled register.")]
+    public partial class TimestampedFlowSettled
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettled"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlowSettled.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlowSettled"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetPayload(HarpMessage message)
+        {
+            return FlowSettled.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time in milliseconds from the last target change until each channel settled.
+    /// </summary>
+    [Description("Time in milliseconds from the last target change until each channel settled.")]
+    public partial class FlowSettleTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettleTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 127;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="FlowSettleTime"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="FlowSettleTime"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="FlowSettleTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="FlowSettleTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="FlowSettleTime"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettleTime"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="FlowSettleTime"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="FlowSettleTime"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// FlowSettleTime register.
+    /// </summary>
+    /// <seealso cref="FlowSettleTime"/>
+    [Description("Filters and selects timestamped messages from the FlowSettleTime register.")]
+    public partial class TimestampedFlowSettleTime
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="FlowSettleTime"/> register. This field is constant.
+        /// </summary>
+        public const int Address = FlowSettleTime.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="FlowSettleTime"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return FlowSettleTime.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.
+    /// </summary>
+    [Description("The channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.")]
+    public partial class PwmDither
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmDither"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 128;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmDither"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmDither"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmDither"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlowChannels GetPayload(HarpMessage message)
+        {
+            return (FlowChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmDither"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlowChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmDither"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmDither"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmDither"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmDither"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmDither register.
+    /// </summary>
+    /// <seealso cref="PwmDither"/>
+    [Description("Filters and selects timestamped messages from the PwmDither register.")]
+    public partial class TimestampedPwmDither
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmDither"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmDither.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmDither"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetPayload(HarpMessage message)
+        {
+            return PwmDither.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.
+    /// </summary>
+    [Description("Phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.")]
+    public partial class PwmPhase
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmPhase"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 129;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="PwmPhase"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="PwmPhase"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="PwmPhase"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="PwmPhase"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="PwmPhase"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmPhase"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="PwmPhase"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="PwmPhase"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// PwmPhase register.
+    /// </summary>
+    /// <seealso cref="PwmPhase"/>
+    [Description("Filters and selects timestamped messages from the PwmPhase register.")]
+    public partial class TimestampedPwmPhase
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="PwmPhase"/> register. This field is constant.
+        /// </summary>
+        public const int Address = PwmPhase.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="PwmPhase"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return PwmPhase.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.
+    /// </summary>
+    [Description("The channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.")]
+    public partial class ChannelsEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 130;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlowChannels GetPayload(HarpMessage message)
+        {
+            return (FlowChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlowChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsEnable register.
+    /// </summary>
+    /// <seealso cref="ChannelsEnable"/>
+    [Description("Filters and selects timestamped messages from the ChannelsEnable register.")]
+    public partial class TimestampedChannelsEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetPayload(HarpMessage message)
+        {
+            return ChannelsEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the channels that send actual flow events while the ChannelActualFlow event is enabled.
+    /// </summary>
+    [Description("The channels that send actual flow events while the ChannelActualFlow event is enabled.")]
+    public partial class ChannelsEnableEvents
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsEnableEvents"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 131;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsEnableEvents"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsEnableEvents"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsEnableEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlowChannels GetPayload(HarpMessage message)
+        {
+            return (FlowChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsEnableEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlowChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsEnableEvents"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsEnableEvents"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsEnableEvents"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsEnableEvents"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsEnableEvents register.
+    /// </summary>
+    /// <seealso cref="ChannelsEnableEvents"/>
+    [Description("Filters and selects timestamped messages from the ChannelsEnableEvents register.")]
+    public partial class TimestampedChannelsEnableEvents
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsEnableEvents"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsEnableEvents.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsEnableEvents"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetPayload(HarpMessage message)
+        {
+            return ChannelsEnableEvents.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the warm start of the channels from their last converged duty cycle.
+    /// </summary>
+    [Description("Configures the warm start of the channels from their last converged duty cycle.")]
+    public partial class WarmStart
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WarmStart"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 132;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="WarmStart"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="WarmStart"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="WarmStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static WarmStartConfig GetPayload(HarpMessage message)
+        {
+            return (WarmStartConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="WarmStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<WarmStartConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((WarmStartConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="WarmStart"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WarmStart"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, WarmStartConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="WarmStart"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="WarmStart"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, WarmStartConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// WarmStart register.
+    /// </summary>
+    /// <seealso cref="WarmStart"/>
+    [Description("Filters and selects timestamped messages from the WarmStart register.")]
+    public partial class TimestampedWarmStart
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="WarmStart"/> register. This field is constant.
+        /// </summary>
+        public const int Address = WarmStart.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="WarmStart"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<WarmStartConfig> GetPayload(HarpMessage message)
+        {
+            return WarmStart.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.
+    /// </summary>
+    [Description("Selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.")]
+    public partial class CalibrationProfile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationProfile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 133;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationProfile"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationProfile"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        static CalibrationProfilePayload ParsePayload(byte[] payload)
+        {
+            CalibrationProfilePayload result;
+            result.Channel0 = payload[0];
+            result.Channel1 = payload[1];
+            result.Channel2 = payload[2];
+            result.Channel3 = payload[3];
+            result.Channel4 = payload[4];
+            return result;
+        }
+
+        static byte[] FormatPayload(CalibrationProfilePayload value)
+        {
+            byte[] result;
+            result = new byte[5];
+            result[0] = value.Channel0;
+            result[1] = value.Channel1;
+            result[2] = value.Channel2;
+            result[3] = value.Channel3;
+            result[4] = value.Channel4;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationProfile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CalibrationProfilePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<byte>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationProfile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationProfilePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<byte>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationProfile"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationProfile"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CalibrationProfilePayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationProfile"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationProfile"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CalibrationProfilePayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationProfile register.
+    /// </summary>
+    /// <seealso cref="CalibrationProfile"/>
+    [Description("Filters and selects timestamped messages from the CalibrationProfile register.")]
+    public partial class TimestampedCalibrationProfile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationProfile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationProfile.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationProfile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationProfilePayload> GetPayload(HarpMessage message)
+        {
+            return CalibrationProfile.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.
+    /// </summary>
+    [Description("ASCII name stored with the next saved calibration profile. Reports the name of the last selected profile.")]
+    public partial class CalibrationProfileName
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationProfileName"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 134;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationProfileName"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationProfileName"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationProfileName"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationProfileName"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationProfileName"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationProfileName"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationProfileName"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationProfileName"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationProfileName register.
+    /// </summary>
+    /// <seealso cref="CalibrationProfileName"/>
+    [Description("Filters and selects timestamped messages from the CalibrationProfileName register.")]
+    public partial class TimestampedCalibrationProfileName
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationProfileName"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationProfileName.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationProfileName"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return CalibrationProfileName.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.
+    /// </summary>
+    [Description("Saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.")]
+    public partial class CalibrationProfileSave
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationProfileSave"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 135;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationProfileSave"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationProfileSave"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        static CalibrationProfileSavePayload ParsePayload(byte payload)
+        {
+            CalibrationProfileSavePayload result;
+            result.Channel = (byte)(payload & 0x7);
+            result.Profile = (byte)((payload & 0x30) >> 4);
+            return result;
+        }
+
+        static byte FormatPayload(CalibrationProfileSavePayload value)
+        {
+            byte result;
+            result = (byte)(value.Channel & 0x7);
+            result |= (byte)((value.Profile << 4) & 0x30);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationProfileSave"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CalibrationProfileSavePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadByte());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationProfileSave"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationProfileSavePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationProfileSave"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationProfileSave"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CalibrationProfileSavePayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationProfileSave"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationProfileSave"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CalibrationProfileSavePayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationProfileSave register.
+    /// </summary>
+    /// <seealso cref="CalibrationProfileSave"/>
+    [Description("Filters and selects timestamped messages from the CalibrationProfileSave register.")]
+    public partial class TimestampedCalibrationProfileSave
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationProfileSave"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationProfileSave.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationProfileSave"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationProfileSavePayload> GetPayload(HarpMessage message)
+        {
+            return CalibrationProfileSave.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.
+    /// </summary>
+    [Description("Calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.")]
+    public partial class CalibrationCurve
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationCurve"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 136;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationCurve"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationCurve"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 66;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationCurve"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationCurve"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationCurve"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationCurve"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationCurve"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationCurve"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationCurve register.
+    /// </summary>
+    /// <seealso cref="CalibrationCurve"/>
+    [Description("Filters and selects timestamped messages from the CalibrationCurve register.")]
+    public partial class TimestampedCalibrationCurve
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationCurve"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationCurve.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationCurve"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return CalibrationCurve.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.
+    /// </summary>
+    [Description("Starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.")]
+    public partial class CalibrationSweep
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSweep"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 137;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationSweep"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationSweep"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        static CalibrationSweepPayload ParsePayload(byte payload)
+        {
+            CalibrationSweepPayload result;
+            result.Channel = (byte)(payload & 0x7);
+            result.Run = (payload & 0x80) != 0;
+            return result;
+        }
+
+        static byte FormatPayload(CalibrationSweepPayload value)
+        {
+            byte result;
+            result = (byte)(value.Channel & 0x7);
+            result |= (byte)(value.Run ? 0x80 : 0);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationSweep"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CalibrationSweepPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadByte());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationSweep"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationSweepPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationSweep"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSweep"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CalibrationSweepPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationSweep"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSweep"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CalibrationSweepPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationSweep register.
+    /// </summary>
+    /// <seealso cref="CalibrationSweep"/>
+    [Description("Filters and selects timestamped messages from the CalibrationSweep register.")]
+    public partial class TimestampedCalibrationSweep
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSweep"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationSweep.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationSweep"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationSweepPayload> GetPayload(HarpMessage message)
+        {
+            return CalibrationSweep.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the calibration sweep.
+    /// </summary>
+    [Description("Configures the calibration sweep.")]
+    public partial class CalibrationSweepConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSweepConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 138;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationSweepConfig"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationSweepConfig"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        static CalibrationSweepConfigPayload ParsePayload(ushort[] payload)
+        {
+            CalibrationSweepConfigPayload result;
+            result.FirstDutyCycle = payload[0];
+            result.LastDutyCycle = payload[1];
+            result.Steps = payload[2];
+            result.SettleTime = payload[3];
+            result.AverageTime = payload[4];
+            return result;
+        }
+
+        static ushort[] FormatPayload(CalibrationSweepConfigPayload value)
+        {
+            ushort[] result;
+            result = new ushort[5];
+            result[0] = value.FirstDutyCycle;
+            result[1] = value.LastDutyCycle;
+            result[2] = value.Steps;
+            result[3] = value.SettleTime;
+            result[4] = value.AverageTime;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationSweepConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CalibrationSweepConfigPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationSweepConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationSweepConfigPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationSweepConfig"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSweepConfig"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CalibrationSweepConfigPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationSweepConfig"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSweepConfig"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CalibrationSweepConfigPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationSweepConfig register.
+    /// </summary>
+    /// <seealso cref="CalibrationSweepConfig"/>
+    [Description("Filters and selects timestamped messages from the CalibrationSweepConfig register.")]
+    public partial class TimestampedCalibrationSweepConfig
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSweepConfig"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationSweepConfig.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationSweepConfig"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationSweepConfigPayload> GetPayload(HarpMessage message)
+        {
+            return CalibrationSweepConfig.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.
+    /// </summary>
+    [Description("Reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.")]
+    public partial class CalibrationSweepData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSweepData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 139;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationSweepData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationSweepData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 18;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationSweepData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationSweepData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationSweepData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSweepData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationSweepData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSweepData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationSweepData register.
+    /// </summary>
+    /// <seealso cref="CalibrationSweepData"/>
+    [Description("Filters and selects timestamped messages from the CalibrationSweepData register.")]
+    public partial class TimestampedCalibrationSweepData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSweepData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationSweepData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationSweepData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return CalibrationSweepData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the volume delivered by each channel since it was last reset, in ul.
+    /// </summary>
+    [Description("The volume delivered by each channel since it was last reset, in ul.")]
+    public partial class ChannelsTotalVolume
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsTotalVolume"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 140;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsTotalVolume"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsTotalVolume"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsTotalVolume"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsTotalVolume"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsTotalVolume"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsTotalVolume"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsTotalVolume"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsTotalVolume"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsTotalVolume register.
+    /// </summary>
+    /// <seealso cref="ChannelsTotalVolume"/>
+    [Description("Filters and selects timestamped messages from the ChannelsTotalVolume register.")]
+    public partial class TimestampedChannelsTotalVolume
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsTotalVolume"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsTotalVolume.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsTotalVolume"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return ChannelsTotalVolume.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.
+    /// </summary>
+    [Description("The volume of each channel copied by the last TotalVolumeCommand latching it, in ul.")]
+    public partial class ChannelsTotalVolumeLatched
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsTotalVolumeLatched"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 141;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelsTotalVolumeLatched"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelsTotalVolumeLatched"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelsTotalVolumeLatched"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelsTotalVolumeLatched"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelsTotalVolumeLatched"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsTotalVolumeLatched"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelsTotalVolumeLatched"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelsTotalVolumeLatched"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelsTotalVolumeLatched register.
+    /// </summary>
+    /// <seealso cref="ChannelsTotalVolumeLatched"/>
+    [Description("Filters and selects timestamped messages from the ChannelsTotalVolumeLatched register.")]
+    public partial class TimestampedChannelsTotalVolumeLatched
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelsTotalVolumeLatched"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelsTotalVolumeLatched.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelsTotalVolumeLatched"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return ChannelsTotalVolumeLatched.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.
+    /// </summary>
+    [Description("Latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.")]
+    public partial class TotalVolumeCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TotalVolumeCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 142;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TotalVolumeCommand"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TotalVolumeCommand"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        static TotalVolumeCommandPayload ParsePayload(byte payload)
+        {
+            TotalVolumeCommandPayload result;
+            result.Channels = (FlowChannels)(payload & 0x1F);
+            result.Latch = (payload & 0x40) != 0;
+            result.Reset = (payload & 0x80) != 0;
+            return result;
+        }
+
+        static byte FormatPayload(TotalVolumeCommandPayload value)
+        {
+            byte result;
+            result = (byte)((byte)value.Channels & 0x1F);
+            result |= (byte)(value.Latch ? 0x40 : 0);
+            result |= (byte)(value.Reset ? 0x80 : 0);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TotalVolumeCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TotalVolumeCommandPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadByte());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TotalVolumeCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TotalVolumeCommandPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TotalVolumeCommand"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TotalVolumeCommand"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TotalVolumeCommandPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TotalVolumeCommand"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TotalVolumeCommand"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TotalVolumeCommandPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TotalVolumeCommand register.
+    /// </summary>
+    /// <seealso cref="TotalVolumeCommand"/>
+    [Description("Filters and selects timestamped messages from the TotalVolumeCommand register.")]
+    public partial class TimestampedTotalVolumeCommand
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TotalVolumeCommand"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TotalVolumeCommand.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TotalVolumeCommand"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TotalVolumeCommandPayload> GetPayload(HarpMessage message)
+        {
+            return TotalVolumeCommand.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the channels 0 to 3 that only add volume while the odor valve with the same number is open.
+    /// </summary>
+    [Description("The channels 0 to 3 that only add volume while the odor valve with the same number is open.")]
+    public partial class TotalVolumeGated
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TotalVolumeGated"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 143;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TotalVolumeGated"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TotalVolumeGated"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TotalVolumeGated"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlowChannels GetPayload(HarpMessage message)
+        {
+            return (FlowChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TotalVolumeGated"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlowChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TotalVolumeGated"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TotalVolumeGated"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TotalVolumeGated"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TotalVolumeGated"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TotalVolumeGated register.
+    /// </summary>
+    /// <seealso cref="TotalVolumeGated"/>
+    [Description("Filters and selects timestamped messages from the TotalVolumeGated register.")]
+    public partial class TimestampedTotalVolumeGated
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TotalVolumeGated"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TotalVolumeGated.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TotalVolumeGated"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetPayload(HarpMessage message)
+        {
+            return TotalVolumeGated.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.
+    /// </summary>
+    [Description("The total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.")]
+    public partial class MixTotalFlow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MixTotalFlow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 144;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MixTotalFlow"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MixTotalFlow"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MixTotalFlow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MixTotalFlow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadSingle();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MixTotalFlow"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MixTotalFlow"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MixTotalFlow"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MixTotalFlow"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MixTotalFlow register.
+    /// </summary>
+    /// <seealso cref="MixTotalFlow"/>
+    [Description("Filters and selects timestamped messages from the MixTotalFlow register.")]
+    public partial class TimestampedMixTotalFlow
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MixTotalFlow"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MixTotalFlow.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MixTotalFlow"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float> GetPayload(HarpMessage message)
+        {
+            return MixTotalFlow.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.
+    /// </summary>
+    [Description("The fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.")]
+    public partial class MixConcentrations
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MixConcentrations"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 145;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MixConcentrations"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.Float;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MixConcentrations"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MixConcentrations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static float[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MixConcentrations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<float>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MixConcentrations"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MixConcentrations"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MixConcentrations"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MixConcentrations"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, float[] value)
+        {
+            return HarpMessage.FromSingle(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MixConcentrations register.
+    /// </summary>
+    /// <seealso cref="MixConcentrations"/>
+    [Description("Filters and selects timestamped messages from the MixConcentrations register.")]
+    public partial class TimestampedMixConcentrations
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MixConcentrations"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MixConcentrations.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MixConcentrations"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<float[]> GetPayload(HarpMessage message)
+        {
+            return MixConcentrations.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.
+    /// </summary>
+    [Description("Sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.")]
+    public partial class MixEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MixEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 146;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="MixEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="MixEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="MixEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static EnableFlag GetPayload(HarpMessage message)
+        {
+            return (EnableFlag)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="MixEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((EnableFlag)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="MixEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MixEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="MixEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="MixEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, EnableFlag value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// MixEnable register.
+    /// </summary>
+    /// <seealso cref="MixEnable"/>
+    [Description("Filters and selects timestamped messages from the MixEnable register.")]
+    public partial class TimestampedMixEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="MixEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = MixEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="MixEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<EnableFlag> GetPayload(HarpMessage message)
+        {
+            return MixEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.
+    /// </summary>
+    [Description("Resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.")]
+    public partial class ProfilerControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilerControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 147;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilerControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilerControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        static ProfilerControlPayload ParsePayload(byte payload)
+        {
+            ProfilerControlPayload result;
+            result.Reset = (payload & 0x1) != 0;
+            result.Available = (payload & 0x80) != 0;
+            return result;
+        }
+
+        static byte FormatPayload(ProfilerControlPayload value)
+        {
+            byte result;
+            result = (byte)(value.Reset ? 0x1 : 0);
+            result |= (byte)(value.Available ? 0x80 : 0);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilerControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ProfilerControlPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadByte());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilerControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProfilerControlPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilerControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilerControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ProfilerControlPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilerControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilerControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ProfilerControlPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilerControl register.
+    /// </summary>
+    /// <seealso cref="ProfilerControl"/>
+    [Description("Filters and selects timestamped messages from the ProfilerControl register.")]
+    public partial class TimestampedProfilerControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilerControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilerControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilerControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ProfilerControlPayload> GetPayload(HarpMessage message)
+        {
+            return ProfilerControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).
+    /// </summary>
+    [Description("Selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).")]
+    public partial class ProfilerSite
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilerSite"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 148;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilerSite"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilerSite"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilerSite"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilerSite"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilerSite"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilerSite"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilerSite"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilerSite"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilerSite register.
+    /// </summary>
+    /// <seealso cref="ProfilerSite"/>
+    [Description("Filters and selects timestamped messages from the ProfilerSite register.")]
+    public partial class TimestampedProfilerSite
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilerSite"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilerSite.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilerSite"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ProfilerSite.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.
+    /// </summary>
+    [Description("Execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.")]
+    public partial class ProfilerData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilerData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 149;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ProfilerData"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ProfilerData"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ProfilerData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ProfilerData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ProfilerData"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilerData"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ProfilerData"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ProfilerData"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ProfilerData register.
+    /// </summary>
+    /// <seealso cref="ProfilerData"/>
+    [Description("Filters and selects timestamped messages from the ProfilerData register.")]
+    public partial class TimestampedProfilerData
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ProfilerData"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ProfilerData.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ProfilerData"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ProfilerData.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that updated each second.
+    /// </summary>
+    [Description("Updated each second.")]
+    public partial class CpuLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 150;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        static CpuLoadPayload ParsePayload(ushort[] payload)
+        {
+            CpuLoadPayload result;
+            result.Load = payload[0];
+            result.PeakLoad = payload[1];
+            result.MissedTicks = payload[2];
+            result.TotalMissedTicks = payload[3];
+            return result;
+        }
+
+        static ushort[] FormatPayload(CpuLoadPayload value)
+        {
+            ushort[] result;
+            result = new ushort[4];
+            result[0] = value.Load;
+            result[1] = value.PeakLoad;
+            result[2] = value.MissedTicks;
+            result[3] = value.TotalMissedTicks;
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CpuLoadPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadArray<ushort>());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CpuLoadPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadArray<ushort>();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CpuLoad"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CpuLoad"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CpuLoadPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CpuLoad"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CpuLoad"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CpuLoadPayload value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CpuLoad register.
+    /// </summary>
+    /// <seealso cref="CpuLoad"/>
+    [Description("Filters and selects timestamped messages from the CpuLoad register.")]
+    public partial class TimestampedCpuLoad
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CpuLoad"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CpuLoad.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CpuLoad"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CpuLoadPayload> GetPayload(HarpMessage message)
+        {
+            return CpuLoad.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the CPU load measurement.
+    /// </summary>
+    [Description("Configures the CPU load measurement.")]
+    public partial class CpuLoadControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CpuLoadControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 151;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CpuLoadControl"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CpuLoadControl"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        static CpuLoadControlPayload ParsePayload(byte payload)
+        {
+            CpuLoadControlPayload result;
+            result.Event = (payload & 0x1) != 0;
+            result.Clear = (payload & 0x2) != 0;
+            return result;
+        }
+
+        static byte FormatPayload(CpuLoadControlPayload value)
+        {
+            byte result;
+            result = (byte)(value.Event ? 0x1 : 0);
+            result |= (byte)(value.Clear ? 0x2 : 0);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CpuLoadControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CpuLoadControlPayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadByte());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CpuLoadControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CpuLoadControlPayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CpuLoadControl"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CpuLoadControl"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CpuLoadControlPayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CpuLoadControl"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CpuLoadControl"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CpuLoadControlPayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CpuLoadControl register.
+    /// </summary>
+    /// <seealso cref="CpuLoadControl"/>
+    [Description("Filters and selects timestamped messages from the CpuLoadControl register.")]
+    public partial class TimestampedCpuLoadControl
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CpuLoadControl"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CpuLoadControl.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CpuLoadControl"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CpuLoadControlPayload> GetPayload(HarpMessage message)
+        {
+            return CpuLoadControl.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the channel reported by LoopLatency.
+    /// </summary>
+    [Description("Selects the channel reported by LoopLatency.")]
+    public partial class LoopLatencyChannel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopLatencyChannel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 152;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoopLatencyChannel"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoopLatencyChannel"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoopLatencyChannel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoopLatencyChannel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoopLatencyChannel"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopLatencyChannel"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoopLatencyChannel"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopLatencyChannel"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoopLatencyChannel register.
+    /// </summary>
+    /// <seealso cref="LoopLatencyChannel"/>
+    [Description("Filters and selects timestamped messages from the LoopLatencyChannel register.")]
+    public partial class TimestampedLoopLatencyChannel
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopLatencyChannel"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoopLatencyChannel.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoopLatencyChannel"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return LoopLatencyChannel.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.
+    /// </summary>
+    [Description("Time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.")]
+    public partial class LoopLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 153;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoopLatency"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoopLatency"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 34;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoopLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoopLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoopLatency"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopLatency"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoopLatency"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopLatency"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoopLatency register.
+    /// </summary>
+    /// <seealso cref="LoopLatency"/>
+    [Description("Filters and selects timestamped messages from the LoopLatency register.")]
+    public partial class TimestampedLoopLatency
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopLatency"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoopLatency.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoopLatency"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return LoopLatency.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that clears the latency of the selected channels.
+    /// </summary>
+    [Description("Clears the latency of the selected channels.")]
+    public partial class LoopLatencyReset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopLatencyReset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 154;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="LoopLatencyReset"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="LoopLatencyReset"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="LoopLatencyReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static FlowChannels GetPayload(HarpMessage message)
+        {
+            return (FlowChannels)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="LoopLatencyReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((FlowChannels)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="LoopLatencyReset"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopLatencyReset"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="LoopLatencyReset"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="LoopLatencyReset"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, FlowChannels value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// LoopLatencyReset register.
+    /// </summary>
+    /// <seealso cref="LoopLatencyReset"/>
+    [Description("Filters and selects timestamped messages from the LoopLatencyReset register.")]
+    public partial class TimestampedLoopLatencyReset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="LoopLatencyReset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = LoopLatencyReset.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="LoopLatencyReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<FlowChannels> GetPayload(HarpMessage message)
+        {
+            return LoopLatencyReset.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.
+    /// </summary>
+    [Description("Longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.")]
+    public partial class SequenceSettleTimeout
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceSettleTimeout"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 155;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="SequenceSettleTimeout"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="SequenceSettleTimeout"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="SequenceSettleTimeout"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="SequenceSettleTimeout"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="SequenceSettleTimeout"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceSettleTimeout"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="SequenceSettleTimeout"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="SequenceSettleTimeout"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// SequenceSettleTimeout register.
+    /// </summary>
+    /// <seealso cref="SequenceSettleTimeout"/>
+    [Description("Filters and selects timestamped messages from the SequenceSettleTimeout register.")]
+    public partial class TimestampedSequenceSettleTimeout
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="SequenceSettleTimeout"/> register. This field is constant.
+        /// </summary>
+        public const int Address = SequenceSettleTimeout.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="SequenceSettleTimeout"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return SequenceSettleTimeout.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.
+    /// </summary>
+    [Description("Where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.")]
+    public partial class CalibrationSource
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSource"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 156;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CalibrationSource"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CalibrationSource"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        static CalibrationSourcePayload ParsePayload(byte payload)
+        {
+            CalibrationSourcePayload result;
+            result.Source = (FactoryCalibrationSource)(payload & 0x3);
+            result.RecordDamaged = (payload & 0x80) != 0;
+            return result;
+        }
+
+        static byte FormatPayload(CalibrationSourcePayload value)
+        {
+            byte result;
+            result = (byte)((byte)value.Source & 0x3);
+            result |= (byte)(value.RecordDamaged ? 0x80 : 0);
+            return result;
+        }
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CalibrationSource"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CalibrationSourcePayload GetPayload(HarpMessage message)
+        {
+            return ParsePayload(message.GetPayloadByte());
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CalibrationSource"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationSourcePayload> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create(ParsePayload(payload.Value), payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CalibrationSource"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSource"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CalibrationSourcePayload value)
+        {
+            return HarpMessage.FromByte(Address, messageType, FormatPayload(value));
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CalibrationSource"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CalibrationSource"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CalibrationSourcePayload value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, FormatPayload(value));
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CalibrationSource register.
+    /// </summary>
+    /// <seealso cref="CalibrationSource"/>
+    [Description("Filters and selects timestamped messages from the CalibrationSource register.")]
+    public partial class TimestampedCalibrationSource
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CalibrationSource"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CalibrationSource.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CalibrationSource"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CalibrationSourcePayload> GetPayload(HarpMessage message)
+        {
+            return CalibrationSource.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// Olfactometer device.
     /// </summary>
-    /// <seealso cref="CreateEnableFlowPayload"/>
-    /// <seealso cref="CreateFlowmeterPayload"/>
-    /// <seealso cref="CreateDI0StatePayload"/>
-    /// <seealso cref="CreateChannel0UserCalibrationPayload"/>
-    /// <seealso cref="CreateChannel1UserCalibrationPayload"/>
-    /// <seealso cref="CreateChannel2UserCalibrationPayload"/>
-    /// <seealso cref="CreateChannel3UserCalibrationPayload"/>
-    /// <seealso cref="CreateChannel4UserCalibrationPayload"/>
-    /// <seealso cref="CreateChannel3UserCalibrationAuxPayload"/>
-    /// <seealso cref="CreateEnableUserCalibrationPayload"/>
-    /// <seealso cref="CreateChannel0TargetFlowPayload"/>
-    /// <seealso cref="CreateChannel1TargetFlowPayload"/>
-    /// <seealso cref="CreateChannel2TargetFlowPayload"/>
-    /// <seealso cref="CreateChannel3TargetFlowPayload"/>
-    /// <seealso cref="CreateChannel4TargetFlowPayload"/>
-    /// <seealso cref="CreateChannelsTargetFlowPayload"/>
-    /// <seealso cref="CreateChannel0ActualFlowPayload"/>
-    /// <seealso cref="CreateChannel1ActualFlowPayload"/>
-    /// <seealso cref="CreateChannel2ActualFlowPayload"/>
-    /// <seealso cref="CreateChannel3ActualFlowPayload"/>
-    /// <seealso cref="CreateChannel4ActualFlowPayload"/>
-    /// <seealso cref="CreateChannel0DutyCyclePayload"/>
-    /// <seealso cref="CreateChannel1DutyCyclePayload"/>
-    /// <seealso cref="CreateChannel2DutyCyclePayload"/>
-    /// <seealso cref="CreateChannel3DutyCyclePayload"/>
-    /// <seealso cref="CreateChannel4DutyCyclePayload"/>
-    /// <seealso cref="CreateDigitalOutputSetPayload"/>
-    /// <seealso cref="CreateDigitalOutputClearPayload"/>
-    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
-    /// <seealso cref="CreateDigitalOutputStatePayload"/>
-    /// <seealso cref="CreateEnableValvePulsePayload"/>
-    /// <seealso cref="CreateValveSetPayload"/>
-    /// <seealso cref="CreateValveClearPayload"/>
-    /// <seealso cref="CreateValveTogglePayload"/>
-    /// <seealso cref="CreateValveStatePayload"/>
-    /// <seealso cref="CreateOdorValveStatePayload"/>
-    /// <seealso cref="CreateEndValveStatePayload"/>
-    /// <seealso cref="CreateCheckValveStatePayload"/>
-    /// <seealso cref="CreateValve0PulseDurationPayload"/>
-    /// <seealso cref="CreateValve1PulseDurationPayload"/>
-    /// <seealso cref="CreateValve2PulseDurationPayload"/>
-    /// <seealso cref="CreateValve3PulseDurationPayload"/>
-    /// <seealso cref="CreateCheckValve0DelayPulseDurationPayload"/>
-    /// <seealso cref="CreateCheckValve1DelayPulseDurationPayload"/>
-    /// <seealso cref="CreateCheckValve2DelayPulseDurationPayload"/>
-    /// <seealso cref="CreateCheckValve3DelayPulseDurationPayload"/>
-    /// <seealso cref="CreateEndValve0PulseDurationPayload"/>
-    /// <seealso cref="CreateEndValve1PulseDurationPayload"/>
-    /// <seealso cref="CreateDO0SyncPayload"/>
-    /// <seealso cref="CreateDO1SyncPayload"/>
-    /// <seealso cref="CreateDI0TriggerPayload"/>
-    /// <seealso cref="CreateMimicValve0Payload"/>
-    /// <seealso cref="CreateMimicValve1Payload"/>
-    /// <seealso cref="CreateMimicValve2Payload"/>
-    /// <seealso cref="CreateMimicValve3Payload"/>
-    /// <seealso cref="CreateMimicCheckValve0Payload"/>
-    /// <seealso cref="CreateMimicCheckValve1Payload"/>
-    /// <seealso cref="CreateMimicCheckValve2Payload"/>
-    /// <seealso cref="CreateMimicCheckValve3Payload"/>
-    /// <seealso cref="CreateMimicEndValve0Payload"/>
-    /// <seealso cref="CreateMimicEndValve1Payload"/>
-    /// <seealso cref="CreateEnableValveExternalControlPayload"/>
-    /// <seealso cref="CreateChannel3RangePayload"/>
-    /// <seealso cref="CreateEnableCheckValveSyncPayload"/>
-    /// <seealso cref="CreateTemperatureValuePayload"/>
-    /// <seealso cref="CreateEnableTemperatureCalibrationPayload"/>
-    /// <seealso cref="CreateTemperatureCalibrationValuePayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    [XmlInclude(typeof(CreateEnableFlowPayload))]
-    [XmlInclude(typeof(CreateFlowmeterPayload))]
-    [XmlInclude(typeof(CreateDI0StatePayload))]
-    [XmlInclude(typeof(CreateChannel0UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateChannel1UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateChannel2UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateChannel3UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateChannel4UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateChannel3UserCalibrationAuxPayload))]
-    [XmlInclude(typeof(CreateEnableUserCalibrationPayload))]
-    [XmlInclude(typeof(CreateChannel0TargetFlowPayload))]
-    [XmlInclude(typeof(CreateChannel1TargetFlowPayload))]
-    [XmlInclude(typeof(CreateChannel2TargetFlowPayload))]
-    [XmlInclude(typeof(CreateChannel3TargetFlowPayload))]
-    [XmlInclude(typeof(CreateChannel4TargetFlowPayload))]
-    [XmlInclude(typeof(CreateChannelsTargetFlowPayload))]
-    [XmlInclude(typeof(CreateChannel0ActualFlowPayload))]
-    [XmlInclude(typeof(CreateChannel1ActualFlowPayload))]
-    [XmlInclude(typeof(CreateChannel2ActualFlowPayload))]
-    [XmlInclude(typeof(CreateChannel3ActualFlowPayload))]
-    [XmlInclude(typeof(CreateChannel4ActualFlowPayload))]
-    [XmlInclude(typeof(CreateChannel0DutyCyclePayload))]
-    [XmlInclude(typeof(CreateChannel1DutyCyclePayload))]
-    [XmlInclude(typeof(CreateChannel2DutyCyclePayload))]
-    [XmlInclude(typeof(CreateChannel3DutyCyclePayload))]
-    [XmlInclude(typeof(CreateChannel4DutyCyclePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateEnableValvePulsePayload))]
-    [XmlInclude(typeof(CreateValveSetPayload))]
-    [XmlInclude(typeof(CreateValveClearPayload))]
-    [XmlInclude(typeof(CreateValveTogglePayload))]
-    [XmlInclude(typeof(CreateValveStatePayload))]
-    [XmlInclude(typeof(CreateOdorValveStatePayload))]
-    [XmlInclude(typeof(CreateEndValveStatePayload))]
-    [XmlInclude(typeof(CreateCheckValveStatePayload))]
-    [XmlInclude(typeof(CreateValve0PulseDurationPayload))]
-    [XmlInclude(typeof(CreateValve1PulseDurationPayload))]
-    [XmlInclude(typeof(CreateValve2PulseDurationPayload))]
-    [XmlInclude(typeof(CreateValve3PulseDurationPayload))]
-    [XmlInclude(typeof(CreateCheckValve0DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateCheckValve1DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateCheckValve2DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateCheckValve3DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateEndValve0PulseDurationPayload))]
-    [XmlInclude(typeof(CreateEndValve1PulseDurationPayload))]
-    [XmlInclude(typeof(CreateDO0SyncPayload))]
-    [XmlInclude(typeof(CreateDO1SyncPayload))]
-    [XmlInclude(typeof(CreateDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateMimicValve0Payload))]
-    [XmlInclude(typeof(CreateMimicValve1Payload))]
-    [XmlInclude(typeof(CreateMimicValve2Payload))]
-    [XmlInclude(typeof(CreateMimicValve3Payload))]
-    [XmlInclude(typeof(CreateMimicCheckValve0Payload))]
-    [XmlInclude(typeof(CreateMimicCheckValve1Payload))]
-    [XmlInclude(typeof(CreateMimicCheckValve2Payload))]
-    [XmlInclude(typeof(CreateMimicCheckValve3Payload))]
-    [XmlInclude(typeof(CreateMimicEndValve0Payload))]
-    [XmlInclude(typeof(CreateMimicEndValve1Payload))]
-    [XmlInclude(typeof(CreateEnableValveExternalControlPayload))]
-    [XmlInclude(typeof(CreateChannel3RangePayload))]
-    [XmlInclude(typeof(CreateEnableCheckValveSyncPayload))]
-    [XmlInclude(typeof(CreateTemperatureValuePayload))]
-    [XmlInclude(typeof(CreateEnableTemperatureCalibrationPayload))]
-    [XmlInclude(typeof(CreateTemperatureCalibrationValuePayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedFlowmeterPayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0StatePayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel0UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel1UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel2UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel3UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel4UserCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel3UserCalibrationAuxPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableUserCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel0TargetFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel1TargetFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel2TargetFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel3TargetFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel4TargetFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannelsTargetFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel0ActualFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel1ActualFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel2ActualFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel3ActualFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel4ActualFlowPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel0DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel1DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel2DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel3DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel4DutyCyclePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableValvePulsePayload))]
-    [XmlInclude(typeof(CreateTimestampedValveSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedValveClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedValveTogglePayload))]
-    [XmlInclude(typeof(CreateTimestampedValveStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedOdorValveStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedEndValveStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedCheckValveStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedValve0PulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedValve1PulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedValve2PulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedValve3PulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedCheckValve0DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedCheckValve1DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedCheckValve2DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedCheckValve3DelayPulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedEndValve0PulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedEndValve1PulseDurationPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedDO1SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedMimicValve0Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicValve1Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicValve2Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicValve3Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicCheckValve0Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicCheckValve1Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicCheckValve2Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicCheckValve3Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicEndValve0Payload))]
-    [XmlInclude(typeof(CreateTimestampedMimicEndValve1Payload))]
-    [XmlInclude(typeof(CreateTimestampedEnableValveExternalControlPayload))]
-    [XmlInclude(typeof(CreateTimestampedChannel3RangePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableCheckValveSyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedTemperatureValuePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableTemperatureCalibrationPayload))]
-    [XmlInclude(typeof(CreateTimestampedTemperatureCalibrationValuePayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [Description("Creates standard message payloads for the Olfactometer device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateEnableFlowPayload"/>
+    /// <seealso cref="CreateFlowmeterPayload"/>
+    /// <seealso cref="CreateDI0StatePayload"/>
+    /// <seealso cref="CreateChannel0UserCalibrationPayload"/>
+    /// <seealso cref="CreateChannel1UserCalibrationPayload"/>
+    /// <seealso cref="CreateChannel2UserCalibrationPayload"/>
+    /// <seealso cref="CreateChannel3UserCalibrationPayload"/>
+    /// <seealso cref="CreateChannel4UserCalibrationPayload"/>
+    /// <seealso cref="CreateChannel3UserCalibrationAuxPayload"/>
+    /// <seealso cref="CreateEnableUserCalibrationPayload"/>
+    /// <seealso cref="CreateChannel0TargetFlowPayload"/>
+    /// <seealso cref="CreateChannel1TargetFlowPayload"/>
+    /// <seealso cref="CreateChannel2TargetFlowPayload"/>
+    /// <seealso cref="CreateChannel3TargetFlowPayload"/>
+    /// <seealso cref="CreateChannel4TargetFlowPayload"/>
+    /// <seealso cref="CreateChannelsTargetFlowPayload"/>
+    /// <seealso cref="CreateChannel0ActualFlowPayload"/>
+    /// <seealso cref="CreateChannel1ActualFlowPayload"/>
+    /// <seealso cref="CreateChannel2ActualFlowPayload"/>
+    /// <seealso cref="CreateChannel3ActualFlowPayload"/>
+    /// <seealso cref="CreateChannel4ActualFlowPayload"/>
+    /// <seealso cref="CreateChannel0DutyCyclePayload"/>
+    /// <seealso cref="CreateChannel1DutyCyclePayload"/>
+    /// <seealso cref="CreateChannel2DutyCyclePayload"/>
+    /// <seealso cref="CreateChannel3DutyCyclePayload"/>
+    /// <seealso cref="CreateChannel4DutyCyclePayload"/>
+    /// <seealso cref="CreateDigitalOutputSetPayload"/>
+    /// <seealso cref="CreateDigitalOutputClearPayload"/>
+    /// <seealso cref="CreateDigitalOutputTogglePayload"/>
+    /// <seealso cref="CreateDigitalOutputStatePayload"/>
+    /// <seealso cref="CreateEnableValvePulsePayload"/>
+    /// <seealso cref="CreateValveSetPayload"/>
+    /// <seealso cref="CreateValveClearPayload"/>
+    /// <seealso cref="CreateValveTogglePayload"/>
+    /// <seealso cref="CreateValveStatePayload"/>
+    /// <seealso cref="CreateOdorValveStatePayload"/>
+    /// <seealso cref="CreateEndValveStatePayload"/>
+    /// <seealso cref="CreateCheckValveStatePayload"/>
+    /// <seealso cref="CreateValve0PulseDurationPayload"/>
+    /// <seealso cref="CreateValve1PulseDurationPayload"/>
+    /// <seealso cref="CreateValve2PulseDurationPayload"/>
+    /// <seealso cref="CreateValve3PulseDurationPayload"/>
+    /// <seealso cref="CreateCheckValve0DelayPulseDurationPayload"/>
+    /// <seealso cref="CreateCheckValve1DelayPulseDurationPayload"/>
+    /// <seealso cref="CreateCheckValve2DelayPulseDurationPayload"/>
+    /// <seealso cref="CreateCheckValve3DelayPulseDurationPayload"/>
+    /// <seealso cref="CreateEndValve0PulseDurationPayload"/>
+    /// <seealso cref="CreateEndValve1PulseDurationPayload"/>
+    /// <seealso cref="CreateDO0SyncPayload"/>
+    /// <seealso cref="CreateDO1SyncPayload"/>
+    /// <seealso cref="CreateDI0TriggerPayload"/>
+    /// <seealso cref="CreateMimicValve0Payload"/>
+    /// <seealso cref="CreateMimicValve1Payload"/>
+    /// <seealso cref="CreateMimicValve2Payload"/>
+    /// <seealso cref="CreateMimicValve3Payload"/>
+    /// <seealso cref="CreateMimicCheckValve0Payload"/>
+    /// <seealso cref="CreateMimicCheckValve1Payload"/>
+    /// <seealso cref="CreateMimicCheckValve2Payload"/>
+    /// <seealso cref="CreateMimicCheckValve3Payload"/>
+    /// <seealso cref="CreateMimicEndValve0Payload"/>
+    /// <seealso cref="CreateMimicEndValve1Payload"/>
+    /// <seealso cref="CreateEnableValveExternalControlPayload"/>
+    /// <seealso cref="CreateChannel3RangePayload"/>
+    /// <seealso cref="CreateEnableCheckValveSyncPayload"/>
+    /// <seealso cref="CreateTemperatureValuePayload"/>
+    /// <seealso cref="CreateEnableTemperatureCalibrationPayload"/>
+    /// <seealso cref="CreateTemperatureCalibrationValuePayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateValvesEventPayload"/>
+    /// <seealso cref="CreateValve0TrainPayload"/>
+    /// <seealso cref="CreateValve1TrainPayload"/>
+    /// <seealso cref="CreateValve2TrainPayload"/>
+    /// <seealso cref="CreateValve3TrainPayload"/>
+    /// <seealso cref="CreateEndValve0TrainPayload"/>
+    /// <seealso cref="CreateEndValve1TrainPayload"/>
+    /// <seealso cref="CreateStartValvesTrainPayload"/>
+    /// <seealso cref="CreateStopValvesTrainPayload"/>
+    /// <seealso cref="CreateValvesTrainDonePayload"/>
+    /// <seealso cref="CreateSequenceControlPayload"/>
+    /// <seealso cref="CreateSequenceLengthPayload"/>
+    /// <seealso cref="CreateSequenceStepIndexPayload"/>
+    /// <seealso cref="CreateSequenceStepPayload"/>
+    /// <seealso cref="CreateSequenceStepFlowsPayload"/>
+    /// <seealso cref="CreateDI0DebouncePayload"/>
+    /// <seealso cref="CreateFlowSettleTolerancePayload"/>
+    /// <seealso cref="CreateFlowSettleDwellPayload"/>
+    /// <seealso cref="CreateFlowSettledPayload"/>
+    /// <seealso cref="CreateFlowSettleTimePayload"/>
+    /// <seealso cref="CreatePwmDitherPayload"/>
+    /// <seealso cref="CreatePwmPhasePayload"/>
+    /// <seealso cref="CreateChannelsEnablePayload"/>
+    /// <seealso cref="CreateChannelsEnableEventsPayload"/>
+    /// <seealso cref="CreateWarmStartPayload"/>
+    /// <seealso cref="CreateCalibrationProfilePayload"/>
+    /// <seealso cref="CreateCalibrationProfileNamePayload"/>
+    /// <seealso cref="CreateCalibrationProfileSavePayload"/>
+    /// <seealso cref="CreateCalibrationCurvePayload"/>
+    /// <seealso cref="CreateCalibrationSweepPayload"/>
+    /// <seealso cref="CreateCalibrationSweepConfigPayload"/>
+    /// <seealso cref="CreateCalibrationSweepDataPayload"/>
+    /// <seealso cref="CreateChannelsTotalVolumePayload"/>
+    /// <seealso cref="CreateChannelsTotalVolumeLatchedPayload"/>
+    /// <seealso cref="CreateTotalVolumeCommandPayload"/>
+    /// <seealso cref="CreateTotalVolumeGatedPayload"/>
+    /// <seealso cref="CreateMixTotalFlowPayload"/>
+    /// <seealso cref="CreateMixConcentrationsPayload"/>
+    /// <seealso cref="CreateMixEnablePayload"/>
+    /// <seealso cref="CreateProfilerControlPayload"/>
+    /// <seealso cref="CreateProfilerSitePayload"/>
+    /// <seealso cref="CreateProfilerDataPayload"/>
+    /// <seealso cref="CreateCpuLoadPayload"/>
+    /// <seealso cref="CreateCpuLoadControlPayload"/>
+    /// <seealso cref="CreateLoopLatencyChannelPayload"/>
+    /// <seealso cref="CreateLoopLatencyPayload"/>
+    /// <seealso cref="CreateLoopLatencyResetPayload"/>
+    /// <seealso cref="CreateSequenceSettleTimeoutPayload"/>
+    /// <seealso cref="CreateCalibrationSourcePayload"/>
+    [XmlInclude(typeof(CreateEnableFlowPayload))]
+    [XmlInclude(typeof(CreateFlowmeterPayload))]
+    [XmlInclude(typeof(CreateDI0StatePayload))]
+    [XmlInclude(typeof(CreateChannel0UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateChannel1UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateChannel2UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateChannel3UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateChannel4UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateChannel3UserCalibrationAuxPayload))]
+    [XmlInclude(typeof(CreateEnableUserCalibrationPayload))]
+    [XmlInclude(typeof(CreateChannel0TargetFlowPayload))]
+    [XmlInclude(typeof(CreateChannel1TargetFlowPayload))]
+    [XmlInclude(typeof(CreateChannel2TargetFlowPayload))]
+    [XmlInclude(typeof(CreateChannel3TargetFlowPayload))]
+    [XmlInclude(typeof(CreateChannel4TargetFlowPayload))]
+    [XmlInclude(typeof(CreateChannelsTargetFlowPayload))]
+    [XmlInclude(typeof(CreateChannel0ActualFlowPayload))]
+    [XmlInclude(typeof(CreateChannel1ActualFlowPayload))]
+    [XmlInclude(typeof(CreateChannel2ActualFlowPayload))]
+    [XmlInclude(typeof(CreateChannel3ActualFlowPayload))]
+    [XmlInclude(typeof(CreateChannel4ActualFlowPayload))]
+    [XmlInclude(typeof(CreateChannel0DutyCyclePayload))]
+    [XmlInclude(typeof(CreateChannel1DutyCyclePayload))]
+    [XmlInclude(typeof(CreateChannel2DutyCyclePayload))]
+    [XmlInclude(typeof(CreateChannel3DutyCyclePayload))]
+    [XmlInclude(typeof(CreateChannel4DutyCyclePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateEnableValvePulsePayload))]
+    [XmlInclude(typeof(CreateValveSetPayload))]
+    [XmlInclude(typeof(CreateValveClearPayload))]
+    [XmlInclude(typeof(CreateValveTogglePayload))]
+    [XmlInclude(typeof(CreateValveStatePayload))]
+    [XmlInclude(typeof(CreateOdorValveStatePayload))]
+    [XmlInclude(typeof(CreateEndValveStatePayload))]
+    [XmlInclude(typeof(CreateCheckValveStatePayload))]
+    [XmlInclude(typeof(CreateValve0PulseDurationPayload))]
+    [XmlInclude(typeof(CreateValve1PulseDurationPayload))]
+    [XmlInclude(typeof(CreateValve2PulseDurationPayload))]
+    [XmlInclude(typeof(CreateValve3PulseDurationPayload))]
+    [XmlInclude(typeof(CreateCheckValve0DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateCheckValve1DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateCheckValve2DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateCheckValve3DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateEndValve0PulseDurationPayload))]
+    [XmlInclude(typeof(CreateEndValve1PulseDurationPayload))]
+    [XmlInclude(typeof(CreateDO0SyncPayload))]
+    [XmlInclude(typeof(CreateDO1SyncPayload))]
+    [XmlInclude(typeof(CreateDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateMimicValve0Payload))]
+    [XmlInclude(typeof(CreateMimicValve1Payload))]
+    [XmlInclude(typeof(CreateMimicValve2Payload))]
+    [XmlInclude(typeof(CreateMimicValve3Payload))]
+    [XmlInclude(typeof(CreateMimicCheckValve0Payload))]
+    [XmlInclude(typeof(CreateMimicCheckValve1Payload))]
+    [XmlInclude(typeof(CreateMimicCheckValve2Payload))]
+    [XmlInclude(typeof(CreateMimicCheckValve3Payload))]
+    [XmlInclude(typeof(CreateMimicEndValve0Payload))]
+    [XmlInclude(typeof(CreateMimicEndValve1Payload))]
+    [XmlInclude(typeof(CreateEnableValveExternalControlPayload))]
+    [XmlInclude(typeof(CreateChannel3RangePayload))]
+    [XmlInclude(typeof(CreateEnableCheckValveSyncPayload))]
+    [XmlInclude(typeof(CreateTemperatureValuePayload))]
+    [XmlInclude(typeof(CreateEnableTemperatureCalibrationPayload))]
+    [XmlInclude(typeof(CreateTemperatureCalibrationValuePayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateValvesEventPayload))]
+    [XmlInclude(typeof(CreateValve0TrainPayload))]
+    [XmlInclude(typeof(CreateValve1TrainPayload))]
+    [XmlInclude(typeof(CreateValve2TrainPayload))]
+    [XmlInclude(typeof(CreateValve3TrainPayload))]
+    [XmlInclude(typeof(CreateEndValve0TrainPayload))]
+    [XmlInclude(typeof(CreateEndValve1TrainPayload))]
+    [XmlInclude(typeof(CreateStartValvesTrainPayload))]
+    [XmlInclude(typeof(CreateStopValvesTrainPayload))]
+    [XmlInclude(typeof(CreateValvesTrainDonePayload))]
+    [XmlInclude(typeof(CreateSequenceControlPayload))]
+    [XmlInclude(typeof(CreateSequenceLengthPayload))]
+    [XmlInclude(typeof(CreateSequenceStepIndexPayload))]
+    [XmlInclude(typeof(CreateSequenceStepPayload))]
+    [XmlInclude(typeof(CreateSequenceStepFlowsPayload))]
+    [XmlInclude(typeof(CreateDI0DebouncePayload))]
+    [XmlInclude(typeof(CreateFlowSettleTolerancePayload))]
+    [XmlInclude(typeof(CreateFlowSettleDwellPayload))]
+    [XmlInclude(typeof(CreateFlowSettledPayload))]
+    [XmlInclude(typeof(CreateFlowSettleTimePayload))]
+    [XmlInclude(typeof(CreatePwmDitherPayload))]
+    [XmlInclude(typeof(CreatePwmPhasePayload))]
+    [XmlInclude(typeof(CreateChannelsEnablePayload))]
+    [XmlInclude(typeof(CreateChannelsEnableEventsPayload))]
+    [XmlInclude(typeof(CreateWarmStartPayload))]
+    [XmlInclude(typeof(CreateCalibrationProfilePayload))]
+    [XmlInclude(typeof(CreateCalibrationProfileNamePayload))]
+    [XmlInclude(typeof(CreateCalibrationProfileSavePayload))]
+    [XmlInclude(typeof(CreateCalibrationCurvePayload))]
+    [XmlInclude(typeof(CreateCalibrationSweepPayload))]
+    [XmlInclude(typeof(CreateCalibrationSweepConfigPayload))]
+    [XmlInclude(typeof(CreateCalibrationSweepDataPayload))]
+    [XmlInclude(typeof(CreateChannelsTotalVolumePayload))]
+    [XmlInclude(typeof(CreateChannelsTotalVolumeLatchedPayload))]
+    [XmlInclude(typeof(CreateTotalVolumeCommandPayload))]
+    [XmlInclude(typeof(CreateTotalVolumeGatedPayload))]
+    [XmlInclude(typeof(CreateMixTotalFlowPayload))]
+    [XmlInclude(typeof(CreateMixConcentrationsPayload))]
+    [XmlInclude(typeof(CreateMixEnablePayload))]
+    [XmlInclude(typeof(CreateProfilerControlPayload))]
+    [XmlInclude(typeof(CreateProfilerSitePayload))]
+    [XmlInclude(typeof(CreateProfilerDataPayload))]
+    [XmlInclude(typeof(CreateCpuLoadPayload))]
+    [XmlInclude(typeof(CreateCpuLoadControlPayload))]
+    [XmlInclude(typeof(CreateLoopLatencyChannelPayload))]
+    [XmlInclude(typeof(CreateLoopLatencyPayload))]
+    [XmlInclude(typeof(CreateLoopLatencyResetPayload))]
+    [XmlInclude(typeof(CreateSequenceSettleTimeoutPayload))]
+    [XmlInclude(typeof(CreateCalibrationSourcePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlowmeterPayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0StatePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel0UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel1UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel2UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel4UserCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3UserCalibrationAuxPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableUserCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel0TargetFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel1TargetFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel2TargetFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3TargetFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel4TargetFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsTargetFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel0ActualFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel1ActualFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel2ActualFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3ActualFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel4ActualFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel0DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel1DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel2DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel4DutyCyclePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableValvePulsePayload))]
+    [XmlInclude(typeof(CreateTimestampedValveSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedValveClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedValveTogglePayload))]
+    [XmlInclude(typeof(CreateTimestampedValveStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedOdorValveStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedEndValveStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedCheckValveStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedValve0PulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve1PulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve2PulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve3PulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedCheckValve0DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedCheckValve1DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedCheckValve2DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedCheckValve3DelayPulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedEndValve0PulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedEndValve1PulseDurationPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO0SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedDO1SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedMimicValve0Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicValve1Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicValve2Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicValve3Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicCheckValve0Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicCheckValve1Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicCheckValve2Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicCheckValve3Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicEndValve0Payload))]
+    [XmlInclude(typeof(CreateTimestampedMimicEndValve1Payload))]
+    [XmlInclude(typeof(CreateTimestampedEnableValveExternalControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannel3RangePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableCheckValveSyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedTemperatureValuePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableTemperatureCalibrationPayload))]
+    [XmlInclude(typeof(CreateTimestampedTemperatureCalibrationValuePayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedValvesEventPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve0TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve1TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve2TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedValve3TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedEndValve0TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedEndValve1TrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedStartValvesTrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedStopValvesTrainPayload))]
+    [XmlInclude(typeof(CreateTimestampedValvesTrainDonePayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceStepIndexPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceStepPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceStepFlowsPayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0DebouncePayload))]
+    [XmlInclude(typeof(CreateTimestampedFlowSettleTolerancePayload))]
+    [XmlInclude(typeof(CreateTimestampedFlowSettleDwellPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlowSettledPayload))]
+    [XmlInclude(typeof(CreateTimestampedFlowSettleTimePayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmDitherPayload))]
+    [XmlInclude(typeof(CreateTimestampedPwmPhasePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedWarmStartPayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationProfilePayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationProfileNamePayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationProfileSavePayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationCurvePayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationSweepPayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationSweepConfigPayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationSweepDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsTotalVolumePayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelsTotalVolumeLatchedPayload))]
+    [XmlInclude(typeof(CreateTimestampedTotalVolumeCommandPayload))]
+    [XmlInclude(typeof(CreateTimestampedTotalVolumeGatedPayload))]
+    [XmlInclude(typeof(CreateTimestampedMixTotalFlowPayload))]
+    [XmlInclude(typeof(CreateTimestampedMixConcentrationsPayload))]
+    [XmlInclude(typeof(CreateTimestampedMixEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilerControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilerSitePayload))]
+    [XmlInclude(typeof(CreateTimestampedProfilerDataPayload))]
+    [XmlInclude(typeof(CreateTimestampedCpuLoadPayload))]
+    [XmlInclude(typeof(CreateTimestampedCpuLoadControlPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoopLatencyChannelPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoopLatencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedLoopLatencyResetPayload))]
+    [XmlInclude(typeof(CreateTimestampedSequenceSettleTimeoutPayload))]
+    [XmlInclude(typeof(CreateTimestampedCalibrationSourcePayload))]
+    [Description("Creates standard message payloads for the Olfactometer device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateEnableFlowPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(Olfactometer)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts or stops the flow in all channels.
+    /// </summary>
+    [DisplayName("EnableFlowPayload")]
+    [Description("Creates a message payload that starts or stops the flow in all channels.")]
+    public partial class CreateEnableFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts or stops the flow in all channels.
+        /// </summary>
+        [Description("The value that starts or stops the flow in all channels.")]
+        public EnableFlag EnableFlow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return EnableFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that starts or stops the flow in all channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts or stops the flow in all channels.
+    /// </summary>
+    [DisplayName("TimestampedEnableFlowPayload")]
+    [Description("Creates a timestamped message payload that starts or stops the flow in all channels.")]
+    public partial class CreateTimestampedEnableFlowPayload : CreateEnableFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts or stops the flow in all channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that value of single ADC read from all flowmeter channels.
+    /// </summary>
+    [DisplayName("FlowmeterPayload")]
+    [Description("Creates a message payload that value of single ADC read from all flowmeter channels.")]
+    public partial class CreateFlowmeterPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel0.
+        /// </summary>
+        [Description("")]
+        public short Channel0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel1.
+        /// </summary>
+        [Description("")]
+        public short Channel1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel2.
+        /// </summary>
+        [Description("")]
+        public short Channel2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel3.
+        /// </summary>
+        [Description("")]
+        public short Channel3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel4.
+        /// </summary>
+        [Description("")]
+        public short Channel4 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Flowmeter register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public FlowmeterPayload GetPayload()
+        {
+            FlowmeterPayload value;
+            value.Channel0 = Channel0;
+            value.Channel1 = Channel1;
+            value.Channel2 = Channel2;
+            value.Channel3 = Channel3;
+            value.Channel4 = Channel4;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that value of single ADC read from all flowmeter channels.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Flowmeter register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Flowmeter.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that value of single ADC read from all flowmeter channels.
+    /// </summary>
+    [DisplayName("TimestampedFlowmeterPayload")]
+    [Description("Creates a timestamped message payload that value of single ADC read from all flowmeter channels.")]
+    public partial class CreateTimestampedFlowmeterPayload : CreateFlowmeterPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that value of single ADC read from all flowmeter channels.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Flowmeter register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Flowmeter.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that state of the digital input pin 0.
+    /// </summary>
+    [DisplayName("DI0StatePayload")]
+    [Description("Creates a message payload that state of the digital input pin 0.")]
+    public partial class CreateDI0StatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that state of the digital input pin 0.
+        /// </summary>
+        [Description("The value that state of the digital input pin 0.")]
+        public DigitalState DI0State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0State register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalState GetPayload()
+        {
+            return DI0State;
+        }
+
+        /// <summary>
+        /// Creates a message that state of the digital input pin 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0State register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DI0State.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that state of the digital input pin 0.
+    /// </summary>
+    [DisplayName("TimestampedDI0StatePayload")]
+    [Description("Creates a timestamped message payload that state of the digital input pin 0.")]
+    public partial class CreateTimestampedDI0StatePayload : CreateDI0StatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that state of the digital input pin 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0State register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DI0State.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("Channel0UserCalibrationPayload")]
+    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateChannel0UserCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+        public ushort[] Channel0UserCalibration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel0UserCalibration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Channel0UserCalibration;
+        }
+
+        /// <summary>
+        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel0UserCalibration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0UserCalibration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("TimestampedChannel0UserCalibrationPayload")]
+    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateTimestampedChannel0UserCalibrationPayload : CreateChannel0UserCalibrationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel0UserCalibration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("Channel1UserCalibrationPayload")]
+    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateChannel1UserCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+        public ushort[] Channel1UserCalibration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel1UserCalibration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Channel1UserCalibration;
+        }
+
+        /// <summary>
+        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel1UserCalibration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1UserCalibration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("TimestampedChannel1UserCalibrationPayload")]
+    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateTimestampedChannel1UserCalibrationPayload : CreateChannel1UserCalibrationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel1UserCalibration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("Channel2UserCalibrationPayload")]
+    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateChannel2UserCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+        public ushort[] Channel2UserCalibration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel2UserCalibration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Channel2UserCalibration;
+        }
+
+        /// <summary>
+        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel2UserCalibration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2UserCalibration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("TimestampedChannel2UserCalibrationPayload")]
+    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateTimestampedChannel2UserCalibrationPayload : CreateChannel2UserCalibrationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel2UserCalibration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("Channel3UserCalibrationPayload")]
+    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateChannel3UserCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+        public ushort[] Channel3UserCalibration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel3UserCalibration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Channel3UserCalibration;
+        }
+
+        /// <summary>
+        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel3UserCalibration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3UserCalibration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+    /// </summary>
+    [DisplayName("TimestampedChannel3UserCalibrationPayload")]
+    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.")]
+    public partial class CreateTimestampedChannel3UserCalibrationPayload : CreateChannel3UserCalibrationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min. The values must increase.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel3UserCalibration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// </summary>
+    [DisplayName("Channel4UserCalibrationPayload")]
+    [Description("Creates a message payload that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
+    public partial class CreateChannel4UserCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// </summary>
+        [Description("The value that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
+        public ushort[] Channel4UserCalibration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel4UserCalibration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Channel4UserCalibration;
+        }
+
+        /// <summary>
+        /// Creates a message that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel4UserCalibration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4UserCalibration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// </summary>
+    [DisplayName("TimestampedChannel4UserCalibrationPayload")]
+    [Description("Creates a timestamped message payload that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
+    public partial class CreateTimestampedChannel4UserCalibrationPayload : CreateChannel4UserCalibrationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel4UserCalibration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// </summary>
+    [DisplayName("Channel3UserCalibrationAuxPayload")]
+    [Description("Creates a message payload that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
+    public partial class CreateChannel3UserCalibrationAuxPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// </summary>
+        [Description("The value that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
+        public ushort[] Channel3UserCalibrationAux { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel3UserCalibrationAux register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Channel3UserCalibrationAux;
+        }
+
+        /// <summary>
+        /// Creates a message that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel3UserCalibrationAux register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3UserCalibrationAux.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// </summary>
+    [DisplayName("TimestampedChannel3UserCalibrationAuxPayload")]
+    [Description("Creates a timestamped message payload that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
+    public partial class CreateTimestampedChannel3UserCalibrationAuxPayload : CreateChannel3UserCalibrationAuxPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel3UserCalibrationAux register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3UserCalibrationAux.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+    /// </summary>
+    [DisplayName("EnableUserCalibrationPayload")]
+    [Description("Creates a message payload that override the factory calibration values, replacing with CHX_USER_CALIBRATION.")]
+    public partial class CreateEnableUserCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+        /// </summary>
+        [Description("The value that override the factory calibration values, replacing with CHX_USER_CALIBRATION.")]
+        public EnableFlag EnableUserCalibration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableUserCalibration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EnableFlag GetPayload()
+        {
+            return EnableUserCalibration;
+        }
+
+        /// <summary>
+        /// Creates a message that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableUserCalibration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableUserCalibration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+    /// </summary>
+    [DisplayName("TimestampedEnableUserCalibrationPayload")]
+    [Description("Creates a timestamped message payload that override the factory calibration values, replacing with CHX_USER_CALIBRATION.")]
+    public partial class CreateTimestampedEnableUserCalibrationPayload : CreateEnableUserCalibrationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableUserCalibration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableUserCalibration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the flow-rate rate for channel 0 [ml/min].
+    /// </summary>
+    [DisplayName("Channel0TargetFlowPayload")]
+    [Description("Creates a message payload that sets the flow-rate rate for channel 0 [ml/min].")]
+    public partial class CreateChannel0TargetFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the flow-rate rate for channel 0 [ml/min].
+        /// </summary>
+        [Range(min: 0, max: 100)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the flow-rate rate for channel 0 [ml/min].")]
+        public float Channel0TargetFlow { get; set; } = 0F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel0TargetFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel0TargetFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the flow-rate rate for channel 0 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel0TargetFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0TargetFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the flow-rate rate for channel 0 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel0TargetFlowPayload")]
+    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 0 [ml/min].")]
+    public partial class CreateTimestampedChannel0TargetFlowPayload : CreateChannel0TargetFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the flow-rate rate for channel 0 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel0TargetFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the flow-rate rate for channel 1 [ml/min].
+    /// </summary>
+    [DisplayName("Channel1TargetFlowPayload")]
+    [Description("Creates a message payload that sets the flow-rate rate for channel 1 [ml/min].")]
+    public partial class CreateChannel1TargetFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the flow-rate rate for channel 1 [ml/min].
+        /// </summary>
+        [Range(min: 0, max: 100)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the flow-rate rate for channel 1 [ml/min].")]
+        public float Channel1TargetFlow { get; set; } = 0F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel1TargetFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel1TargetFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the flow-rate rate for channel 1 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel1TargetFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1TargetFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the flow-rate rate for channel 1 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel1TargetFlowPayload")]
+    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 1 [ml/min].")]
+    public partial class CreateTimestampedChannel1TargetFlowPayload : CreateChannel1TargetFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the flow-rate rate for channel 1 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel1TargetFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the flow-rate rate for channel 2 [ml/min].
+    /// </summary>
+    [DisplayName("Channel2TargetFlowPayload")]
+    [Description("Creates a message payload that sets the flow-rate rate for channel 2 [ml/min].")]
+    public partial class CreateChannel2TargetFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the flow-rate rate for channel 2 [ml/min].
+        /// </summary>
+        [Range(min: 0, max: 100)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the flow-rate rate for channel 2 [ml/min].")]
+        public float Channel2TargetFlow { get; set; } = 0F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel2TargetFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel2TargetFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the flow-rate rate for channel 2 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel2TargetFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2TargetFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the flow-rate rate for channel 2 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel2TargetFlowPayload")]
+    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 2 [ml/min].")]
+    public partial class CreateTimestampedChannel2TargetFlowPayload : CreateChannel2TargetFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the flow-rate rate for channel 2 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel2TargetFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the flow-rate rate for channel 3 [ml/min].
+    /// </summary>
+    [DisplayName("Channel3TargetFlowPayload")]
+    [Description("Creates a message payload that sets the flow-rate rate for channel 3 [ml/min].")]
+    public partial class CreateChannel3TargetFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the flow-rate rate for channel 3 [ml/min].
+        /// </summary>
+        [Range(min: 0, max: 1000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the flow-rate rate for channel 3 [ml/min].")]
+        public float Channel3TargetFlow { get; set; } = 0F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel3TargetFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel3TargetFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the flow-rate rate for channel 3 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel3TargetFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3TargetFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the flow-rate rate for channel 3 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel3TargetFlowPayload")]
+    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 3 [ml/min].")]
+    public partial class CreateTimestampedChannel3TargetFlowPayload : CreateChannel3TargetFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the flow-rate rate for channel 3 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel3TargetFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the flow-rate rate for channel 4 [ml/min].
+    /// </summary>
+    [DisplayName("Channel4TargetFlowPayload")]
+    [Description("Creates a message payload that sets the flow-rate rate for channel 4 [ml/min].")]
+    public partial class CreateChannel4TargetFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the flow-rate rate for channel 4 [ml/min].
+        /// </summary>
+        [Range(min: 0, max: 1000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the flow-rate rate for channel 4 [ml/min].")]
+        public float Channel4TargetFlow { get; set; } = 0F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel4TargetFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel4TargetFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the flow-rate rate for channel 4 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel4TargetFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4TargetFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the flow-rate rate for channel 4 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel4TargetFlowPayload")]
+    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 4 [ml/min].")]
+    public partial class CreateTimestampedChannel4TargetFlowPayload : CreateChannel4TargetFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the flow-rate rate for channel 4 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel4TargetFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the flow-rate rate for all channels [ml/min].
+    /// </summary>
+    [DisplayName("ChannelsTargetFlowPayload")]
+    [Description("Creates a message payload that sets the flow-rate rate for all channels [ml/min].")]
+    public partial class CreateChannelsTargetFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel0.
+        /// </summary>
+        [Description("")]
+        public float Channel0 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel1.
+        /// </summary>
+        [Description("")]
+        public float Channel1 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel2.
+        /// </summary>
+        [Description("")]
+        public float Channel2 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel3.
+        /// </summary>
+        [Description("")]
+        public float Channel3 { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel4.
+        /// </summary>
+        [Description("")]
+        public float Channel4 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ChannelsTargetFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ChannelsTargetFlowPayload GetPayload()
+        {
+            ChannelsTargetFlowPayload value;
+            value.Channel0 = Channel0;
+            value.Channel1 = Channel1;
+            value.Channel2 = Channel2;
+            value.Channel3 = Channel3;
+            value.Channel4 = Channel4;
+            return value;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the flow-rate rate for all channels [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ChannelsTargetFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.ChannelsTargetFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the flow-rate rate for all channels [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannelsTargetFlowPayload")]
+    [Description("Creates a timestamped message payload that sets the flow-rate rate for all channels [ml/min].")]
+    public partial class CreateTimestampedChannelsTargetFlowPayload : CreateChannelsTargetFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the flow-rate rate for all channels [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ChannelsTargetFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.ChannelsTargetFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+    /// </summary>
+    [DisplayName("Channel0ActualFlowPayload")]
+    [Description("Creates a message payload that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].")]
+    public partial class CreateChannel0ActualFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+        /// </summary>
+        [Description("The value that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].")]
+        public float Channel0ActualFlow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel0ActualFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel0ActualFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel0ActualFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0ActualFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel0ActualFlowPayload")]
+    [Description("Creates a timestamped message payload that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].")]
+    public partial class CreateTimestampedChannel0ActualFlowPayload : CreateChannel0ActualFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel0ActualFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+    /// </summary>
+    [DisplayName("Channel1ActualFlowPayload")]
+    [Description("Creates a message payload that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].")]
+    public partial class CreateChannel1ActualFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+        /// </summary>
+        [Description("The value that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].")]
+        public float Channel1ActualFlow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel1ActualFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel1ActualFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel1ActualFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1ActualFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel1ActualFlowPayload")]
+    [Description("Creates a timestamped message payload that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].")]
+    public partial class CreateTimestampedChannel1ActualFlowPayload : CreateChannel1ActualFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel1ActualFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+    /// </summary>
+    [DisplayName("Channel2ActualFlowPayload")]
+    [Description("Creates a message payload that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].")]
+    public partial class CreateChannel2ActualFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+        /// </summary>
+        [Description("The value that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].")]
+        public float Channel2ActualFlow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel2ActualFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel2ActualFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel2ActualFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2ActualFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel2ActualFlowPayload")]
+    [Description("Creates a timestamped message payload that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].")]
+    public partial class CreateTimestampedChannel2ActualFlowPayload : CreateChannel2ActualFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel2ActualFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+    /// </summary>
+    [DisplayName("Channel3ActualFlowPayload")]
+    [Description("Creates a message payload that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].")]
+    public partial class CreateChannel3ActualFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+        /// </summary>
+        [Description("The value that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].")]
+        public float Channel3ActualFlow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel3ActualFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel3ActualFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel3ActualFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3ActualFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel3ActualFlowPayload")]
+    [Description("Creates a timestamped message payload that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].")]
+    public partial class CreateTimestampedChannel3ActualFlowPayload : CreateChannel3ActualFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel3ActualFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+    /// </summary>
+    [DisplayName("Channel4ActualFlowPayload")]
+    [Description("Creates a message payload that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].")]
+    public partial class CreateChannel4ActualFlowPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+        /// </summary>
+        [Description("The value that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].")]
+        public float Channel4ActualFlow { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Channel4ActualFlow register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel4ActualFlow;
+        }
+
+        /// <summary>
+        /// Creates a message that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel4ActualFlow register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4ActualFlow.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+    /// </summary>
+    [DisplayName("TimestampedChannel4ActualFlowPayload")]
+    [Description("Creates a timestamped message payload that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].")]
+    public partial class CreateTimestampedChannel4ActualFlowPayload : CreateChannel4ActualFlowPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel4ActualFlow register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle for proportional valve 0 [%].
+    /// </summary>
+    [DisplayName("Channel0DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle for proportional valve 0 [%].")]
+    public partial class CreateChannel0DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle for proportional valve 0 [%].
+        /// </summary>
+        [Range(min: 0.2, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle for proportional valve 0 [%].")]
+        public float Channel0DutyCycle { get; set; } = 0.2F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel0DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel0DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle for proportional valve 0 [%].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel0DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle for proportional valve 0 [%].
+    /// </summary>
+    [DisplayName("TimestampedChannel0DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle for proportional valve 0 [%].")]
+    public partial class CreateTimestampedChannel0DutyCyclePayload : CreateChannel0DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle for proportional valve 0 [%].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel0DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel0DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle for proportional valve 1 [%].
+    /// </summary>
+    [DisplayName("Channel1DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle for proportional valve 1 [%].")]
+    public partial class CreateChannel1DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle for proportional valve 1 [%].
+        /// </summary>
+        [Range(min: 0.2, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle for proportional valve 1 [%].")]
+        public float Channel1DutyCycle { get; set; } = 0.2F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel1DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel1DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle for proportional valve 1 [%].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel1DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle for proportional valve 1 [%].
+    /// </summary>
+    [DisplayName("TimestampedChannel1DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle for proportional valve 1 [%].")]
+    public partial class CreateTimestampedChannel1DutyCyclePayload : CreateChannel1DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle for proportional valve 1 [%].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel1DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel1DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle for proportional valve 2 [%].
+    /// </summary>
+    [DisplayName("Channel2DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle for proportional valve 2 [%].")]
+    public partial class CreateChannel2DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle for proportional valve 2 [%].
+        /// </summary>
+        [Range(min: 0.2, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle for proportional valve 2 [%].")]
+        public float Channel2DutyCycle { get; set; } = 0.2F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel2DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel2DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle for proportional valve 2 [%].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel2DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle for proportional valve 2 [%].
+    /// </summary>
+    [DisplayName("TimestampedChannel2DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle for proportional valve 2 [%].")]
+    public partial class CreateTimestampedChannel2DutyCyclePayload : CreateChannel2DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle for proportional valve 2 [%].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel2DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel2DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle for proportional valve 3 [%].
+    /// </summary>
+    [DisplayName("Channel3DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle for proportional valve 3 [%].")]
+    public partial class CreateChannel3DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle for proportional valve 3 [%].
+        /// </summary>
+        [Range(min: 0.2, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle for proportional valve 3 [%].")]
+        public float Channel3DutyCycle { get; set; } = 0.2F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel3DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel3DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle for proportional valve 3 [%].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel3DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle for proportional valve 3 [%].
+    /// </summary>
+    [DisplayName("TimestampedChannel3DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle for proportional valve 3 [%].")]
+    public partial class CreateTimestampedChannel3DutyCyclePayload : CreateChannel3DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle for proportional valve 3 [%].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel3DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that duty cycle for proportional valve 4 [%].
+    /// </summary>
+    [DisplayName("Channel4DutyCyclePayload")]
+    [Description("Creates a message payload that duty cycle for proportional valve 4 [%].")]
+    public partial class CreateChannel4DutyCyclePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that duty cycle for proportional valve 4 [%].
+        /// </summary>
+        [Range(min: 0.2, max: 99.9)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that duty cycle for proportional valve 4 [%].")]
+        public float Channel4DutyCycle { get; set; } = 0.2F;
+
+        /// <summary>
+        /// Creates a message payload for the Channel4DutyCycle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public float GetPayload()
+        {
+            return Channel4DutyCycle;
+        }
+
+        /// <summary>
+        /// Creates a message that duty cycle for proportional valve 4 [%].
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel4DutyCycle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4DutyCycle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that duty cycle for proportional valve 4 [%].
+    /// </summary>
+    [DisplayName("TimestampedChannel4DutyCyclePayload")]
+    [Description("Creates a timestamped message payload that duty cycle for proportional valve 4 [%].")]
+    public partial class CreateTimestampedChannel4DutyCyclePayload : CreateChannel4DutyCyclePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that duty cycle for proportional valve 4 [%].
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel4DutyCycle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel4DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clears the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputClearPayload")]
+    [Description("Creates a message payload that clears the specified digital output lines.")]
+    public partial class CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clears the specified digital output lines.
+        /// </summary>
+        [Description("The value that clears the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clears the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clears the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clears the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clears the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggles the specified digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputTogglePayload")]
+    [Description("Creates a message payload that toggles the specified digital output lines.")]
+    public partial class CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggles the specified digital output lines.
+        /// </summary>
+        [Description("The value that toggles the specified digital output lines.")]
+        public DigitalOutputs DigitalOutputToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggles the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggles the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputTogglePayload")]
+    [Description("Creates a timestamped message payload that toggles the specified digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggles the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("DigitalOutputStatePayload")]
+    [Description("Creates a message payload that write the state of all digital output lines.")]
+    public partial class CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all digital output lines.
+        /// </summary>
+        [Description("The value that write the state of all digital output lines.")]
+        public DigitalOutputs DigitalOutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalOutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return DigitalOutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedDigitalOutputStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
+    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enable pulse mode for valves.
+    /// </summary>
+    [DisplayName("EnableValvePulsePayload")]
+    [Description("Creates a message payload that enable pulse mode for valves.")]
+    public partial class CreateEnableValvePulsePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enable pulse mode for valves.
+        /// </summary>
+        [Description("The value that enable pulse mode for valves.")]
+        public Valves EnableValvePulse { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableValvePulse register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Valves GetPayload()
+        {
+            return EnableValvePulse;
+        }
+
+        /// <summary>
+        /// Creates a message that enable pulse mode for valves.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableValvePulse register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableValvePulse.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enable pulse mode for valves.
+    /// </summary>
+    [DisplayName("TimestampedEnableValvePulsePayload")]
+    [Description("Creates a timestamped message payload that enable pulse mode for valves.")]
+    public partial class CreateTimestampedEnableValvePulsePayload : CreateEnableValvePulsePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enable pulse mode for valves.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableValvePulse register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableValvePulse.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified valve output lines.
+    /// </summary>
+    [DisplayName("ValveSetPayload")]
+    [Description("Creates a message payload that set the specified valve output lines.")]
+    public partial class CreateValveSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified valve output lines.
+        /// </summary>
+        [Description("The value that set the specified valve output lines.")]
+        public Valves ValveSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ValveSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Valves GetPayload()
+        {
+            return ValveSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ValveSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedValveSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified valve output lines.")]
+    public partial class CreateTimestampedValveSetPayload : CreateValveSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ValveSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clears the specified valve output lines.
+    /// </summary>
+    [DisplayName("ValveClearPayload")]
+    [Description("Creates a message payload that clears the specified valve output lines.")]
+    public partial class CreateValveClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clears the specified valve output lines.
+        /// </summary>
+        [Description("The value that clears the specified valve output lines.")]
+        public Valves ValveClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ValveClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Valves GetPayload()
+        {
+            return ValveClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clears the specified valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ValveClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clears the specified valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedValveClearPayload")]
+    [Description("Creates a timestamped message payload that clears the specified valve output lines.")]
+    public partial class CreateTimestampedValveClearPayload : CreateValveClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clears the specified valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ValveClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that toggles the specified valve output lines.
+    /// </summary>
+    [DisplayName("ValveTogglePayload")]
+    [Description("Creates a message payload that toggles the specified valve output lines.")]
+    public partial class CreateValveTogglePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that toggles the specified valve output lines.
+        /// </summary>
+        [Description("The value that toggles the specified valve output lines.")]
+        public Valves ValveToggle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ValveToggle register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Valves GetPayload()
+        {
+            return ValveToggle;
+        }
+
+        /// <summary>
+        /// Creates a message that toggles the specified valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ValveToggle register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveToggle.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that toggles the specified valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedValveTogglePayload")]
+    [Description("Creates a timestamped message payload that toggles the specified valve output lines.")]
+    public partial class CreateTimestampedValveTogglePayload : CreateValveTogglePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that toggles the specified valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ValveToggle register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveToggle.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that controls the specified valve output lines.
+    /// </summary>
+    [DisplayName("ValveStatePayload")]
+    [Description("Creates a message payload that controls the specified valve output lines.")]
+    public partial class CreateValveStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that controls the specified valve output lines.
+        /// </summary>
+        [Description("The value that controls the specified valve output lines.")]
+        public Valves ValveState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ValveState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Valves GetPayload()
+        {
+            return ValveState;
+        }
+
+        /// <summary>
+        /// Creates a message that controls the specified valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ValveState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that controls the specified valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedValveStatePayload")]
+    [Description("Creates a timestamped message payload that controls the specified valve output lines.")]
+    public partial class CreateTimestampedValveStatePayload : CreateValveStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that controls the specified valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ValveState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.ValveState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all odor valve output lines.
+    /// </summary>
+    [DisplayName("OdorValveStatePayload")]
+    [Description("Creates a message payload that write the state of all odor valve output lines.")]
+    public partial class CreateOdorValveStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all odor valve output lines.
+        /// </summary>
+        [Description("The value that write the state of all odor valve output lines.")]
+        public OdorValves OdorValveState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OdorValveState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public OdorValves GetPayload()
+        {
+            return OdorValveState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all odor valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OdorValveState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.OdorValveState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all odor valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedOdorValveStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all odor valve output lines.")]
+    public partial class CreateTimestampedOdorValveStatePayload : CreateOdorValveStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all odor valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OdorValveState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.OdorValveState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all end valve output lines.
+    /// </summary>
+    [DisplayName("EndValveStatePayload")]
+    [Description("Creates a message payload that write the state of all end valve output lines.")]
+    public partial class CreateEndValveStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all end valve output lines.
+        /// </summary>
+        [Description("The value that write the state of all end valve output lines.")]
+        public EndValves EndValveState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EndValveState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public EndValves GetPayload()
+        {
+            return EndValveState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all end valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EndValveState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EndValveState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all end valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedEndValveStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all end valve output lines.")]
+    public partial class CreateTimestampedEndValveStatePayload : CreateEndValveStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all end valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EndValveState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EndValveState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all check valve output lines.
+    /// </summary>
+    [DisplayName("CheckValveStatePayload")]
+    [Description("Creates a message payload that write the state of all check valve output lines.")]
+    public partial class CreateCheckValveStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all check valve output lines.
+        /// </summary>
+        [Description("The value that write the state of all check valve output lines.")]
+        public CheckValves CheckValveState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CheckValveState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public CheckValves GetPayload()
+        {
+            return CheckValveState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all check valve output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CheckValveState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValveState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all check valve output lines.
+    /// </summary>
+    [DisplayName("TimestampedCheckValveStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all check valve output lines.")]
+    public partial class CreateTimestampedCheckValveStatePayload : CreateCheckValveStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all check valve output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CheckValveState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValveState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the pulse duration for Valve0.
+    /// </summary>
+    [DisplayName("Valve0PulseDurationPayload")]
+    [Description("Creates a message payload that sets the pulse duration for Valve0.")]
+    public partial class CreateValve0PulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the pulse duration for Valve0.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the pulse duration for Valve0.")]
+        public ushort Valve0PulseDuration { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Valve0PulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Valve0PulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the pulse duration for Valve0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Valve0PulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve0PulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the pulse duration for Valve0.
+    /// </summary>
+    [DisplayName("TimestampedValve0PulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse duration for Valve0.")]
+    public partial class CreateTimestampedValve0PulseDurationPayload : CreateValve0PulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the pulse duration for Valve0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Valve0PulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve0PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the pulse duration for Valve1.
+    /// </summary>
+    [DisplayName("Valve1PulseDurationPayload")]
+    [Description("Creates a message payload that sets the pulse duration for Valve1.")]
+    public partial class CreateValve1PulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the pulse duration for Valve1.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the pulse duration for Valve1.")]
+        public ushort Valve1PulseDuration { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Valve1PulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Valve1PulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the pulse duration for Valve1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Valve1PulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve1PulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the pulse duration for Valve1.
+    /// </summary>
+    [DisplayName("TimestampedValve1PulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse duration for Valve1.")]
+    public partial class CreateTimestampedValve1PulseDurationPayload : CreateValve1PulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the pulse duration for Valve1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Valve1PulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve1PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the pulse duration for Valve2.
+    /// </summary>
+    [DisplayName("Valve2PulseDurationPayload")]
+    [Description("Creates a message payload that sets the pulse duration for Valve2.")]
+    public partial class CreateValve2PulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the pulse duration for Valve2.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the pulse duration for Valve2.")]
+        public ushort Valve2PulseDuration { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Valve2PulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Valve2PulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the pulse duration for Valve2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Valve2PulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve2PulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the pulse duration for Valve2.
+    /// </summary>
+    [DisplayName("TimestampedValve2PulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse duration for Valve2.")]
+    public partial class CreateTimestampedValve2PulseDurationPayload : CreateValve2PulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the pulse duration for Valve2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Valve2PulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve2PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the pulse duration for Valve3.
+    /// </summary>
+    [DisplayName("Valve3PulseDurationPayload")]
+    [Description("Creates a message payload that sets the pulse duration for Valve3.")]
+    public partial class CreateValve3PulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the pulse duration for Valve3.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the pulse duration for Valve3.")]
+        public ushort Valve3PulseDuration { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Valve3PulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Valve3PulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the pulse duration for Valve3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Valve3PulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve3PulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the pulse duration for Valve3.
+    /// </summary>
+    [DisplayName("TimestampedValve3PulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse duration for Valve3.")]
+    public partial class CreateTimestampedValve3PulseDurationPayload : CreateValve3PulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the pulse duration for Valve3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Valve3PulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Valve3PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+    /// </summary>
+    [DisplayName("CheckValve0DelayPulseDurationPayload")]
+    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.")]
+    public partial class CreateCheckValve0DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+        /// </summary>
+        [Range(min: 0, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.")]
+        public ushort CheckValve0DelayPulseDuration { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the CheckValve0DelayPulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return CheckValve0DelayPulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CheckValve0DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve0DelayPulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+    /// </summary>
+    [DisplayName("TimestampedCheckValve0DelayPulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.")]
+    public partial class CreateTimestampedCheckValve0DelayPulseDurationPayload : CreateCheckValve0DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CheckValve0DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve0DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+    /// </summary>
+    [DisplayName("CheckValve1DelayPulseDurationPayload")]
+    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.")]
+    public partial class CreateCheckValve1DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+        /// </summary>
+        [Range(min: 0, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.")]
+        public ushort CheckValve1DelayPulseDuration { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the CheckValve1DelayPulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return CheckValve1DelayPulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CheckValve1DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve1DelayPulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+    /// </summary>
+    [DisplayName("TimestampedCheckValve1DelayPulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.")]
+    public partial class CreateTimestampedCheckValve1DelayPulseDurationPayload : CreateCheckValve1DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CheckValve1DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve1DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+    /// </summary>
+    [DisplayName("CheckValve2DelayPulseDurationPayload")]
+    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.")]
+    public partial class CreateCheckValve2DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+        /// </summary>
+        [Range(min: 0, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.")]
+        public ushort CheckValve2DelayPulseDuration { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the CheckValve2DelayPulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return CheckValve2DelayPulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CheckValve2DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve2DelayPulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+    /// </summary>
+    [DisplayName("TimestampedCheckValve2DelayPulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.")]
+    public partial class CreateTimestampedCheckValve2DelayPulseDurationPayload : CreateCheckValve2DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CheckValve2DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve2DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+    /// </summary>
+    [DisplayName("CheckValve3DelayPulseDurationPayload")]
+    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.")]
+    public partial class CreateCheckValve3DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+        /// </summary>
+        [Range(min: 0, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.")]
+        public ushort CheckValve3DelayPulseDuration { get; set; } = 0;
+
+        /// <summary>
+        /// Creates a message payload for the CheckValve3DelayPulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return CheckValve3DelayPulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CheckValve3DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve3DelayPulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+    /// </summary>
+    [DisplayName("TimestampedCheckValve3DelayPulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.")]
+    public partial class CreateTimestampedCheckValve3DelayPulseDurationPayload : CreateCheckValve3DelayPulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CheckValve3DelayPulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.CheckValve3DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the pulse duration for EndValve0.
+    /// </summary>
+    [DisplayName("EndValve0PulseDurationPayload")]
+    [Description("Creates a message payload that sets the pulse duration for EndValve0.")]
+    public partial class CreateEndValve0PulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the pulse duration for EndValve0.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the pulse duration for EndValve0.")]
+        public ushort EndValve0PulseDuration { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the EndValve0PulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return EndValve0PulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the pulse duration for EndValve0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EndValve0PulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EndValve0PulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the pulse duration for EndValve0.
+    /// </summary>
+    [DisplayName("TimestampedEndValve0PulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse duration for EndValve0.")]
+    public partial class CreateTimestampedEndValve0PulseDurationPayload : CreateEndValve0PulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the pulse duration for EndValve0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EndValve0PulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EndValve0PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that sets the pulse duration for EndValve1.
+    /// </summary>
+    [DisplayName("EndValve1PulseDurationPayload")]
+    [Description("Creates a message payload that sets the pulse duration for EndValve1.")]
+    public partial class CreateEndValve1PulseDurationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that sets the pulse duration for EndValve1.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that sets the pulse duration for EndValve1.")]
+        public ushort EndValve1PulseDuration { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the EndValve1PulseDuration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return EndValve1PulseDuration;
+        }
+
+        /// <summary>
+        /// Creates a message that sets the pulse duration for EndValve1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EndValve1PulseDuration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EndValve1PulseDuration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that sets the pulse duration for EndValve1.
+    /// </summary>
+    [DisplayName("TimestampedEndValve1PulseDurationPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse duration for EndValve1.")]
+    public partial class CreateTimestampedEndValve1PulseDurationPayload : CreateEndValve1PulseDurationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that sets the pulse duration for EndValve1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EndValve1PulseDuration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EndValve1PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital output 0 (DOUT0).
+    /// </summary>
+    [DisplayName("DO0SyncPayload")]
+    [Description("Creates a message payload that configuration of the digital output 0 (DOUT0).")]
+    public partial class CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital output 0 (DOUT0).
+        /// </summary>
+        [Description("The value that configuration of the digital output 0 (DOUT0).")]
+        public DO0SyncConfig DO0Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO0Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO0SyncConfig GetPayload()
+        {
+            return DO0Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital output 0 (DOUT0).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DO0Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital output 0 (DOUT0).
+    /// </summary>
+    [DisplayName("TimestampedDO0SyncPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital output 0 (DOUT0).")]
+    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital output 0 (DOUT0).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital output 1 (DOUT1).
+    /// </summary>
+    [DisplayName("DO1SyncPayload")]
+    [Description("Creates a message payload that configuration of the digital output 1 (DOUT1).")]
+    public partial class CreateDO1SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital output 1 (DOUT1).
+        /// </summary>
+        [Description("The value that configuration of the digital output 1 (DOUT1).")]
+        public DO1SyncConfig DO1Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DO1Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DO1SyncConfig GetPayload()
+        {
+            return DO1Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital output 1 (DOUT1).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DO1Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DO1Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital output 1 (DOUT1).
+    /// </summary>
+    [DisplayName("TimestampedDO1SyncPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital output 1 (DOUT1).")]
+    public partial class CreateTimestampedDO1SyncPayload : CreateDO1SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital output 1 (DOUT1).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DO1Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DO1Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configuration of the digital input pin 0 (DIN0).
+    /// </summary>
+    [DisplayName("DI0TriggerPayload")]
+    [Description("Creates a message payload that configuration of the digital input pin 0 (DIN0).")]
+    public partial class CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configuration of the digital input pin 0 (DIN0).
+        /// </summary>
+        [Description("The value that configuration of the digital input pin 0 (DIN0).")]
+        public DI0TriggerConfig DI0Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DI0TriggerConfig GetPayload()
+        {
+            return DI0Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that configuration of the digital input pin 0 (DIN0).
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.DI0Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configuration of the digital input pin 0 (DIN0).
+    /// </summary>
+    [DisplayName("TimestampedDI0TriggerPayload")]
+    [Description("Creates a timestamped message payload that configuration of the digital input pin 0 (DIN0).")]
+    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configuration of the digital input pin 0 (DIN0).
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Valve0.
+    /// </summary>
+    [DisplayName("MimicValve0Payload")]
+    [Description("Creates a message payload that mimic Valve0.")]
+    public partial class CreateMimicValve0Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Valve0.
+        /// </summary>
+        [Description("The value that mimic Valve0.")]
+        public MimicOutputs MimicValve0 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicValve0 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicValve0;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Valve0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicValve0 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve0.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Valve0.
+    /// </summary>
+    [DisplayName("TimestampedMimicValve0Payload")]
+    [Description("Creates a timestamped message payload that mimic Valve0.")]
+    public partial class CreateTimestampedMimicValve0Payload : CreateMimicValve0Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Valve0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicValve0 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve0.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Valve1.
+    /// </summary>
+    [DisplayName("MimicValve1Payload")]
+    [Description("Creates a message payload that mimic Valve1.")]
+    public partial class CreateMimicValve1Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Valve1.
+        /// </summary>
+        [Description("The value that mimic Valve1.")]
+        public MimicOutputs MimicValve1 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicValve1 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicValve1;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Valve1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicValve1 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve1.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Valve1.
+    /// </summary>
+    [DisplayName("TimestampedMimicValve1Payload")]
+    [Description("Creates a timestamped message payload that mimic Valve1.")]
+    public partial class CreateTimestampedMimicValve1Payload : CreateMimicValve1Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Valve1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicValve1 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve1.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Valve2.
+    /// </summary>
+    [DisplayName("MimicValve2Payload")]
+    [Description("Creates a message payload that mimic Valve2.")]
+    public partial class CreateMimicValve2Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Valve2.
+        /// </summary>
+        [Description("The value that mimic Valve2.")]
+        public MimicOutputs MimicValve2 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicValve2 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicValve2;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Valve2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicValve2 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve2.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Valve2.
+    /// </summary>
+    [DisplayName("TimestampedMimicValve2Payload")]
+    [Description("Creates a timestamped message payload that mimic Valve2.")]
+    public partial class CreateTimestampedMimicValve2Payload : CreateMimicValve2Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Valve2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicValve2 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve2.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Valve3.
+    /// </summary>
+    [DisplayName("MimicValve3Payload")]
+    [Description("Creates a message payload that mimic Valve3.")]
+    public partial class CreateMimicValve3Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Valve3.
+        /// </summary>
+        [Description("The value that mimic Valve3.")]
+        public MimicOutputs MimicValve3 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicValve3 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicValve3;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Valve3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicValve3 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve3.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Valve3.
+    /// </summary>
+    [DisplayName("TimestampedMimicValve3Payload")]
+    [Description("Creates a timestamped message payload that mimic Valve3.")]
+    public partial class CreateTimestampedMimicValve3Payload : CreateMimicValve3Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Valve3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicValve3 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicValve3.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Check Valve0.
+    /// </summary>
+    [DisplayName("MimicCheckValve0Payload")]
+    [Description("Creates a message payload that mimic Check Valve0.")]
+    public partial class CreateMimicCheckValve0Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Check Valve0.
+        /// </summary>
+        [Description("The value that mimic Check Valve0.")]
+        public MimicOutputs MimicCheckValve0 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicCheckValve0 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicCheckValve0;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Check Valve0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicCheckValve0 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve0.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Check Valve0.
+    /// </summary>
+    [DisplayName("TimestampedMimicCheckValve0Payload")]
+    [Description("Creates a timestamped message payload that mimic Check Valve0.")]
+    public partial class CreateTimestampedMimicCheckValve0Payload : CreateMimicCheckValve0Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Check Valve0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicCheckValve0 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve0.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Check Valve1.
+    /// </summary>
+    [DisplayName("MimicCheckValve1Payload")]
+    [Description("Creates a message payload that mimic Check Valve1.")]
+    public partial class CreateMimicCheckValve1Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Check Valve1.
+        /// </summary>
+        [Description("The value that mimic Check Valve1.")]
+        public MimicOutputs MimicCheckValve1 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicCheckValve1 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicCheckValve1;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Check Valve1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicCheckValve1 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve1.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Check Valve1.
+    /// </summary>
+    [DisplayName("TimestampedMimicCheckValve1Payload")]
+    [Description("Creates a timestamped message payload that mimic Check Valve1.")]
+    public partial class CreateTimestampedMimicCheckValve1Payload : CreateMimicCheckValve1Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Check Valve1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicCheckValve1 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve1.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Check Valve2.
+    /// </summary>
+    [DisplayName("MimicCheckValve2Payload")]
+    [Description("Creates a message payload that mimic Check Valve2.")]
+    public partial class CreateMimicCheckValve2Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Check Valve2.
+        /// </summary>
+        [Description("The value that mimic Check Valve2.")]
+        public MimicOutputs MimicCheckValve2 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicCheckValve2 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicCheckValve2;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Check Valve2.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicCheckValve2 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve2.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Check Valve2.
+    /// </summary>
+    [DisplayName("TimestampedMimicCheckValve2Payload")]
+    [Description("Creates a timestamped message payload that mimic Check Valve2.")]
+    public partial class CreateTimestampedMimicCheckValve2Payload : CreateMimicCheckValve2Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Check Valve2.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicCheckValve2 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve2.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic Check Valve3.
+    /// </summary>
+    [DisplayName("MimicCheckValve3Payload")]
+    [Description("Creates a message payload that mimic Check Valve3.")]
+    public partial class CreateMimicCheckValve3Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic Check Valve3.
+        /// </summary>
+        [Description("The value that mimic Check Valve3.")]
+        public MimicOutputs MimicCheckValve3 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicCheckValve3 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicCheckValve3;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic Check Valve3.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicCheckValve3 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve3.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic Check Valve3.
+    /// </summary>
+    [DisplayName("TimestampedMimicCheckValve3Payload")]
+    [Description("Creates a timestamped message payload that mimic Check Valve3.")]
+    public partial class CreateTimestampedMimicCheckValve3Payload : CreateMimicCheckValve3Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic Check Valve3.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicCheckValve3 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicCheckValve3.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic EndValve0.
+    /// </summary>
+    [DisplayName("MimicEndValve0Payload")]
+    [Description("Creates a message payload that mimic EndValve0.")]
+    public partial class CreateMimicEndValve0Payload
+    {
+        /// <summary>
+        /// Gets or sets the value that mimic EndValve0.
+        /// </summary>
+        [Description("The value that mimic EndValve0.")]
+        public MimicOutputs MimicEndValve0 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicEndValve0 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
+        {
+            return MimicEndValve0;
+        }
+
+        /// <summary>
+        /// Creates a message that mimic EndValve0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicEndValve0 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicEndValve0.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic EndValve0.
+    /// </summary>
+    [DisplayName("TimestampedMimicEndValve0Payload")]
+    [Description("Creates a timestamped message payload that mimic EndValve0.")]
+    public partial class CreateTimestampedMimicEndValve0Payload : CreateMimicEndValve0Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic EndValve0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicEndValve0 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicEndValve0.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that mimic EndValve1.
+    /// </summary>
+    [DisplayName("MimicEndValve1Payload")]
+    [Description("Creates a message payload that mimic EndValve1.")]
+    public partial class CreateMimicEndValve1Payload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that mimic EndValve1.
         /// </summary>
-        public CreateMessage()
+        [Description("The value that mimic EndValve1.")]
+        public MimicOutputs MimicEndValve1 { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the MimicEndValve1 register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MimicOutputs GetPayload()
         {
-            Payload = new CreateEnableFlowPayload();
+            return MimicEndValve1;
         }
 
-        string INamedElement.Name => $"{nameof(Olfactometer)}.{GetElementDisplayName(Payload)}";
+        /// <summary>
+        /// Creates a message that mimic EndValve1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the MimicEndValve1 register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicEndValve1.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that mimic EndValve1.
+    /// </summary>
+    [DisplayName("TimestampedMimicEndValve1Payload")]
+    [Description("Creates a timestamped message payload that mimic EndValve1.")]
+    public partial class CreateTimestampedMimicEndValve1Payload : CreateMimicEndValve1Payload
+    {
+        /// <summary>
+        /// Creates a timestamped message that mimic EndValve1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the MimicEndValve1 register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.MimicEndValve1.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that starts or stops the flow in all channels.
+    /// that enable the valves control via low-level IO screw terminals.
     /// </summary>
-    [DisplayName("EnableFlowPayload")]
-    [Description("Creates a message payload that starts or stops the flow in all channels.")]
-    public partial class CreateEnableFlowPayload
+    [DisplayName("EnableValveExternalControlPayload")]
+    [Description("Creates a message payload that enable the valves control via low-level IO screw terminals.")]
+    public partial class CreateEnableValveExternalControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that starts or stops the flow in all channels.
+        /// Gets or sets the value that enable the valves control via low-level IO screw terminals.
         /// </summary>
-        [Description("The value that starts or stops the flow in all channels.")]
-        public EnableFlag EnableFlow { get; set; }
+        [Description("The value that enable the valves control via low-level IO screw terminals.")]
+        public EnableFlag EnableValveExternalControl { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableFlow register.
+        /// Creates a message payload for the EnableValveExternalControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public EnableFlag GetPayload()
         {
-            return EnableFlow;
+            return EnableValveExternalControl;
         }
 
         /// <summary>
-        /// Creates a message that starts or stops the flow in all channels.
+        /// Creates a message that enable the valves control via low-level IO screw terminals.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableFlow register.</returns>
+        /// <returns>A new message for the EnableValveExternalControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.EnableFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.EnableValveExternalControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that starts or stops the flow in all channels.
+    /// that enable the valves control via low-level IO screw terminals.
     /// </summary>
-    [DisplayName("TimestampedEnableFlowPayload")]
-    [Description("Creates a timestamped message payload that starts or stops the flow in all channels.")]
-    public partial class CreateTimestampedEnableFlowPayload : CreateEnableFlowPayload
+    [DisplayName("TimestampedEnableValveExternalControlPayload")]
+    [Description("Creates a timestamped message payload that enable the valves control via low-level IO screw terminals.")]
+    public partial class CreateTimestampedEnableValveExternalControlPayload : CreateEnableValveExternalControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that starts or stops the flow in all channels.
+        /// Creates a timestamped message that enable the valves control via low-level IO screw terminals.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableFlow register.</returns>
+        /// <returns>A new timestamped message for the EnableValveExternalControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.EnableFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.EnableValveExternalControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that value of single ADC read from all flowmeter channels.
+    /// that selects the flow range for the channel 3.
     /// </summary>
-    [DisplayName("FlowmeterPayload")]
-    [Description("Creates a message payload that value of single ADC read from all flowmeter channels.")]
-    public partial class CreateFlowmeterPayload
+    [DisplayName("Channel3RangePayload")]
+    [Description("Creates a message payload that selects the flow range for the channel 3.")]
+    public partial class CreateChannel3RangePayload
     {
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel0.
+        /// Gets or sets the value that selects the flow range for the channel 3.
         /// </summary>
-        [Description("")]
-        public short Channel0 { get; set; }
+        [Description("The value that selects the flow range for the channel 3.")]
+        public Channel3RangeConfig Channel3Range { get; set; }
 
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel1.
+        /// Creates a message payload for the Channel3Range register.
         /// </summary>
-        [Description("")]
-        public short Channel1 { get; set; }
+        /// <returns>The created message payload value.</returns>
+        public Channel3RangeConfig GetPayload()
+        {
+            return Channel3Range;
+        }
 
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel2.
+        /// Creates a message that selects the flow range for the channel 3.
         /// </summary>
-        [Description("")]
-        public short Channel2 { get; set; }
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Channel3Range register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3Range.FromPayload(messageType, GetPayload());
+        }
+    }
 
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that selects the flow range for the channel 3.
+    /// </summary>
+    [DisplayName("TimestampedChannel3RangePayload")]
+    [Description("Creates a timestamped message payload that selects the flow range for the channel 3.")]
+    public partial class CreateTimestampedChannel3RangePayload : CreateChannel3RangePayload
+    {
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel3.
+        /// Creates a timestamped message that selects the flow range for the channel 3.
         /// </summary>
-        [Description("")]
-        public short Channel3 { get; set; }
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Channel3Range register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.Channel3Range.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enable the check valve to sync with the respective odor valve.
+    /// </summary>
+    [DisplayName("EnableCheckValveSyncPayload")]
+    [Description("Creates a message payload that enable the check valve to sync with the respective odor valve.")]
+    public partial class CreateEnableCheckValveSyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enable the check valve to sync with the respective odor valve.
+        /// </summary>
+        [Description("The value that enable the check valve to sync with the respective odor valve.")]
+        public CheckValves EnableCheckValveSync { get; set; }
 
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel4.
+        /// Creates a message payload for the EnableCheckValveSync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public CheckValves GetPayload()
+        {
+            return EnableCheckValveSync;
+        }
+
+        /// <summary>
+        /// Creates a message that enable the check valve to sync with the respective odor valve.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableCheckValveSync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableCheckValveSync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enable the check valve to sync with the respective odor valve.
+    /// </summary>
+    [DisplayName("TimestampedEnableCheckValveSyncPayload")]
+    [Description("Creates a timestamped message payload that enable the check valve to sync with the respective odor valve.")]
+    public partial class CreateTimestampedEnableCheckValveSyncPayload : CreateEnableCheckValveSyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enable the check valve to sync with the respective odor valve.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableCheckValveSync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.EnableCheckValveSync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that temperature sensor reading value.
+    /// </summary>
+    [DisplayName("TemperatureValuePayload")]
+    [Description("Creates a message payload that temperature sensor reading value.")]
+    public partial class CreateTemperatureValuePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that temperature sensor reading value.
+        /// </summary>
+        [Description("The value that temperature sensor reading value.")]
+        public byte TemperatureValue { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TemperatureValue register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return TemperatureValue;
+        }
+
+        /// <summary>
+        /// Creates a message that temperature sensor reading value.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the TemperatureValue register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.Olfactometer.TemperatureValue.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that temperature sensor reading value.
+    /// </summary>
+    [DisplayName("TimestampedTemperatureValuePayload")]
+    [Description("Creates a timestamped message payload that temperature sensor reading value.")]
+    public partial class CreateTimestampedTemperatureValuePayload : CreateTemperatureValuePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that temperature sensor reading value.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the TemperatureValue register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.Olfactometer.TemperatureValue.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enable flow adjustment based on the temperature calibration.
+    /// </summary>
+    [DisplayName("EnableTemperatureCalibrationPayload")]
+    [Description("Creates a message payload that enable flow adjustment based on the temperature calibration.")]
+    public partial class CreateEnableTemperatureCalibrationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enable flow adjustment based on the temperature calibration.
         /// </summary>
-        [Description("")]
-        public short Channel4 { get; set; }
+        [Description("The value that enable flow adjustment based on the temperature calibration.")]
+        public EnableFlag EnableTemperatureCalibration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Flowmeter register.
+        /// Creates a message payload for the EnableTemperatureCalibration register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public FlowmeterPayload GetPayload()
+        public EnableFlag GetPayload()
         {
-            FlowmeterPayload value;
-            value.Channel0 = Channel0;
-            value.Channel1 = Channel1;
-            value.Channel2 = Channel2;
-            value.Channel3 = Channel3;
-            value.Channel4 = Channel4;
-            return value;
+            return EnableTemperatureCalibration;
         }
 
         /// <summary>
-        /// Creates a message that value of single ADC read from all flowmeter channels.
+        /// Creates a message that enable flow adjustment based on the temperature calibration.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Flowmeter register.</returns>
+        /// <returns>A new message for the EnableTemperatureCalibration register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Flowmeter.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.EnableTemperatureCalibration.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that value of single ADC read from all flowmeter channels.
+    /// that enable flow adjustment based on the temperature calibration.
     /// </summary>
-    [DisplayName("TimestampedFlowmeterPayload")]
-    [Description("Creates a timestamped message payload that value of single ADC read from all flowmeter channels.")]
-    public partial class CreateTimestampedFlowmeterPayload : CreateFlowmeterPayload
+    [DisplayName("TimestampedEnableTemperatureCalibrationPayload")]
+    [Description("Creates a timestamped message payload that enable flow adjustment based on the temperature calibration.")]
+    public partial class CreateTimestampedEnableTemperatureCalibrationPayload : CreateEnableTemperatureCalibrationPayload
     {
         /// <summary>
-        /// Creates a timestamped message that value of single ADC read from all flowmeter channels.
+        /// Creates a timestamped message that enable flow adjustment based on the temperature calibration.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Flowmeter register.</returns>
+        /// <returns>A new timestamped message for the EnableTemperatureCalibration register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Flowmeter.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.EnableTemperatureCalibration.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that state of the digital input pin 0.
+    /// that temperature value measured during the device calibration.
     /// </summary>
-    [DisplayName("DI0StatePayload")]
-    [Description("Creates a message payload that state of the digital input pin 0.")]
-    public partial class CreateDI0StatePayload
+    [DisplayName("TemperatureCalibrationValuePayload")]
+    [Description("Creates a message payload that temperature value measured during the device calibration.")]
+    public partial class CreateTemperatureCalibrationValuePayload
     {
         /// <summary>
-        /// Gets or sets the value that state of the digital input pin 0.
+        /// Gets or sets the value that temperature value measured during the device calibration.
         /// </summary>
-        [Description("The value that state of the digital input pin 0.")]
-        public DigitalState DI0State { get; set; }
+        [Description("The value that temperature value measured during the device calibration.")]
+        public byte TemperatureCalibrationValue { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DI0State register.
+        /// Creates a message payload for the TemperatureCalibrationValue register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalState GetPayload()
+        public byte GetPayload()
         {
-            return DI0State;
+            return TemperatureCalibrationValue;
         }
 
         /// <summary>
-        /// Creates a message that state of the digital input pin 0.
+        /// Creates a message that temperature value measured during the device calibration.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0State register.</returns>
+        /// <returns>A new message for the TemperatureCalibrationValue register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DI0State.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.TemperatureCalibrationValue.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that state of the digital input pin 0.
+    /// that temperature value measured during the device calibration.
     /// </summary>
-    [DisplayName("TimestampedDI0StatePayload")]
-    [Description("Creates a timestamped message payload that state of the digital input pin 0.")]
-    public partial class CreateTimestampedDI0StatePayload : CreateDI0StatePayload
+    [DisplayName("TimestampedTemperatureCalibrationValuePayload")]
+    [Description("Creates a timestamped message payload that temperature value measured during the device calibration.")]
+    public partial class CreateTimestampedTemperatureCalibrationValuePayload : CreateTemperatureCalibrationValuePayload
     {
         /// <summary>
-        /// Creates a timestamped message that state of the digital input pin 0.
+        /// Creates a timestamped message that temperature value measured during the device calibration.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0State register.</returns>
+        /// <returns>A new timestamped message for the TemperatureCalibrationValue register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DI0State.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.TemperatureCalibrationValue.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that specifies the active events in the device.
     /// </summary>
-    [DisplayName("Channel0UserCalibrationPayload")]
-    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateChannel0UserCalibrationPayload
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that specifies the active events in the device.")]
+    public partial class CreateEnableEventsPayload
     {
         /// <summary>
-        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Gets or sets the value that specifies the active events in the device.
         /// </summary>
-        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-        public ushort[] Channel0UserCalibration { get; set; }
+        [Description("The value that specifies the active events in the device.")]
+        public OlfactometerEvents EnableEvents { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel0UserCalibration register.
+        /// Creates a message payload for the EnableEvents register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort[] GetPayload()
+        public OlfactometerEvents GetPayload()
         {
-            return Channel0UserCalibration;
+            return EnableEvents;
         }
 
         /// <summary>
-        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a message that specifies the active events in the device.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel0UserCalibration register.</returns>
+        /// <returns>A new message for the EnableEvents register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0UserCalibration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.EnableEvents.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that specifies the active events in the device.
     /// </summary>
-    [DisplayName("TimestampedChannel0UserCalibrationPayload")]
-    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateTimestampedChannel0UserCalibrationPayload : CreateChannel0UserCalibrationPayload
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a timestamped message that specifies the active events in the device.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel0UserCalibration register.</returns>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that reports each valve transition, timestamped at the port write.
     /// </summary>
-    [DisplayName("Channel1UserCalibrationPayload")]
-    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateChannel1UserCalibrationPayload
+    [DisplayName("ValvesEventPayload")]
+    [Description("Creates a message payload that reports each valve transition, timestamped at the port write.")]
+    public partial class CreateValvesEventPayload
     {
         /// <summary>
-        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Gets or sets a value to write on payload member Changed.
         /// </summary>
-        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-        public ushort[] Channel1UserCalibration { get; set; }
+        [Description("The valves that changed state.")]
+        public Valves Changed { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel1UserCalibration register.
+        /// Gets or sets a value to write on payload member State.
+        /// </summary>
+        [Description("The state of all valves after the transition.")]
+        public Valves State { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ValvesEvent register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort[] GetPayload()
+        public ValvesEventPayload GetPayload()
         {
-            return Channel1UserCalibration;
+            ValvesEventPayload value;
+            value.Changed = Changed;
+            value.State = State;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a message that reports each valve transition, timestamped at the port write.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel1UserCalibration register.</returns>
+        /// <returns>A new message for the ValvesEvent register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1UserCalibration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ValvesEvent.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that reports each valve transition, timestamped at the port write.
     /// </summary>
-    [DisplayName("TimestampedChannel1UserCalibrationPayload")]
-    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateTimestampedChannel1UserCalibrationPayload : CreateChannel1UserCalibrationPayload
+    [DisplayName("TimestampedValvesEventPayload")]
+    [Description("Creates a timestamped message payload that reports each valve transition, timestamped at the port write.")]
+    public partial class CreateTimestampedValvesEventPayload : CreateValvesEventPayload
     {
         /// <summary>
-        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a timestamped message that reports each valve transition, timestamped at the port write.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel1UserCalibration register.</returns>
+        /// <returns>A new timestamped message for the ValvesEvent register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ValvesEvent.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that sets the pulse train of Valve0.
     /// </summary>
-    [DisplayName("Channel2UserCalibrationPayload")]
-    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateChannel2UserCalibrationPayload
+    [DisplayName("Valve0TrainPayload")]
+    [Description("Creates a message payload that sets the pulse train of Valve0.")]
+    public partial class CreateValve0TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Gets or sets a value to write on payload member Delay.
         /// </summary>
-        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-        public ushort[] Channel2UserCalibration { get; set; }
+        [Description("Delay before the first pulse, in ms.")]
+        public ushort Delay { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel2UserCalibration register.
+        /// Gets or sets a value to write on payload member OnTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is open on each pulse, in ms.")]
+        public ushort OnTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OffTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is closed between pulses, in ms.")]
+        public ushort OffTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Count.
+        /// </summary>
+        [Description("Number of pulses. Zero repeats until the train is stopped.")]
+        public ushort Count { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Valve0Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort[] GetPayload()
+        public Valve0TrainPayload GetPayload()
         {
-            return Channel2UserCalibration;
+            Valve0TrainPayload value;
+            value.Delay = Delay;
+            value.OnTime = OnTime;
+            value.OffTime = OffTime;
+            value.Count = Count;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a message that sets the pulse train of Valve0.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel2UserCalibration register.</returns>
+        /// <returns>A new message for the Valve0Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2UserCalibration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.Valve0Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that sets the pulse train of Valve0.
     /// </summary>
-    [DisplayName("TimestampedChannel2UserCalibrationPayload")]
-    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateTimestampedChannel2UserCalibrationPayload : CreateChannel2UserCalibrationPayload
+    [DisplayName("TimestampedValve0TrainPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse train of Valve0.")]
+    public partial class CreateTimestampedValve0TrainPayload : CreateValve0TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a timestamped message that sets the pulse train of Valve0.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel2UserCalibration register.</returns>
+        /// <returns>A new timestamped message for the Valve0Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.Valve0Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that sets the pulse train of Valve1.
     /// </summary>
-    [DisplayName("Channel3UserCalibrationPayload")]
-    [Description("Creates a message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateChannel3UserCalibrationPayload
+    [DisplayName("Valve1TrainPayload")]
+    [Description("Creates a message payload that sets the pulse train of Valve1.")]
+    public partial class CreateValve1TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Gets or sets a value to write on payload member Delay.
         /// </summary>
-        [Description("The value that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-        public ushort[] Channel3UserCalibration { get; set; }
+        [Description("Delay before the first pulse, in ms.")]
+        public ushort Delay { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel3UserCalibration register.
+        /// Gets or sets a value to write on payload member OnTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is open on each pulse, in ms.")]
+        public ushort OnTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OffTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is closed between pulses, in ms.")]
+        public ushort OffTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Count.
+        /// </summary>
+        [Description("Number of pulses. Zero repeats until the train is stopped.")]
+        public ushort Count { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Valve1Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort[] GetPayload()
+        public Valve1TrainPayload GetPayload()
         {
-            return Channel3UserCalibration;
+            Valve1TrainPayload value;
+            value.Delay = Delay;
+            value.OnTime = OnTime;
+            value.OffTime = OffTime;
+            value.Count = Count;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a message that sets the pulse train of Valve1.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel3UserCalibration register.</returns>
+        /// <returns>A new message for the Valve1Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3UserCalibration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.Valve1Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+    /// that sets the pulse train of Valve1.
     /// </summary>
-    [DisplayName("TimestampedChannel3UserCalibrationPayload")]
-    [Description("Creates a timestamped message payload that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.")]
-    public partial class CreateTimestampedChannel3UserCalibrationPayload : CreateChannel3UserCalibrationPayload
+    [DisplayName("TimestampedValve1TrainPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse train of Valve1.")]
+    public partial class CreateTimestampedValve1TrainPayload : CreateValve1TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that calibration values for a single channel [x0,...xn], where x= ADC raw value for 0:10:100 ml/min.
+        /// Creates a timestamped message that sets the pulse train of Valve1.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel3UserCalibration register.</returns>
+        /// <returns>A new timestamped message for the Valve1Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.Valve1Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// that sets the pulse train of Valve2.
     /// </summary>
-    [DisplayName("Channel4UserCalibrationPayload")]
-    [Description("Creates a message payload that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
-    public partial class CreateChannel4UserCalibrationPayload
+    [DisplayName("Valve2TrainPayload")]
+    [Description("Creates a message payload that sets the pulse train of Valve2.")]
+    public partial class CreateValve2TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// Gets or sets a value to write on payload member Delay.
         /// </summary>
-        [Description("The value that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
-        public ushort[] Channel4UserCalibration { get; set; }
+        [Description("Delay before the first pulse, in ms.")]
+        public ushort Delay { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel4UserCalibration register.
+        /// Gets or sets a value to write on payload member OnTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is open on each pulse, in ms.")]
+        public ushort OnTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OffTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is closed between pulses, in ms.")]
+        public ushort OffTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Count.
+        /// </summary>
+        [Description("Number of pulses. Zero repeats until the train is stopped.")]
+        public ushort Count { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Valve2Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort[] GetPayload()
+        public Valve2TrainPayload GetPayload()
         {
-            return Channel4UserCalibration;
+            Valve2TrainPayload value;
+            value.Delay = Delay;
+            value.OnTime = OnTime;
+            value.OffTime = OffTime;
+            value.Count = Count;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// Creates a message that sets the pulse train of Valve2.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel4UserCalibration register.</returns>
+        /// <returns>A new message for the Valve2Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4UserCalibration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.Valve2Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// that sets the pulse train of Valve2.
     /// </summary>
-    [DisplayName("TimestampedChannel4UserCalibrationPayload")]
-    [Description("Creates a timestamped message payload that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
-    public partial class CreateTimestampedChannel4UserCalibrationPayload : CreateChannel4UserCalibrationPayload
+    [DisplayName("TimestampedValve2TrainPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse train of Valve2.")]
+    public partial class CreateTimestampedValve2TrainPayload : CreateValve2TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that calibration values specific for channel 4 [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// Creates a timestamped message that sets the pulse train of Valve2.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel4UserCalibration register.</returns>
+        /// <returns>A new timestamped message for the Valve2Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4UserCalibration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.Valve2Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// that sets the pulse train of Valve3.
     /// </summary>
-    [DisplayName("Channel3UserCalibrationAuxPayload")]
-    [Description("Creates a message payload that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
-    public partial class CreateChannel3UserCalibrationAuxPayload
+    [DisplayName("Valve3TrainPayload")]
+    [Description("Creates a message payload that sets the pulse train of Valve3.")]
+    public partial class CreateValve3TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// Gets or sets a value to write on payload member Delay.
         /// </summary>
-        [Description("The value that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
-        public ushort[] Channel3UserCalibrationAux { get; set; }
+        [Description("Delay before the first pulse, in ms.")]
+        public ushort Delay { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel3UserCalibrationAux register.
+        /// Gets or sets a value to write on payload member OnTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is open on each pulse, in ms.")]
+        public ushort OnTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OffTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is closed between pulses, in ms.")]
+        public ushort OffTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Count.
+        /// </summary>
+        [Description("Number of pulses. Zero repeats until the train is stopped.")]
+        public ushort Count { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Valve3Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort[] GetPayload()
+        public Valve3TrainPayload GetPayload()
         {
-            return Channel3UserCalibrationAux;
+            Valve3TrainPayload value;
+            value.Delay = Delay;
+            value.OnTime = OnTime;
+            value.OffTime = OffTime;
+            value.Count = Count;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// Creates a message that sets the pulse train of Valve3.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel3UserCalibrationAux register.</returns>
+        /// <returns>A new message for the Valve3Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3UserCalibrationAux.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.Valve3Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+    /// that sets the pulse train of Valve3.
     /// </summary>
-    [DisplayName("TimestampedChannel3UserCalibrationAuxPayload")]
-    [Description("Creates a timestamped message payload that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.")]
-    public partial class CreateTimestampedChannel3UserCalibrationAuxPayload : CreateChannel3UserCalibrationAuxPayload
+    [DisplayName("TimestampedValve3TrainPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse train of Valve3.")]
+    public partial class CreateTimestampedValve3TrainPayload : CreateValve3TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that calibration values specific for channel 3 if Channel3RangeConfig = FlowRate1000. [x0,...xn], where x= ADC raw value for 0:100:1000 ml/min.
+        /// Creates a timestamped message that sets the pulse train of Valve3.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel3UserCalibrationAux register.</returns>
+        /// <returns>A new timestamped message for the Valve3Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3UserCalibrationAux.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.Valve3Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+    /// that sets the pulse train of EndValve0.
     /// </summary>
-    [DisplayName("EnableUserCalibrationPayload")]
-    [Description("Creates a message payload that override the factory calibration values, replacing with CHX_USER_CALIBRATION.")]
-    public partial class CreateEnableUserCalibrationPayload
+    [DisplayName("EndValve0TrainPayload")]
+    [Description("Creates a message payload that sets the pulse train of EndValve0.")]
+    public partial class CreateEndValve0TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+        /// Gets or sets a value to write on payload member Delay.
+        /// </summary>
+        [Description("Delay before the first pulse, in ms.")]
+        public ushort Delay { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OnTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is open on each pulse, in ms.")]
+        public ushort OnTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OffTime.
         /// </summary>
-        [Description("The value that override the factory calibration values, replacing with CHX_USER_CALIBRATION.")]
-        public EnableFlag EnableUserCalibration { get; set; }
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is closed between pulses, in ms.")]
+        public ushort OffTime { get; set; } = 1;
 
         /// <summary>
-        /// Creates a message payload for the EnableUserCalibration register.
+        /// Gets or sets a value to write on payload member Count.
+        /// </summary>
+        [Description("Number of pulses. Zero repeats until the train is stopped.")]
+        public ushort Count { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EndValve0Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
+        public EndValve0TrainPayload GetPayload()
         {
-            return EnableUserCalibration;
+            EndValve0TrainPayload value;
+            value.Delay = Delay;
+            value.OnTime = OnTime;
+            value.OffTime = OffTime;
+            value.Count = Count;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+        /// Creates a message that sets the pulse train of EndValve0.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableUserCalibration register.</returns>
+        /// <returns>A new message for the EndValve0Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.EnableUserCalibration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.EndValve0Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+    /// that sets the pulse train of EndValve0.
     /// </summary>
-    [DisplayName("TimestampedEnableUserCalibrationPayload")]
-    [Description("Creates a timestamped message payload that override the factory calibration values, replacing with CHX_USER_CALIBRATION.")]
-    public partial class CreateTimestampedEnableUserCalibrationPayload : CreateEnableUserCalibrationPayload
+    [DisplayName("TimestampedEndValve0TrainPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse train of EndValve0.")]
+    public partial class CreateTimestampedEndValve0TrainPayload : CreateEndValve0TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that override the factory calibration values, replacing with CHX_USER_CALIBRATION.
+        /// Creates a timestamped message that sets the pulse train of EndValve0.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableUserCalibration register.</returns>
+        /// <returns>A new timestamped message for the EndValve0Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.EnableUserCalibration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.EndValve0Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the flow-rate rate for channel 0 [ml/min].
+    /// that sets the pulse train of EndValve1.
     /// </summary>
-    [DisplayName("Channel0TargetFlowPayload")]
-    [Description("Creates a message payload that sets the flow-rate rate for channel 0 [ml/min].")]
-    public partial class CreateChannel0TargetFlowPayload
+    [DisplayName("EndValve1TrainPayload")]
+    [Description("Creates a message payload that sets the pulse train of EndValve1.")]
+    public partial class CreateEndValve1TrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the flow-rate rate for channel 0 [ml/min].
+        /// Gets or sets a value to write on payload member Delay.
         /// </summary>
-        [Range(min: 0, max: 100)]
+        [Description("Delay before the first pulse, in ms.")]
+        public ushort Delay { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member OnTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
         [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the flow-rate rate for channel 0 [ml/min].")]
-        public float Channel0TargetFlow { get; set; } = 0F;
+        [Description("Time the valve is open on each pulse, in ms.")]
+        public ushort OnTime { get; set; } = 1;
 
         /// <summary>
-        /// Creates a message payload for the Channel0TargetFlow register.
+        /// Gets or sets a value to write on payload member OffTime.
+        /// </summary>
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("Time the valve is closed between pulses, in ms.")]
+        public ushort OffTime { get; set; } = 1;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Count.
+        /// </summary>
+        [Description("Number of pulses. Zero repeats until the train is stopped.")]
+        public ushort Count { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EndValve1Train register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public EndValve1TrainPayload GetPayload()
         {
-            return Channel0TargetFlow;
+            EndValve1TrainPayload value;
+            value.Delay = Delay;
+            value.OnTime = OnTime;
+            value.OffTime = OffTime;
+            value.Count = Count;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that sets the flow-rate rate for channel 0 [ml/min].
+        /// Creates a message that sets the pulse train of EndValve1.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel0TargetFlow register.</returns>
+        /// <returns>A new message for the EndValve1Train register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0TargetFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.EndValve1Train.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the flow-rate rate for channel 0 [ml/min].
+    /// that sets the pulse train of EndValve1.
     /// </summary>
-    [DisplayName("TimestampedChannel0TargetFlowPayload")]
-    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 0 [ml/min].")]
-    public partial class CreateTimestampedChannel0TargetFlowPayload : CreateChannel0TargetFlowPayload
+    [DisplayName("TimestampedEndValve1TrainPayload")]
+    [Description("Creates a timestamped message payload that sets the pulse train of EndValve1.")]
+    public partial class CreateTimestampedEndValve1TrainPayload : CreateEndValve1TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the flow-rate rate for channel 0 [ml/min].
+        /// Creates a timestamped message that sets the pulse train of EndValve1.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel0TargetFlow register.</returns>
+        /// <returns>A new timestamped message for the EndValve1Train register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.EndValve1Train.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the flow-rate rate for channel 1 [ml/min].
+    /// that starts the pulse train of the specified odor, end and dummy valves.
     /// </summary>
-    [DisplayName("Channel1TargetFlowPayload")]
-    [Description("Creates a message payload that sets the flow-rate rate for channel 1 [ml/min].")]
-    public partial class CreateChannel1TargetFlowPayload
+    [DisplayName("StartValvesTrainPayload")]
+    [Description("Creates a message payload that starts the pulse train of the specified odor, end and dummy valves.")]
+    public partial class CreateStartValvesTrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the flow-rate rate for channel 1 [ml/min].
+        /// Gets or sets the value that starts the pulse train of the specified odor, end and dummy valves.
         /// </summary>
-        [Range(min: 0, max: 100)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the flow-rate rate for channel 1 [ml/min].")]
-        public float Channel1TargetFlow { get; set; } = 0F;
+        [Description("The value that starts the pulse train of the specified odor, end and dummy valves.")]
+        public Valves StartValvesTrain { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel1TargetFlow register.
+        /// Creates a message payload for the StartValvesTrain register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public Valves GetPayload()
         {
-            return Channel1TargetFlow;
+            return StartValvesTrain;
         }
 
         /// <summary>
-        /// Creates a message that sets the flow-rate rate for channel 1 [ml/min].
+        /// Creates a message that starts the pulse train of the specified odor, end and dummy valves.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel1TargetFlow register.</returns>
+        /// <returns>A new message for the StartValvesTrain register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1TargetFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.StartValvesTrain.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the flow-rate rate for channel 1 [ml/min].
+    /// that starts the pulse train of the specified odor, end and dummy valves.
     /// </summary>
-    [DisplayName("TimestampedChannel1TargetFlowPayload")]
-    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 1 [ml/min].")]
-    public partial class CreateTimestampedChannel1TargetFlowPayload : CreateChannel1TargetFlowPayload
+    [DisplayName("TimestampedStartValvesTrainPayload")]
+    [Description("Creates a timestamped message payload that starts the pulse train of the specified odor, end and dummy valves.")]
+    public partial class CreateTimestampedStartValvesTrainPayload : CreateStartValvesTrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the flow-rate rate for channel 1 [ml/min].
+        /// Creates a timestamped message that starts the pulse train of the specified odor, end and dummy valves.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel1TargetFlow register.</returns>
+        /// <returns>A new timestamped message for the StartValvesTrain register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.StartValvesTrain.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the flow-rate rate for channel 2 [ml/min].
+    /// that stops the pulse train of the specified valves and closes them.
     /// </summary>
-    [DisplayName("Channel2TargetFlowPayload")]
-    [Description("Creates a message payload that sets the flow-rate rate for channel 2 [ml/min].")]
-    public partial class CreateChannel2TargetFlowPayload
+    [DisplayName("StopValvesTrainPayload")]
+    [Description("Creates a message payload that stops the pulse train of the specified valves and closes them.")]
+    public partial class CreateStopValvesTrainPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the flow-rate rate for channel 2 [ml/min].
+        /// Gets or sets the value that stops the pulse train of the specified valves and closes them.
         /// </summary>
-        [Range(min: 0, max: 100)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the flow-rate rate for channel 2 [ml/min].")]
-        public float Channel2TargetFlow { get; set; } = 0F;
+        [Description("The value that stops the pulse train of the specified valves and closes them.")]
+        public Valves StopValvesTrain { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel2TargetFlow register.
+        /// Creates a message payload for the StopValvesTrain register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public Valves GetPayload()
         {
-            return Channel2TargetFlow;
+            return StopValvesTrain;
         }
 
         /// <summary>
-        /// Creates a message that sets the flow-rate rate for channel 2 [ml/min].
+        /// Creates a message that stops the pulse train of the specified valves and closes them.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel2TargetFlow register.</returns>
+        /// <returns>A new message for the StopValvesTrain register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2TargetFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.StopValvesTrain.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the flow-rate rate for channel 2 [ml/min].
+    /// that stops the pulse train of the specified valves and closes them.
     /// </summary>
-    [DisplayName("TimestampedChannel2TargetFlowPayload")]
-    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 2 [ml/min].")]
-    public partial class CreateTimestampedChannel2TargetFlowPayload : CreateChannel2TargetFlowPayload
+    [DisplayName("TimestampedStopValvesTrainPayload")]
+    [Description("Creates a timestamped message payload that stops the pulse train of the specified valves and closes them.")]
+    public partial class CreateTimestampedStopValvesTrainPayload : CreateStopValvesTrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the flow-rate rate for channel 2 [ml/min].
+        /// Creates a timestamped message that stops the pulse train of the specified valves and closes them.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel2TargetFlow register.</returns>
+        /// <returns>A new timestamped message for the StopValvesTrain register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.StopValvesTrain.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the flow-rate rate for channel 3 [ml/min].
+    /// that reports the valves whose pulse train has completed.
     /// </summary>
-    [DisplayName("Channel3TargetFlowPayload")]
-    [Description("Creates a message payload that sets the flow-rate rate for channel 3 [ml/min].")]
-    public partial class CreateChannel3TargetFlowPayload
+    [DisplayName("ValvesTrainDonePayload")]
+    [Description("Creates a message payload that reports the valves whose pulse train has completed.")]
+    public partial class CreateValvesTrainDonePayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the flow-rate rate for channel 3 [ml/min].
+        /// Gets or sets the value that reports the valves whose pulse train has completed.
         /// </summary>
-        [Range(min: 0, max: 1000)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the flow-rate rate for channel 3 [ml/min].")]
-        public float Channel3TargetFlow { get; set; } = 0F;
+        [Description("The value that reports the valves whose pulse train has completed.")]
+        public Valves ValvesTrainDone { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel3TargetFlow register.
+        /// Creates a message payload for the ValvesTrainDone register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public Valves GetPayload()
         {
-            return Channel3TargetFlow;
+            return ValvesTrainDone;
         }
 
         /// <summary>
-        /// Creates a message that sets the flow-rate rate for channel 3 [ml/min].
+        /// Creates a message that reports the valves whose pulse train has completed.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel3TargetFlow register.</returns>
+        /// <returns>A new message for the ValvesTrainDone register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3TargetFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ValvesTrainDone.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the flow-rate rate for channel 3 [ml/min].
+    /// that reports the valves whose pulse train has completed.
     /// </summary>
-    [DisplayName("TimestampedChannel3TargetFlowPayload")]
-    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 3 [ml/min].")]
-    public partial class CreateTimestampedChannel3TargetFlowPayload : CreateChannel3TargetFlowPayload
+    [DisplayName("TimestampedValvesTrainDonePayload")]
+    [Description("Creates a timestamped message payload that reports the valves whose pulse train has completed.")]
+    public partial class CreateTimestampedValvesTrainDonePayload : CreateValvesTrainDonePayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the flow-rate rate for channel 3 [ml/min].
+        /// Creates a timestamped message that reports the valves whose pulse train has completed.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel3TargetFlow register.</returns>
+        /// <returns>A new timestamped message for the ValvesTrainDone register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ValvesTrainDone.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the flow-rate rate for channel 4 [ml/min].
+    /// that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.
     /// </summary>
-    [DisplayName("Channel4TargetFlowPayload")]
-    [Description("Creates a message payload that sets the flow-rate rate for channel 4 [ml/min].")]
-    public partial class CreateChannel4TargetFlowPayload
+    [DisplayName("SequenceControlPayload")]
+    [Description("Creates a message payload that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.")]
+    public partial class CreateSequenceControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the flow-rate rate for channel 4 [ml/min].
+        /// Gets or sets the value that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.
         /// </summary>
-        [Range(min: 0, max: 1000)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the flow-rate rate for channel 4 [ml/min].")]
-        public float Channel4TargetFlow { get; set; } = 0F;
+        [Description("The value that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.")]
+        public SequenceState SequenceControl { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel4TargetFlow register.
+        /// Creates a message payload for the SequenceControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public SequenceState GetPayload()
         {
-            return Channel4TargetFlow;
+            return SequenceControl;
         }
 
         /// <summary>
-        /// Creates a message that sets the flow-rate rate for channel 4 [ml/min].
+        /// Creates a message that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel4TargetFlow register.</returns>
+        /// <returns>A new message for the SequenceControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4TargetFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.SequenceControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the flow-rate rate for channel 4 [ml/min].
+    /// that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.
     /// </summary>
-    [DisplayName("TimestampedChannel4TargetFlowPayload")]
-    [Description("Creates a timestamped message payload that sets the flow-rate rate for channel 4 [ml/min].")]
-    public partial class CreateTimestampedChannel4TargetFlowPayload : CreateChannel4TargetFlowPayload
+    [DisplayName("TimestampedSequenceControlPayload")]
+    [Description("Creates a timestamped message payload that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.")]
+    public partial class CreateTimestampedSequenceControlPayload : CreateSequenceControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the flow-rate rate for channel 4 [ml/min].
+        /// Creates a timestamped message that stops, arms or starts the odor delivery sequence. Reports the sequence state when it starts and ends, or when a step is aborted because its channels did not settle.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel4TargetFlow register.</returns>
+        /// <returns>A new timestamped message for the SequenceControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4TargetFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.SequenceControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the flow-rate rate for all channels [ml/min].
+    /// that number of steps of the odor delivery sequence.
     /// </summary>
-    [DisplayName("ChannelsTargetFlowPayload")]
-    [Description("Creates a message payload that sets the flow-rate rate for all channels [ml/min].")]
-    public partial class CreateChannelsTargetFlowPayload
+    [DisplayName("SequenceLengthPayload")]
+    [Description("Creates a message payload that number of steps of the odor delivery sequence.")]
+    public partial class CreateSequenceLengthPayload
     {
         /// <summary>
-        /// Gets or sets a value to write on payload member Channel0.
-        /// </summary>
-        [Description("")]
-        public float Channel0 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel1.
-        /// </summary>
-        [Description("")]
-        public float Channel1 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel2.
-        /// </summary>
-        [Description("")]
-        public float Channel2 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel3.
-        /// </summary>
-        [Description("")]
-        public float Channel3 { get; set; }
-
-        /// <summary>
-        /// Gets or sets a value to write on payload member Channel4.
+        /// Gets or sets the value that number of steps of the odor delivery sequence.
         /// </summary>
-        [Description("")]
-        public float Channel4 { get; set; }
+        [Range(min: 0, max: 16)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that number of steps of the odor delivery sequence.")]
+        public byte SequenceLength { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the ChannelsTargetFlow register.
+        /// Creates a message payload for the SequenceLength register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ChannelsTargetFlowPayload GetPayload()
+        public byte GetPayload()
         {
-            ChannelsTargetFlowPayload value;
-            value.Channel0 = Channel0;
-            value.Channel1 = Channel1;
-            value.Channel2 = Channel2;
-            value.Channel3 = Channel3;
-            value.Channel4 = Channel4;
-            return value;
+            return SequenceLength;
         }
 
         /// <summary>
-        /// Creates a message that sets the flow-rate rate for all channels [ml/min].
+        /// Creates a message that number of steps of the odor delivery sequence.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ChannelsTargetFlow register.</returns>
+        /// <returns>A new message for the SequenceLength register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.ChannelsTargetFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.SequenceLength.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the flow-rate rate for all channels [ml/min].
+    /// that number of steps of the odor delivery sequence.
     /// </summary>
-    [DisplayName("TimestampedChannelsTargetFlowPayload")]
-    [Description("Creates a timestamped message payload that sets the flow-rate rate for all channels [ml/min].")]
-    public partial class CreateTimestampedChannelsTargetFlowPayload : CreateChannelsTargetFlowPayload
+    [DisplayName("TimestampedSequenceLengthPayload")]
+    [Description("Creates a timestamped message payload that number of steps of the odor delivery sequence.")]
+    public partial class CreateTimestampedSequenceLengthPayload : CreateSequenceLengthPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the flow-rate rate for all channels [ml/min].
+        /// Creates a timestamped message that number of steps of the odor delivery sequence.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ChannelsTargetFlow register.</returns>
+        /// <returns>A new timestamped message for the SequenceLength register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.ChannelsTargetFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.SequenceLength.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+    /// that selects the step accessed through SequenceStep and SequenceStepFlows.
     /// </summary>
-    [DisplayName("Channel0ActualFlowPayload")]
-    [Description("Creates a message payload that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].")]
-    public partial class CreateChannel0ActualFlowPayload
+    [DisplayName("SequenceStepIndexPayload")]
+    [Description("Creates a message payload that selects the step accessed through SequenceStep and SequenceStepFlows.")]
+    public partial class CreateSequenceStepIndexPayload
     {
         /// <summary>
-        /// Gets or sets the value that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+        /// Gets or sets the value that selects the step accessed through SequenceStep and SequenceStepFlows.
         /// </summary>
-        [Description("The value that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].")]
-        public float Channel0ActualFlow { get; set; }
+        [Range(min: 0, max: 15)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that selects the step accessed through SequenceStep and SequenceStepFlows.")]
+        public byte SequenceStepIndex { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the Channel0ActualFlow register.
+        /// Creates a message payload for the SequenceStepIndex register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public byte GetPayload()
         {
-            return Channel0ActualFlow;
+            return SequenceStepIndex;
         }
 
         /// <summary>
-        /// Creates a message that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+        /// Creates a message that selects the step accessed through SequenceStep and SequenceStepFlows.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel0ActualFlow register.</returns>
+        /// <returns>A new message for the SequenceStepIndex register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0ActualFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.SequenceStepIndex.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+    /// that selects the step accessed through SequenceStep and SequenceStepFlows.
     /// </summary>
-    [DisplayName("TimestampedChannel0ActualFlowPayload")]
-    [Description("Creates a timestamped message payload that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].")]
-    public partial class CreateTimestampedChannel0ActualFlowPayload : CreateChannel0ActualFlowPayload
+    [DisplayName("TimestampedSequenceStepIndexPayload")]
+    [Description("Creates a timestamped message payload that selects the step accessed through SequenceStep and SequenceStepFlows.")]
+    public partial class CreateTimestampedSequenceStepIndexPayload : CreateSequenceStepIndexPayload
     {
         /// <summary>
-        /// Creates a timestamped message that actual flow-rate read for channel 0 - flowmeter 0 [ml/min].
+        /// Creates a timestamped message that selects the step accessed through SequenceStep and SequenceStepFlows.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel0ActualFlow register.</returns>
+        /// <returns>A new timestamped message for the SequenceStepIndex register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.SequenceStepIndex.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+    /// that time, valves, digital outputs and settle gate of the selected sequence step.
     /// </summary>
-    [DisplayName("Channel1ActualFlowPayload")]
-    [Description("Creates a message payload that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].")]
-    public partial class CreateChannel1ActualFlowPayload
+    [DisplayName("SequenceStepPayload")]
+    [Description("Creates a message payload that time, valves, digital outputs and settle gate of the selected sequence step.")]
+    public partial class CreateSequenceStepPayload
     {
         /// <summary>
-        /// Gets or sets the value that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+        /// Gets or sets a value to write on payload member Time.
         /// </summary>
-        [Description("The value that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].")]
-        public float Channel1ActualFlow { get; set; }
+        [Description("Time of the step from the sequence start, in ms. It cannot be earlier than the time of the previous step.")]
+        public ushort Time { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel1ActualFlow register.
+        /// Gets or sets a value to write on payload member Valves.
+        /// </summary>
+        [Description("State of the valves.")]
+        public Valves Valves { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member DigitalOutputs.
+        /// </summary>
+        [Description("State of the digital outputs.")]
+        public DigitalOutputs DigitalOutputs { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Settle.
+        /// </summary>
+        [Description("Channels that must be settled before the step is applied. The sequence cannot be armed or started while a step selects a channel it gives no flow.")]
+        public FlowChannels Settle { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SequenceStep register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public SequenceStepPayload GetPayload()
         {
-            return Channel1ActualFlow;
+            SequenceStepPayload value;
+            value.Time = Time;
+            value.Valves = Valves;
+            value.DigitalOutputs = DigitalOutputs;
+            value.Settle = Settle;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+        /// Creates a message that time, valves, digital outputs and settle gate of the selected sequence step.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel1ActualFlow register.</returns>
+        /// <returns>A new message for the SequenceStep register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1ActualFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.SequenceStep.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+    /// that time, valves, digital outputs and settle gate of the selected sequence step.
     /// </summary>
-    [DisplayName("TimestampedChannel1ActualFlowPayload")]
-    [Description("Creates a timestamped message payload that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].")]
-    public partial class CreateTimestampedChannel1ActualFlowPayload : CreateChannel1ActualFlowPayload
+    [DisplayName("TimestampedSequenceStepPayload")]
+    [Description("Creates a timestamped message payload that time, valves, digital outputs and settle gate of the selected sequence step.")]
+    public partial class CreateTimestampedSequenceStepPayload : CreateSequenceStepPayload
     {
         /// <summary>
-        /// Creates a timestamped message that actual flow-rate read for channel 1 - flowmeter 1 [ml/min].
+        /// Creates a timestamped message that time, valves, digital outputs and settle gate of the selected sequence step.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel1ActualFlow register.</returns>
+        /// <returns>A new timestamped message for the SequenceStep register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.SequenceStep.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
-    /// </summary>
-    [DisplayName("Channel2ActualFlowPayload")]
-    [Description("Creates a message payload that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].")]
-    public partial class CreateChannel2ActualFlowPayload
+    /// that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.
+    /// </summary>
+    [DisplayName("SequenceStepFlowsPayload")]
+    [Description("Creates a message payload that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.")]
+    public partial class CreateSequenceStepFlowsPayload
     {
         /// <summary>
-        /// Gets or sets the value that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+        /// Gets or sets the value that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.
         /// </summary>
-        [Description("The value that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].")]
-        public float Channel2ActualFlow { get; set; }
+        [Description("The value that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.")]
+        public float[] SequenceStepFlows { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel2ActualFlow register.
+        /// Creates a message payload for the SequenceStepFlows register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public float[] GetPayload()
         {
-            return Channel2ActualFlow;
+            return SequenceStepFlows;
         }
 
         /// <summary>
-        /// Creates a message that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+        /// Creates a message that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel2ActualFlow register.</returns>
+        /// <returns>A new message for the SequenceStepFlows register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2ActualFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.SequenceStepFlows.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+    /// that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.
     /// </summary>
-    [DisplayName("TimestampedChannel2ActualFlowPayload")]
-    [Description("Creates a timestamped message payload that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].")]
-    public partial class CreateTimestampedChannel2ActualFlowPayload : CreateChannel2ActualFlowPayload
+    [DisplayName("TimestampedSequenceStepFlowsPayload")]
+    [Description("Creates a timestamped message payload that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.")]
+    public partial class CreateTimestampedSequenceStepFlowsPayload : CreateSequenceStepFlowsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that actual flow-rate read for channel 2 - flowmeter 2 [ml/min].
+        /// Creates a timestamped message that target flow of each channel for the selected sequence step. A negative value keeps the current target, which is the default of every step.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel2ActualFlow register.</returns>
+        /// <returns>A new timestamped message for the SequenceStepFlows register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.SequenceStepFlows.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+    /// that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.
     /// </summary>
-    [DisplayName("Channel3ActualFlowPayload")]
-    [Description("Creates a message payload that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].")]
-    public partial class CreateChannel3ActualFlowPayload
+    [DisplayName("DI0DebouncePayload")]
+    [Description("Creates a message payload that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.")]
+    public partial class CreateDI0DebouncePayload
     {
         /// <summary>
-        /// Gets or sets the value that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+        /// Gets or sets the value that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.
         /// </summary>
-        [Description("The value that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].")]
-        public float Channel3ActualFlow { get; set; }
+        [Description("The value that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.")]
+        public ushort DI0Debounce { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel3ActualFlow register.
+        /// Creates a message payload for the DI0Debounce register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort GetPayload()
         {
-            return Channel3ActualFlow;
+            return DI0Debounce;
         }
 
         /// <summary>
-        /// Creates a message that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+        /// Creates a message that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel3ActualFlow register.</returns>
+        /// <returns>A new message for the DI0Debounce register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3ActualFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.DI0Debounce.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+    /// that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.
     /// </summary>
-    [DisplayName("TimestampedChannel3ActualFlowPayload")]
-    [Description("Creates a timestamped message payload that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].")]
-    public partial class CreateTimestampedChannel3ActualFlowPayload : CreateChannel3ActualFlowPayload
+    [DisplayName("TimestampedDI0DebouncePayload")]
+    [Description("Creates a timestamped message payload that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.")]
+    public partial class CreateTimestampedDI0DebouncePayload : CreateDI0DebouncePayload
     {
         /// <summary>
-        /// Creates a timestamped message that actual flow-rate read for channel 3 - flowmeter 3 [ml/min].
+        /// Creates a timestamped message that time in microseconds that DI0 must hold a new level before the edge is accepted. Zero disables the filter.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel3ActualFlow register.</returns>
+        /// <returns>A new timestamped message for the DI0Debounce register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.DI0Debounce.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+    /// that maximum flow error, in percentage of the target, for a channel to be considered settled.
     /// </summary>
-    [DisplayName("Channel4ActualFlowPayload")]
-    [Description("Creates a message payload that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].")]
-    public partial class CreateChannel4ActualFlowPayload
+    [DisplayName("FlowSettleTolerancePayload")]
+    [Description("Creates a message payload that maximum flow error, in percentage of the target, for a channel to be considered settled.")]
+    public partial class CreateFlowSettleTolerancePayload
     {
         /// <summary>
-        /// Gets or sets the value that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+        /// Gets or sets the value that maximum flow error, in percentage of the target, for a channel to be considered settled.
         /// </summary>
-        [Description("The value that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].")]
-        public float Channel4ActualFlow { get; set; }
+        [Range(min: 0.1, max: 100)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that maximum flow error, in percentage of the target, for a channel to be considered settled.")]
+        public float FlowSettleTolerance { get; set; } = 0.1F;
 
         /// <summary>
-        /// Creates a message payload for the Channel4ActualFlow register.
+        /// Creates a message payload for the FlowSettleTolerance register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public float GetPayload()
         {
-            return Channel4ActualFlow;
+            return FlowSettleTolerance;
         }
 
         /// <summary>
-        /// Creates a message that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+        /// Creates a message that maximum flow error, in percentage of the target, for a channel to be considered settled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel4ActualFlow register.</returns>
+        /// <returns>A new message for the FlowSettleTolerance register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4ActualFlow.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettleTolerance.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+    /// that maximum flow error, in percentage of the target, for a channel to be considered settled.
     /// </summary>
-    [DisplayName("TimestampedChannel4ActualFlowPayload")]
-    [Description("Creates a timestamped message payload that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].")]
-    public partial class CreateTimestampedChannel4ActualFlowPayload : CreateChannel4ActualFlowPayload
+    [DisplayName("TimestampedFlowSettleTolerancePayload")]
+    [Description("Creates a timestamped message payload that maximum flow error, in percentage of the target, for a channel to be considered settled.")]
+    public partial class CreateTimestampedFlowSettleTolerancePayload : CreateFlowSettleTolerancePayload
     {
         /// <summary>
-        /// Creates a timestamped message that actual flow-rate read for channel 4 - flowmeter 4 [ml/min].
+        /// Creates a timestamped message that maximum flow error, in percentage of the target, for a channel to be considered settled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel4ActualFlow register.</returns>
+        /// <returns>A new timestamped message for the FlowSettleTolerance register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4ActualFlow.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettleTolerance.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle for proportional valve 0 [%].
+    /// that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.
     /// </summary>
-    [DisplayName("Channel0DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle for proportional valve 0 [%].")]
-    public partial class CreateChannel0DutyCyclePayload
+    [DisplayName("FlowSettleDwellPayload")]
+    [Description("Creates a message payload that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.")]
+    public partial class CreateFlowSettleDwellPayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle for proportional valve 0 [%].
+        /// Gets or sets the value that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.
         /// </summary>
-        [Range(min: 0.2, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle for proportional valve 0 [%].")]
-        public float Channel0DutyCycle { get; set; } = 0.2F;
+        [Description("The value that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.")]
+        public ushort FlowSettleDwell { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel0DutyCycle register.
+        /// Creates a message payload for the FlowSettleDwell register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort GetPayload()
         {
-            return Channel0DutyCycle;
+            return FlowSettleDwell;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle for proportional valve 0 [%].
+        /// Creates a message that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel0DutyCycle register.</returns>
+        /// <returns>A new message for the FlowSettleDwell register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettleDwell.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle for proportional valve 0 [%].
+    /// that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.
     /// </summary>
-    [DisplayName("TimestampedChannel0DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle for proportional valve 0 [%].")]
-    public partial class CreateTimestampedChannel0DutyCyclePayload : CreateChannel0DutyCyclePayload
+    [DisplayName("TimestampedFlowSettleDwellPayload")]
+    [Description("Creates a timestamped message payload that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.")]
+    public partial class CreateTimestampedFlowSettleDwellPayload : CreateFlowSettleDwellPayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle for proportional valve 0 [%].
+        /// Creates a timestamped message that time in milliseconds the flow error must stay within the tolerance for a channel to be considered settled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel0DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the FlowSettleDwell register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel0DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettleDwell.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle for proportional valve 1 [%].
+    /// that the channels whose flow is settled.
     /// </summary>
-    [DisplayName("Channel1DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle for proportional valve 1 [%].")]
-    public partial class CreateChannel1DutyCyclePayload
+    [DisplayName("FlowSettledPayload")]
+    [Description("Creates a message payload that the channels whose flow is settled.")]
+    public partial class CreateFlowSettledPayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle for proportional valve 1 [%].
+        /// Gets or sets the value that the channels whose flow is settled.
         /// </summary>
-        [Range(min: 0.2, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle for proportional valve 1 [%].")]
-        public float Channel1DutyCycle { get; set; } = 0.2F;
+        [Description("The value that the channels whose flow is settled.")]
+        public FlowChannels FlowSettled { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel1DutyCycle register.
+        /// Creates a message payload for the FlowSettled register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public FlowChannels GetPayload()
         {
-            return Channel1DutyCycle;
+            return FlowSettled;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle for proportional valve 1 [%].
+        /// Creates a message that the channels whose flow is settled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel1DutyCycle register.</returns>
+        /// <returns>A new message for the FlowSettled register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettled.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle for proportional valve 1 [%].
+    /// that the channels whose flow is settled.
     /// </summary>
-    [DisplayName("TimestampedChannel1DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle for proportional valve 1 [%].")]
-    public partial class CreateTimestampedChannel1DutyCyclePayload : CreateChannel1DutyCyclePayload
+    [DisplayName("TimestampedFlowSettledPayload")]
+    [Description("Creates a timestamped message payload that the channels whose flow is settled.")]
+    public partial class CreateTimestampedFlowSettledPayload : CreateFlowSettledPayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle for proportional valve 1 [%].
+        /// Creates a timestamped message that the channels whose flow is settled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel1DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the FlowSettled register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel1DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettled.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle for proportional valve 2 [%].
+    /// that time in milliseconds from the last target change until each channel settled.
     /// </summary>
-    [DisplayName("Channel2DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle for proportional valve 2 [%].")]
-    public partial class CreateChannel2DutyCyclePayload
+    [DisplayName("FlowSettleTimePayload")]
+    [Description("Creates a message payload that time in milliseconds from the last target change until each channel settled.")]
+    public partial class CreateFlowSettleTimePayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle for proportional valve 2 [%].
+        /// Gets or sets the value that time in milliseconds from the last target change until each channel settled.
         /// </summary>
-        [Range(min: 0.2, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle for proportional valve 2 [%].")]
-        public float Channel2DutyCycle { get; set; } = 0.2F;
+        [Description("The value that time in milliseconds from the last target change until each channel settled.")]
+        public ushort[] FlowSettleTime { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel2DutyCycle register.
+        /// Creates a message payload for the FlowSettleTime register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public ushort[] GetPayload()
         {
-            return Channel2DutyCycle;
+            return FlowSettleTime;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle for proportional valve 2 [%].
+        /// Creates a message that time in milliseconds from the last target change until each channel settled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel2DutyCycle register.</returns>
+        /// <returns>A new message for the FlowSettleTime register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettleTime.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle for proportional valve 2 [%].
+    /// that time in milliseconds from the last target change until each channel settled.
     /// </summary>
-    [DisplayName("TimestampedChannel2DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle for proportional valve 2 [%].")]
-    public partial class CreateTimestampedChannel2DutyCyclePayload : CreateChannel2DutyCyclePayload
+    [DisplayName("TimestampedFlowSettleTimePayload")]
+    [Description("Creates a timestamped message payload that time in milliseconds from the last target change until each channel settled.")]
+    public partial class CreateTimestampedFlowSettleTimePayload : CreateFlowSettleTimePayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle for proportional valve 2 [%].
+        /// Creates a timestamped message that time in milliseconds from the last target change until each channel settled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel2DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the FlowSettleTime register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel2DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.FlowSettleTime.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle for proportional valve 3 [%].
+    /// that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.
     /// </summary>
-    [DisplayName("Channel3DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle for proportional valve 3 [%].")]
-    public partial class CreateChannel3DutyCyclePayload
+    [DisplayName("PwmDitherPayload")]
+    [Description("Creates a message payload that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.")]
+    public partial class CreatePwmDitherPayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle for proportional valve 3 [%].
+        /// Gets or sets the value that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.
         /// </summary>
-        [Range(min: 0.2, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle for proportional valve 3 [%].")]
-        public float Channel3DutyCycle { get; set; } = 0.2F;
+        [Description("The value that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.")]
+        public FlowChannels PwmDither { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel3DutyCycle register.
+        /// Creates a message payload for the PwmDither register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public FlowChannels GetPayload()
         {
-            return Channel3DutyCycle;
+            return PwmDither;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle for proportional valve 3 [%].
+        /// Creates a message that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel3DutyCycle register.</returns>
+        /// <returns>A new message for the PwmDither register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.PwmDither.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle for proportional valve 3 [%].
+    /// that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.
     /// </summary>
-    [DisplayName("TimestampedChannel3DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle for proportional valve 3 [%].")]
-    public partial class CreateTimestampedChannel3DutyCyclePayload : CreateChannel3DutyCyclePayload
+    [DisplayName("TimestampedPwmDitherPayload")]
+    [Description("Creates a timestamped message payload that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.")]
+    public partial class CreateTimestampedPwmDitherPayload : CreatePwmDitherPayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle for proportional valve 3 [%].
+        /// Creates a timestamped message that the channels whose PWM duty cycle is dithered across periods, giving 1/256 of a timer count of duty cycle resolution.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel3DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the PwmDither register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel3DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.PwmDither.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that duty cycle for proportional valve 4 [%].
+    /// that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.
     /// </summary>
-    [DisplayName("Channel4DutyCyclePayload")]
-    [Description("Creates a message payload that duty cycle for proportional valve 4 [%].")]
-    public partial class CreateChannel4DutyCyclePayload
+    [DisplayName("PwmPhasePayload")]
+    [Description("Creates a message payload that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.")]
+    public partial class CreatePwmPhasePayload
     {
         /// <summary>
-        /// Gets or sets the value that duty cycle for proportional valve 4 [%].
+        /// Gets or sets the value that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.
         /// </summary>
-        [Range(min: 0.2, max: 99.9)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that duty cycle for proportional valve 4 [%].")]
-        public float Channel4DutyCycle { get; set; } = 0.2F;
+        [Description("The value that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.")]
+        public byte[] PwmPhase { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Channel4DutyCycle register.
+        /// Creates a message payload for the PwmPhase register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public float GetPayload()
+        public byte[] GetPayload()
         {
-            return Channel4DutyCycle;
+            return PwmPhase;
         }
 
         /// <summary>
-        /// Creates a message that duty cycle for proportional valve 4 [%].
+        /// Creates a message that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel4DutyCycle register.</returns>
+        /// <returns>A new message for the PwmPhase register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4DutyCycle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.PwmPhase.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that duty cycle for proportional valve 4 [%].
+    /// that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.
     /// </summary>
-    [DisplayName("TimestampedChannel4DutyCyclePayload")]
-    [Description("Creates a timestamped message payload that duty cycle for proportional valve 4 [%].")]
-    public partial class CreateTimestampedChannel4DutyCyclePayload : CreateChannel4DutyCyclePayload
+    [DisplayName("TimestampedPwmPhasePayload")]
+    [Description("Creates a timestamped message payload that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.")]
+    public partial class CreateTimestampedPwmPhasePayload : CreatePwmPhasePayload
     {
         /// <summary>
-        /// Creates a timestamped message that duty cycle for proportional valve 4 [%].
+        /// Creates a timestamped message that phase offset of each channel PWM, in percentage of the period. Applied when a channel starts while another one runs at the same frequency.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel4DutyCycle register.</returns>
+        /// <returns>A new timestamped message for the PwmPhase register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Channel4DutyCycle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.PwmPhase.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.
     /// </summary>
-    [DisplayName("DigitalOutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateDigitalOutputSetPayload
+    [DisplayName("ChannelsEnablePayload")]
+    [Description("Creates a message payload that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.")]
+    public partial class CreateChannelsEnablePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputSet { get; set; }
+        [Description("The value that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.")]
+        public FlowChannels ChannelsEnable { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputSet register.
+        /// Creates a message payload for the ChannelsEnable register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public FlowChannels GetPayload()
         {
-            return DigitalOutputSet;
+            return ChannelsEnable;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputSet register.</returns>
+        /// <returns>A new message for the ChannelsEnable register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputSet.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsEnable.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputSetPayload : CreateDigitalOutputSetPayload
+    [DisplayName("TimestampedChannelsEnablePayload")]
+    [Description("Creates a timestamped message payload that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.")]
+    public partial class CreateTimestampedChannelsEnablePayload : CreateChannelsEnablePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that the channels that run while EnableFlow is on. A disabled channel stops its PWM and control loop and restarts with its last duty cycle.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputSet register.</returns>
+        /// <returns>A new timestamped message for the ChannelsEnable register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsEnable.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clears the specified digital output lines.
+    /// that the channels that send actual flow events while the ChannelActualFlow event is enabled.
     /// </summary>
-    [DisplayName("DigitalOutputClearPayload")]
-    [Description("Creates a message payload that clears the specified digital output lines.")]
-    public partial class CreateDigitalOutputClearPayload
+    [DisplayName("ChannelsEnableEventsPayload")]
+    [Description("Creates a message payload that the channels that send actual flow events while the ChannelActualFlow event is enabled.")]
+    public partial class CreateChannelsEnableEventsPayload
     {
         /// <summary>
-        /// Gets or sets the value that clears the specified digital output lines.
+        /// Gets or sets the value that the channels that send actual flow events while the ChannelActualFlow event is enabled.
         /// </summary>
-        [Description("The value that clears the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputClear { get; set; }
+        [Description("The value that the channels that send actual flow events while the ChannelActualFlow event is enabled.")]
+        public FlowChannels ChannelsEnableEvents { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputClear register.
+        /// Creates a message payload for the ChannelsEnableEvents register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public FlowChannels GetPayload()
         {
-            return DigitalOutputClear;
+            return ChannelsEnableEvents;
         }
 
         /// <summary>
-        /// Creates a message that clears the specified digital output lines.
+        /// Creates a message that the channels that send actual flow events while the ChannelActualFlow event is enabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputClear register.</returns>
+        /// <returns>A new message for the ChannelsEnableEvents register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputClear.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsEnableEvents.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clears the specified digital output lines.
+    /// that the channels that send actual flow events while the ChannelActualFlow event is enabled.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clears the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputClearPayload : CreateDigitalOutputClearPayload
+    [DisplayName("TimestampedChannelsEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that the channels that send actual flow events while the ChannelActualFlow event is enabled.")]
+    public partial class CreateTimestampedChannelsEnableEventsPayload : CreateChannelsEnableEventsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that clears the specified digital output lines.
+        /// Creates a timestamped message that the channels that send actual flow events while the ChannelActualFlow event is enabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputClear register.</returns>
+        /// <returns>A new timestamped message for the ChannelsEnableEvents register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsEnableEvents.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that toggles the specified digital output lines.
+    /// that configures the warm start of the channels from their last converged duty cycle.
     /// </summary>
-    [DisplayName("DigitalOutputTogglePayload")]
-    [Description("Creates a message payload that toggles the specified digital output lines.")]
-    public partial class CreateDigitalOutputTogglePayload
+    [DisplayName("WarmStartPayload")]
+    [Description("Creates a message payload that configures the warm start of the channels from their last converged duty cycle.")]
+    public partial class CreateWarmStartPayload
     {
         /// <summary>
-        /// Gets or sets the value that toggles the specified digital output lines.
+        /// Gets or sets the value that configures the warm start of the channels from their last converged duty cycle.
         /// </summary>
-        [Description("The value that toggles the specified digital output lines.")]
-        public DigitalOutputs DigitalOutputToggle { get; set; }
+        [Description("The value that configures the warm start of the channels from their last converged duty cycle.")]
+        public WarmStartConfig WarmStart { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputToggle register.
+        /// Creates a message payload for the WarmStart register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public WarmStartConfig GetPayload()
         {
-            return DigitalOutputToggle;
+            return WarmStart;
         }
 
         /// <summary>
-        /// Creates a message that toggles the specified digital output lines.
+        /// Creates a message that configures the warm start of the channels from their last converged duty cycle.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputToggle register.</returns>
+        /// <returns>A new message for the WarmStart register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputToggle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.WarmStart.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that toggles the specified digital output lines.
+    /// that configures the warm start of the channels from their last converged duty cycle.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputTogglePayload")]
-    [Description("Creates a timestamped message payload that toggles the specified digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputTogglePayload : CreateDigitalOutputTogglePayload
+    [DisplayName("TimestampedWarmStartPayload")]
+    [Description("Creates a timestamped message payload that configures the warm start of the channels from their last converged duty cycle.")]
+    public partial class CreateTimestampedWarmStartPayload : CreateWarmStartPayload
     {
         /// <summary>
-        /// Creates a timestamped message that toggles the specified digital output lines.
+        /// Creates a timestamped message that configures the warm start of the channels from their last converged duty cycle.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputToggle register.</returns>
+        /// <returns>A new timestamped message for the WarmStart register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputToggle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.WarmStart.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that write the state of all digital output lines.
-    /// </summary>
-    [DisplayName("DigitalOutputStatePayload")]
-    [Description("Creates a message payload that write the state of all digital output lines.")]
-    public partial class CreateDigitalOutputStatePayload
-    {
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.
+    /// </summary>
+    [DisplayName("CalibrationProfilePayload")]
+    [Description("Creates a message payload that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.")]
+    public partial class CreateCalibrationProfilePayload
+    {
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel0.
+        /// </summary>
+        [Range(min: 0, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("")]
+        public byte Channel0 { get; set; } = 0;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel1.
+        /// </summary>
+        [Range(min: 0, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("")]
+        public byte Channel1 { get; set; } = 0;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel2.
+        /// </summary>
+        [Range(min: 0, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("")]
+        public byte Channel2 { get; set; } = 0;
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Channel3.
+        /// </summary>
+        [Range(min: 0, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("")]
+        public byte Channel3 { get; set; } = 0;
+
         /// <summary>
-        /// Gets or sets the value that write the state of all digital output lines.
+        /// Gets or sets a value to write on payload member Channel4.
         /// </summary>
-        [Description("The value that write the state of all digital output lines.")]
-        public DigitalOutputs DigitalOutputState { get; set; }
+        [Range(min: 0, max: 3)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("")]
+        public byte Channel4 { get; set; } = 0;
 
         /// <summary>
-        /// Creates a message payload for the DigitalOutputState register.
+        /// Creates a message payload for the CalibrationProfile register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public CalibrationProfilePayload GetPayload()
         {
-            return DigitalOutputState;
+            CalibrationProfilePayload value;
+            value.Channel0 = Channel0;
+            value.Channel1 = Channel1;
+            value.Channel2 = Channel2;
+            value.Channel3 = Channel3;
+            value.Channel4 = Channel4;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all digital output lines.
+        /// Creates a message that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalOutputState register.</returns>
+        /// <returns>A new message for the CalibrationProfile register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputState.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationProfile.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all digital output lines.
+    /// that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.
     /// </summary>
-    [DisplayName("TimestampedDigitalOutputStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
-    public partial class CreateTimestampedDigitalOutputStatePayload : CreateDigitalOutputStatePayload
+    [DisplayName("TimestampedCalibrationProfilePayload")]
+    [Description("Creates a timestamped message payload that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.")]
+    public partial class CreateTimestampedCalibrationProfilePayload : CreateCalibrationProfilePayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all digital output lines.
+        /// Creates a timestamped message that selects the stored calibration profile used by each channel. Zero uses the factory calibration, or the user calibration when enabled.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalOutputState register.</returns>
+        /// <returns>A new timestamped message for the CalibrationProfile register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DigitalOutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationProfile.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enable pulse mode for valves.
+    /// that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.
     /// </summary>
-    [DisplayName("EnableValvePulsePayload")]
-    [Description("Creates a message payload that enable pulse mode for valves.")]
-    public partial class CreateEnableValvePulsePayload
+    [DisplayName("CalibrationProfileNamePayload")]
+    [Description("Creates a message payload that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.")]
+    public partial class CreateCalibrationProfileNamePayload
     {
         /// <summary>
-        /// Gets or sets the value that enable pulse mode for valves.
+        /// Gets or sets the value that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.
         /// </summary>
-        [Description("The value that enable pulse mode for valves.")]
-        public Valves EnableValvePulse { get; set; }
+        [Description("The value that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.")]
+        public byte[] CalibrationProfileName { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableValvePulse register.
+        /// Creates a message payload for the CalibrationProfileName register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Valves GetPayload()
+        public byte[] GetPayload()
         {
-            return EnableValvePulse;
+            return CalibrationProfileName;
         }
 
         /// <summary>
-        /// Creates a message that enable pulse mode for valves.
+        /// Creates a message that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableValvePulse register.</returns>
+        /// <returns>A new message for the CalibrationProfileName register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.EnableValvePulse.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationProfileName.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enable pulse mode for valves.
+    /// that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.
     /// </summary>
-    [DisplayName("TimestampedEnableValvePulsePayload")]
-    [Description("Creates a timestamped message payload that enable pulse mode for valves.")]
-    public partial class CreateTimestampedEnableValvePulsePayload : CreateEnableValvePulsePayload
+    [DisplayName("TimestampedCalibrationProfileNamePayload")]
+    [Description("Creates a timestamped message payload that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.")]
+    public partial class CreateTimestampedCalibrationProfileNamePayload : CreateCalibrationProfileNamePayload
     {
         /// <summary>
-        /// Creates a timestamped message that enable pulse mode for valves.
+        /// Creates a timestamped message that aSCII name stored with the next saved calibration profile. Reports the name of the last selected profile.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableValvePulse register.</returns>
+        /// <returns>A new timestamped message for the CalibrationProfileName register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.EnableValvePulse.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationProfileName.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified valve output lines.
+    /// that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.
     /// </summary>
-    [DisplayName("ValveSetPayload")]
-    [Description("Creates a message payload that set the specified valve output lines.")]
-    public partial class CreateValveSetPayload
+    [DisplayName("CalibrationProfileSavePayload")]
+    [Description("Creates a message payload that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.")]
+    public partial class CreateCalibrationProfileSavePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified valve output lines.
+        /// Gets or sets a value to write on payload member Channel.
         /// </summary>
-        [Description("The value that set the specified valve output lines.")]
-        public Valves ValveSet { get; set; }
+        [Description("")]
+        public byte Channel { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ValveSet register.
+        /// Gets or sets a value to write on payload member Profile.
+        /// </summary>
+        [Description("")]
+        public byte Profile { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CalibrationProfileSave register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Valves GetPayload()
+        public CalibrationProfileSavePayload GetPayload()
         {
-            return ValveSet;
+            CalibrationProfileSavePayload value;
+            value.Channel = Channel;
+            value.Profile = Profile;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that set the specified valve output lines.
+        /// Creates a message that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ValveSet register.</returns>
+        /// <returns>A new message for the CalibrationProfileSave register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.ValveSet.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationProfileSave.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified valve output lines.
+    /// that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.
     /// </summary>
-    [DisplayName("TimestampedValveSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified valve output lines.")]
-    public partial class CreateTimestampedValveSetPayload : CreateValveSetPayload
+    [DisplayName("TimestampedCalibrationProfileSavePayload")]
+    [Description("Creates a timestamped message payload that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.")]
+    public partial class CreateTimestampedCalibrationProfileSavePayload : CreateCalibrationProfileSavePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified valve output lines.
+        /// Creates a timestamped message that saves the user calibration of a channel, with the CalibrationProfileName, as one of its 3 stored calibration profiles. A user calibration whose values do not increase is not saved.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ValveSet register.</returns>
+        /// <returns>A new timestamped message for the CalibrationProfileSave register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.ValveSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationProfileSave.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clears the specified valve output lines.
+    /// that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.
     /// </summary>
-    [DisplayName("ValveClearPayload")]
-    [Description("Creates a message payload that clears the specified valve output lines.")]
-    public partial class CreateValveClearPayload
+    [DisplayName("CalibrationCurvePayload")]
+    [Description("Creates a message payload that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.")]
+    public partial class CreateCalibrationCurvePayload
     {
         /// <summary>
-        /// Gets or sets the value that clears the specified valve output lines.
+        /// Gets or sets the value that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.
         /// </summary>
-        [Description("The value that clears the specified valve output lines.")]
-        public Valves ValveClear { get; set; }
+        [Description("The value that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.")]
+        public ushort[] CalibrationCurve { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ValveClear register.
+        /// Creates a message payload for the CalibrationCurve register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Valves GetPayload()
+        public ushort[] GetPayload()
         {
-            return ValveClear;
+            return CalibrationCurve;
         }
 
         /// <summary>
-        /// Creates a message that clears the specified valve output lines.
+        /// Creates a message that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ValveClear register.</returns>
+        /// <returns>A new message for the CalibrationCurve register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.ValveClear.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationCurve.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clears the specified valve output lines.
+    /// that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.
     /// </summary>
-    [DisplayName("TimestampedValveClearPayload")]
-    [Description("Creates a timestamped message payload that clears the specified valve output lines.")]
-    public partial class CreateTimestampedValveClearPayload : CreateValveClearPayload
+    [DisplayName("TimestampedCalibrationCurvePayload")]
+    [Description("Creates a timestamped message payload that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.")]
+    public partial class CreateTimestampedCalibrationCurvePayload : CreateCalibrationCurvePayload
     {
         /// <summary>
-        /// Creates a timestamped message that clears the specified valve output lines.
+        /// Creates a timestamped message that calibration curve of one channel with up to 32 points, used instead of its other calibrations. The first word selects the channel and the interpolation, the second the number of points (0 removes the curve), followed by pairs of ADC code and flow in 0.1 ml/min. Each channel keeps its own curve. The register reads back the curve written last, which is the only one saved with the other registers.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ValveClear register.</returns>
+        /// <returns>A new timestamped message for the CalibrationCurve register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.ValveClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationCurve.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that toggles the specified valve output lines.
+    /// that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.
     /// </summary>
-    [DisplayName("ValveTogglePayload")]
-    [Description("Creates a message payload that toggles the specified valve output lines.")]
-    public partial class CreateValveTogglePayload
+    [DisplayName("CalibrationSweepPayload")]
+    [Description("Creates a message payload that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.")]
+    public partial class CreateCalibrationSweepPayload
     {
         /// <summary>
-        /// Gets or sets the value that toggles the specified valve output lines.
+        /// Gets or sets a value to write on payload member Channel.
         /// </summary>
-        [Description("The value that toggles the specified valve output lines.")]
-        public Valves ValveToggle { get; set; }
+        [Description("")]
+        public byte Channel { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ValveToggle register.
+        /// Gets or sets a value to write on payload member Run.
+        /// </summary>
+        [Description("")]
+        public bool Run { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CalibrationSweep register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Valves GetPayload()
+        public CalibrationSweepPayload GetPayload()
         {
-            return ValveToggle;
+            CalibrationSweepPayload value;
+            value.Channel = Channel;
+            value.Run = Run;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that toggles the specified valve output lines.
+        /// Creates a message that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ValveToggle register.</returns>
+        /// <returns>A new message for the CalibrationSweep register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.ValveToggle.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSweep.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that toggles the specified valve output lines.
+    /// that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.
     /// </summary>
-    [DisplayName("TimestampedValveTogglePayload")]
-    [Description("Creates a timestamped message payload that toggles the specified valve output lines.")]
-    public partial class CreateTimestampedValveTogglePayload : CreateValveTogglePayload
+    [DisplayName("TimestampedCalibrationSweepPayload")]
+    [Description("Creates a timestamped message payload that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.")]
+    public partial class CreateTimestampedCalibrationSweepPayload : CreateCalibrationSweepPayload
     {
         /// <summary>
-        /// Creates a timestamped message that toggles the specified valve output lines.
+        /// Creates a timestamped message that starts the calibration sweep of a channel, or stops it. An event is sent when the sweep ends.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ValveToggle register.</returns>
+        /// <returns>A new timestamped message for the CalibrationSweep register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.ValveToggle.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSweep.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that controls the specified valve output lines.
+    /// that configures the calibration sweep.
     /// </summary>
-    [DisplayName("ValveStatePayload")]
-    [Description("Creates a message payload that controls the specified valve output lines.")]
-    public partial class CreateValveStatePayload
+    [DisplayName("CalibrationSweepConfigPayload")]
+    [Description("Creates a message payload that configures the calibration sweep.")]
+    public partial class CreateCalibrationSweepConfigPayload
     {
         /// <summary>
-        /// Gets or sets the value that controls the specified valve output lines.
+        /// Gets or sets a value to write on payload member FirstDutyCycle.
         /// </summary>
-        [Description("The value that controls the specified valve output lines.")]
-        public Valves ValveState { get; set; }
+        [Description("The first duty cycle of the sweep, in 0.1 %.")]
+        public ushort FirstDutyCycle { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ValveState register.
+        /// Gets or sets a value to write on payload member LastDutyCycle.
+        /// </summary>
+        [Description("The last duty cycle of the sweep, in 0.1 %.")]
+        public ushort LastDutyCycle { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Steps.
+        /// </summary>
+        [Description("The number of duty cycles measured, from 2 to 255.")]
+        public ushort Steps { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member SettleTime.
+        /// </summary>
+        [Description("The time to wait after each duty cycle change, in ms.")]
+        public ushort SettleTime { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member AverageTime.
+        /// </summary>
+        [Description("The time over which the flowmeter code is averaged, in ms.")]
+        public ushort AverageTime { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CalibrationSweepConfig register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Valves GetPayload()
-        {
-            return ValveState;
+        public CalibrationSweepConfigPayload GetPayload()
+        {
+            CalibrationSweepConfigPayload value;
+            value.FirstDutyCycle = FirstDutyCycle;
+            value.LastDutyCycle = LastDutyCycle;
+            value.Steps = Steps;
+            value.SettleTime = SettleTime;
+            value.AverageTime = AverageTime;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that controls the specified valve output lines.
+        /// Creates a message that configures the calibration sweep.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ValveState register.</returns>
+        /// <returns>A new message for the CalibrationSweepConfig register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.ValveState.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSweepConfig.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that controls the specified valve output lines.
+    /// that configures the calibration sweep.
     /// </summary>
-    [DisplayName("TimestampedValveStatePayload")]
-    [Description("Creates a timestamped message payload that controls the specified valve output lines.")]
-    public partial class CreateTimestampedValveStatePayload : CreateValveStatePayload
+    [DisplayName("TimestampedCalibrationSweepConfigPayload")]
+    [Description("Creates a timestamped message payload that configures the calibration sweep.")]
+    public partial class CreateTimestampedCalibrationSweepConfigPayload : CreateCalibrationSweepConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that controls the specified valve output lines.
+        /// Creates a timestamped message that configures the calibration sweep.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ValveState register.</returns>
+        /// <returns>A new timestamped message for the CalibrationSweepConfig register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.ValveState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSweepConfig.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all odor valve output lines.
+    /// that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.
     /// </summary>
-    [DisplayName("OdorValveStatePayload")]
-    [Description("Creates a message payload that write the state of all odor valve output lines.")]
-    public partial class CreateOdorValveStatePayload
+    [DisplayName("CalibrationSweepDataPayload")]
+    [Description("Creates a message payload that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.")]
+    public partial class CreateCalibrationSweepDataPayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all odor valve output lines.
+        /// Gets or sets the value that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.
         /// </summary>
-        [Description("The value that write the state of all odor valve output lines.")]
-        public OdorValves OdorValveState { get; set; }
+        [Description("The value that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.")]
+        public ushort[] CalibrationSweepData { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OdorValveState register.
+        /// Creates a message payload for the CalibrationSweepData register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public OdorValves GetPayload()
+        public ushort[] GetPayload()
         {
-            return OdorValveState;
+            return CalibrationSweepData;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all odor valve output lines.
+        /// Creates a message that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OdorValveState register.</returns>
+        /// <returns>A new message for the CalibrationSweepData register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.OdorValveState.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSweepData.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all odor valve output lines.
+    /// that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.
     /// </summary>
-    [DisplayName("TimestampedOdorValveStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all odor valve output lines.")]
-    public partial class CreateTimestampedOdorValveStatePayload : CreateOdorValveStatePayload
+    [DisplayName("TimestampedCalibrationSweepDataPayload")]
+    [Description("Creates a timestamped message payload that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.")]
+    public partial class CreateTimestampedCalibrationSweepDataPayload : CreateCalibrationSweepDataPayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all odor valve output lines.
+        /// Creates a timestamped message that reports up to 8 points of the calibration sweep. The first step index and the number of points are followed by pairs of duty cycle (0.1 %) and mean flowmeter ADC code. The last batch can be read until the next point is measured.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OdorValveState register.</returns>
+        /// <returns>A new timestamped message for the CalibrationSweepData register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.OdorValveState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSweepData.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all end valve output lines.
+    /// that the volume delivered by each channel since it was last reset, in ul.
     /// </summary>
-    [DisplayName("EndValveStatePayload")]
-    [Description("Creates a message payload that write the state of all end valve output lines.")]
-    public partial class CreateEndValveStatePayload
+    [DisplayName("ChannelsTotalVolumePayload")]
+    [Description("Creates a message payload that the volume delivered by each channel since it was last reset, in ul.")]
+    public partial class CreateChannelsTotalVolumePayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all end valve output lines.
+        /// Gets or sets the value that the volume delivered by each channel since it was last reset, in ul.
         /// </summary>
-        [Description("The value that write the state of all end valve output lines.")]
-        public EndValves EndValveState { get; set; }
+        [Description("The value that the volume delivered by each channel since it was last reset, in ul.")]
+        public uint[] ChannelsTotalVolume { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EndValveState register.
+        /// Creates a message payload for the ChannelsTotalVolume register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public EndValves GetPayload()
+        public uint[] GetPayload()
         {
-            return EndValveState;
+            return ChannelsTotalVolume;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all end valve output lines.
+        /// Creates a message that the volume delivered by each channel since it was last reset, in ul.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EndValveState register.</returns>
+        /// <returns>A new message for the ChannelsTotalVolume register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.EndValveState.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsTotalVolume.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all end valve output lines.
+    /// that the volume delivered by each channel since it was last reset, in ul.
     /// </summary>
-    [DisplayName("TimestampedEndValveStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all end valve output lines.")]
-    public partial class CreateTimestampedEndValveStatePayload : CreateEndValveStatePayload
+    [DisplayName("TimestampedChannelsTotalVolumePayload")]
+    [Description("Creates a timestamped message payload that the volume delivered by each channel since it was last reset, in ul.")]
+    public partial class CreateTimestampedChannelsTotalVolumePayload : CreateChannelsTotalVolumePayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all end valve output lines.
+        /// Creates a timestamped message that the volume delivered by each channel since it was last reset, in ul.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EndValveState register.</returns>
+        /// <returns>A new timestamped message for the ChannelsTotalVolume register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.EndValveState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsTotalVolume.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all check valve output lines.
+    /// that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.
     /// </summary>
-    [DisplayName("CheckValveStatePayload")]
-    [Description("Creates a message payload that write the state of all check valve output lines.")]
-    public partial class CreateCheckValveStatePayload
+    [DisplayName("ChannelsTotalVolumeLatchedPayload")]
+    [Description("Creates a message payload that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.")]
+    public partial class CreateChannelsTotalVolumeLatchedPayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all check valve output lines.
+        /// Gets or sets the value that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.
         /// </summary>
-        [Description("The value that write the state of all check valve output lines.")]
-        public CheckValves CheckValveState { get; set; }
+        [Description("The value that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.")]
+        public uint[] ChannelsTotalVolumeLatched { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CheckValveState register.
+        /// Creates a message payload for the ChannelsTotalVolumeLatched register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public CheckValves GetPayload()
+        public uint[] GetPayload()
         {
-            return CheckValveState;
+            return ChannelsTotalVolumeLatched;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all check valve output lines.
+        /// Creates a message that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CheckValveState register.</returns>
+        /// <returns>A new message for the ChannelsTotalVolumeLatched register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValveState.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsTotalVolumeLatched.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all check valve output lines.
+    /// that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.
     /// </summary>
-    [DisplayName("TimestampedCheckValveStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all check valve output lines.")]
-    public partial class CreateTimestampedCheckValveStatePayload : CreateCheckValveStatePayload
+    [DisplayName("TimestampedChannelsTotalVolumeLatchedPayload")]
+    [Description("Creates a timestamped message payload that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.")]
+    public partial class CreateTimestampedChannelsTotalVolumeLatchedPayload : CreateChannelsTotalVolumeLatchedPayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all check valve output lines.
+        /// Creates a timestamped message that the volume of each channel copied by the last TotalVolumeCommand latching it, in ul.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CheckValveState register.</returns>
+        /// <returns>A new timestamped message for the ChannelsTotalVolumeLatched register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValveState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ChannelsTotalVolumeLatched.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the pulse duration for Valve0.
+    /// that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.
     /// </summary>
-    [DisplayName("Valve0PulseDurationPayload")]
-    [Description("Creates a message payload that sets the pulse duration for Valve0.")]
-    public partial class CreateValve0PulseDurationPayload
+    [DisplayName("TotalVolumeCommandPayload")]
+    [Description("Creates a message payload that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.")]
+    public partial class CreateTotalVolumeCommandPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the pulse duration for Valve0.
+        /// Gets or sets a value to write on payload member Channels.
         /// </summary>
-        [Range(min: 1, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the pulse duration for Valve0.")]
-        public ushort Valve0PulseDuration { get; set; } = 1;
+        [Description("")]
+        public FlowChannels Channels { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Valve0PulseDuration register.
+        /// Gets or sets a value to write on payload member Latch.
+        /// </summary>
+        [Description("")]
+        public bool Latch { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member Reset.
+        /// </summary>
+        [Description("")]
+        public bool Reset { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the TotalVolumeCommand register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public TotalVolumeCommandPayload GetPayload()
         {
-            return Valve0PulseDuration;
+            TotalVolumeCommandPayload value;
+            value.Channels = Channels;
+            value.Latch = Latch;
+            value.Reset = Reset;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that sets the pulse duration for Valve0.
+        /// Creates a message that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Valve0PulseDuration register.</returns>
+        /// <returns>A new message for the TotalVolumeCommand register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Valve0PulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.TotalVolumeCommand.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the pulse duration for Valve0.
+    /// that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.
     /// </summary>
-    [DisplayName("TimestampedValve0PulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the pulse duration for Valve0.")]
-    public partial class CreateTimestampedValve0PulseDurationPayload : CreateValve0PulseDurationPayload
+    [DisplayName("TimestampedTotalVolumeCommandPayload")]
+    [Description("Creates a timestamped message payload that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.")]
+    public partial class CreateTimestampedTotalVolumeCommandPayload : CreateTotalVolumeCommandPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the pulse duration for Valve0.
+        /// Creates a timestamped message that latches and/or resets the volume of the selected channels in the same ms. Latching is done before resetting.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Valve0PulseDuration register.</returns>
+        /// <returns>A new timestamped message for the TotalVolumeCommand register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Valve0PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.TotalVolumeCommand.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the pulse duration for Valve1.
+    /// that the channels 0 to 3 that only add volume while the odor valve with the same number is open.
     /// </summary>
-    [DisplayName("Valve1PulseDurationPayload")]
-    [Description("Creates a message payload that sets the pulse duration for Valve1.")]
-    public partial class CreateValve1PulseDurationPayload
+    [DisplayName("TotalVolumeGatedPayload")]
+    [Description("Creates a message payload that the channels 0 to 3 that only add volume while the odor valve with the same number is open.")]
+    public partial class CreateTotalVolumeGatedPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the pulse duration for Valve1.
+        /// Gets or sets the value that the channels 0 to 3 that only add volume while the odor valve with the same number is open.
         /// </summary>
-        [Range(min: 1, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the pulse duration for Valve1.")]
-        public ushort Valve1PulseDuration { get; set; } = 1;
+        [Description("The value that the channels 0 to 3 that only add volume while the odor valve with the same number is open.")]
+        public FlowChannels TotalVolumeGated { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Valve1PulseDuration register.
+        /// Creates a message payload for the TotalVolumeGated register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public FlowChannels GetPayload()
         {
-            return Valve1PulseDuration;
+            return TotalVolumeGated;
         }
 
         /// <summary>
-        /// Creates a message that sets the pulse duration for Valve1.
+        /// Creates a message that the channels 0 to 3 that only add volume while the odor valve with the same number is open.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Valve1PulseDuration register.</returns>
+        /// <returns>A new message for the TotalVolumeGated register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Valve1PulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.TotalVolumeGated.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the pulse duration for Valve1.
+    /// that the channels 0 to 3 that only add volume while the odor valve with the same number is open.
     /// </summary>
-    [DisplayName("TimestampedValve1PulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the pulse duration for Valve1.")]
-    public partial class CreateTimestampedValve1PulseDurationPayload : CreateValve1PulseDurationPayload
+    [DisplayName("TimestampedTotalVolumeGatedPayload")]
+    [Description("Creates a timestamped message payload that the channels 0 to 3 that only add volume while the odor valve with the same number is open.")]
+    public partial class CreateTimestampedTotalVolumeGatedPayload : CreateTotalVolumeGatedPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the pulse duration for Valve1.
+        /// Creates a timestamped message that the channels 0 to 3 that only add volume while the odor valve with the same number is open.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Valve1PulseDuration register.</returns>
+        /// <returns>A new timestamped message for the TotalVolumeGated register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Valve1PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.TotalVolumeGated.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the pulse duration for Valve2.
+    /// that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.
     /// </summary>
-    [DisplayName("Valve2PulseDurationPayload")]
-    [Description("Creates a message payload that sets the pulse duration for Valve2.")]
-    public partial class CreateValve2PulseDurationPayload
+    [DisplayName("MixTotalFlowPayload")]
+    [Description("Creates a message payload that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.")]
+    public partial class CreateMixTotalFlowPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the pulse duration for Valve2.
+        /// Gets or sets the value that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.
         /// </summary>
-        [Range(min: 1, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the pulse duration for Valve2.")]
-        public ushort Valve2PulseDuration { get; set; } = 1;
+        [Description("The value that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.")]
+        public float MixTotalFlow { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Valve2PulseDuration register.
+        /// Creates a message payload for the MixTotalFlow register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public float GetPayload()
         {
-            return Valve2PulseDuration;
+            return MixTotalFlow;
         }
 
         /// <summary>
-        /// Creates a message that sets the pulse duration for Valve2.
+        /// Creates a message that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Valve2PulseDuration register.</returns>
+        /// <returns>A new message for the MixTotalFlow register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Valve2PulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.MixTotalFlow.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the pulse duration for Valve2.
+    /// that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.
     /// </summary>
-    [DisplayName("TimestampedValve2PulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the pulse duration for Valve2.")]
-    public partial class CreateTimestampedValve2PulseDurationPayload : CreateValve2PulseDurationPayload
+    [DisplayName("TimestampedMixTotalFlowPayload")]
+    [Description("Creates a timestamped message payload that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.")]
+    public partial class CreateTimestampedMixTotalFlowPayload : CreateMixTotalFlowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the pulse duration for Valve2.
+        /// Creates a timestamped message that the total flow of the mix, in ml/min. The carrier (channel 4) makes up what the odor channels do not deliver.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Valve2PulseDuration register.</returns>
+        /// <returns>A new timestamped message for the MixTotalFlow register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Valve2PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.MixTotalFlow.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the pulse duration for Valve3.
+    /// that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.
     /// </summary>
-    [DisplayName("Valve3PulseDurationPayload")]
-    [Description("Creates a message payload that sets the pulse duration for Valve3.")]
-    public partial class CreateValve3PulseDurationPayload
+    [DisplayName("MixConcentrationsPayload")]
+    [Description("Creates a message payload that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.")]
+    public partial class CreateMixConcentrationsPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the pulse duration for Valve3.
+        /// Gets or sets the value that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.
         /// </summary>
-        [Range(min: 1, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the pulse duration for Valve3.")]
-        public ushort Valve3PulseDuration { get; set; } = 1;
+        [Description("The value that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.")]
+        public float[] MixConcentrations { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Valve3PulseDuration register.
+        /// Creates a message payload for the MixConcentrations register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public float[] GetPayload()
         {
-            return Valve3PulseDuration;
+            return MixConcentrations;
         }
 
         /// <summary>
-        /// Creates a message that sets the pulse duration for Valve3.
+        /// Creates a message that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Valve3PulseDuration register.</returns>
+        /// <returns>A new message for the MixConcentrations register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.Valve3PulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.MixConcentrations.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the pulse duration for Valve3.
+    /// that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.
     /// </summary>
-    [DisplayName("TimestampedValve3PulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the pulse duration for Valve3.")]
-    public partial class CreateTimestampedValve3PulseDurationPayload : CreateValve3PulseDurationPayload
+    [DisplayName("TimestampedMixConcentrationsPayload")]
+    [Description("Creates a timestamped message payload that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.")]
+    public partial class CreateTimestampedMixConcentrationsPayload : CreateMixConcentrationsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the pulse duration for Valve3.
+        /// Creates a timestamped message that the fraction of the total flow delivered by each odor channel, from 0 to 1. Refused when a channel setpoint would be out of its range.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Valve3PulseDuration register.</returns>
+        /// <returns>A new timestamped message for the MixConcentrations register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.Valve3PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.MixConcentrations.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+    /// that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.
     /// </summary>
-    [DisplayName("CheckValve0DelayPulseDurationPayload")]
-    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.")]
-    public partial class CreateCheckValve0DelayPulseDurationPayload
+    [DisplayName("MixEnablePayload")]
+    [Description("Creates a message payload that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.")]
+    public partial class CreateMixEnablePayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+        /// Gets or sets the value that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.
         /// </summary>
-        [Range(min: 0, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.")]
-        public ushort CheckValve0DelayPulseDuration { get; set; } = 0;
+        [Description("The value that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.")]
+        public EnableFlag MixEnable { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CheckValve0DelayPulseDuration register.
+        /// Creates a message payload for the MixEnable register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public EnableFlag GetPayload()
         {
-            return CheckValve0DelayPulseDuration;
+            return MixEnable;
         }
 
         /// <summary>
-        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+        /// Creates a message that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CheckValve0DelayPulseDuration register.</returns>
+        /// <returns>A new message for the MixEnable register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve0DelayPulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.MixEnable.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+    /// that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.
     /// </summary>
-    [DisplayName("TimestampedCheckValve0DelayPulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.")]
-    public partial class CreateTimestampedCheckValve0DelayPulseDurationPayload : CreateCheckValve0DelayPulseDurationPayload
+    [DisplayName("TimestampedMixEnablePayload")]
+    [Description("Creates a timestamped message payload that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.")]
+    public partial class CreateTimestampedMixEnablePayload : CreateMixEnablePayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve0.
+        /// Creates a timestamped message that sets the setpoints of the five channels from MixTotalFlow and MixConcentrations, all in the same ms.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CheckValve0DelayPulseDuration register.</returns>
+        /// <returns>A new timestamped message for the MixEnable register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve0DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.MixEnable.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+    /// that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.
     /// </summary>
-    [DisplayName("CheckValve1DelayPulseDurationPayload")]
-    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.")]
-    public partial class CreateCheckValve1DelayPulseDurationPayload
+    [DisplayName("ProfilerControlPayload")]
+    [Description("Creates a message payload that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.")]
+    public partial class CreateProfilerControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+        /// Gets or sets a value to write on payload member Reset.
         /// </summary>
-        [Range(min: 0, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.")]
-        public ushort CheckValve1DelayPulseDuration { get; set; } = 0;
+        [Description("")]
+        public bool Reset { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CheckValve1DelayPulseDuration register.
+        /// Gets or sets a value to write on payload member Available.
+        /// </summary>
+        [Description("")]
+        public bool Available { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ProfilerControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ProfilerControlPayload GetPayload()
         {
-            return CheckValve1DelayPulseDuration;
+            ProfilerControlPayload value;
+            value.Reset = Reset;
+            value.Available = Available;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+        /// Creates a message that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CheckValve1DelayPulseDuration register.</returns>
+        /// <returns>A new message for the ProfilerControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve1DelayPulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ProfilerControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+    /// that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.
     /// </summary>
-    [DisplayName("TimestampedCheckValve1DelayPulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.")]
-    public partial class CreateTimestampedCheckValve1DelayPulseDurationPayload : CreateCheckValve1DelayPulseDurationPayload
+    [DisplayName("TimestampedProfilerControlPayload")]
+    [Description("Creates a timestamped message payload that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.")]
+    public partial class CreateTimestampedProfilerControlPayload : CreateProfilerControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve1.
+        /// Creates a timestamped message that resets the execution time profiler. Reads with the Available bit set when the firmware was built with the profiler.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CheckValve1DelayPulseDuration register.</returns>
+        /// <returns>A new timestamped message for the ProfilerControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve1DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ProfilerControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+    /// that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).
     /// </summary>
-    [DisplayName("CheckValve2DelayPulseDurationPayload")]
-    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.")]
-    public partial class CreateCheckValve2DelayPulseDurationPayload
+    [DisplayName("ProfilerSitePayload")]
+    [Description("Creates a message payload that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).")]
+    public partial class CreateProfilerSitePayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+        /// Gets or sets the value that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).
         /// </summary>
-        [Range(min: 0, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.")]
-        public ushort CheckValve2DelayPulseDuration { get; set; } = 0;
+        [Description("The value that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).")]
+        public byte ProfilerSite { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CheckValve2DelayPulseDuration register.
+        /// Creates a message payload for the ProfilerSite register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return CheckValve2DelayPulseDuration;
+            return ProfilerSite;
         }
 
         /// <summary>
-        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+        /// Creates a message that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CheckValve2DelayPulseDuration register.</returns>
+        /// <returns>A new message for the ProfilerSite register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve2DelayPulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ProfilerSite.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+    /// that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).
     /// </summary>
-    [DisplayName("TimestampedCheckValve2DelayPulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.")]
-    public partial class CreateTimestampedCheckValve2DelayPulseDurationPayload : CreateCheckValve2DelayPulseDurationPayload
+    [DisplayName("TimestampedProfilerSitePayload")]
+    [Description("Creates a timestamped message payload that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).")]
+    public partial class CreateTimestampedProfilerSitePayload : CreateProfilerSitePayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve2.
+        /// Creates a timestamped message that selects the site reported by ProfilerData (0 1 ms callback, 1 500 us callback, 2 closed loop, 3 temperature reading, 4 ADC interrupt, 5 MFC UART reception, 6 MFC UART transmission).
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CheckValve2DelayPulseDuration register.</returns>
+        /// <returns>A new timestamped message for the ProfilerSite register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve2DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ProfilerSite.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+    /// that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.
     /// </summary>
-    [DisplayName("CheckValve3DelayPulseDurationPayload")]
-    [Description("Creates a message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.")]
-    public partial class CreateCheckValve3DelayPulseDurationPayload
+    [DisplayName("ProfilerDataPayload")]
+    [Description("Creates a message payload that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.")]
+    public partial class CreateProfilerDataPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+        /// Gets or sets the value that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.
         /// </summary>
-        [Range(min: 0, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.")]
-        public ushort CheckValve3DelayPulseDuration { get; set; } = 0;
+        [Description("The value that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.")]
+        public ushort[] ProfilerData { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CheckValve3DelayPulseDuration register.
+        /// Creates a message payload for the ProfilerData register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return CheckValve3DelayPulseDuration;
+            return ProfilerData;
         }
 
         /// <summary>
-        /// Creates a message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+        /// Creates a message that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CheckValve3DelayPulseDuration register.</returns>
+        /// <returns>A new message for the ProfilerData register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve3DelayPulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.ProfilerData.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+    /// that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.
     /// </summary>
-    [DisplayName("TimestampedCheckValve3DelayPulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.")]
-    public partial class CreateTimestampedCheckValve3DelayPulseDurationPayload : CreateCheckValve3DelayPulseDurationPayload
+    [DisplayName("TimestampedProfilerDataPayload")]
+    [Description("Creates a timestamped message payload that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.")]
+    public partial class CreateTimestampedProfilerDataPayload : CreateProfilerDataPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the delay when CheckValvesConfig is Sync. Otherwise, sets the pulse duration for Check Valve3.
+        /// Creates a timestamped message that execution time of the selected site, in CPU cycles of 31.25 ns. Count, min, max and mean, followed by 8 bins of the durations below 256, 512, 1024, 2048, 4096, 8192, 16384 cycles and above.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CheckValve3DelayPulseDuration register.</returns>
+        /// <returns>A new timestamped message for the ProfilerData register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.CheckValve3DelayPulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.ProfilerData.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the pulse duration for EndValve0.
+    /// that updated each second.
     /// </summary>
-    [DisplayName("EndValve0PulseDurationPayload")]
-    [Description("Creates a message payload that sets the pulse duration for EndValve0.")]
-    public partial class CreateEndValve0PulseDurationPayload
+    [DisplayName("CpuLoadPayload")]
+    [Description("Creates a message payload that updated each second.")]
+    public partial class CreateCpuLoadPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the pulse duration for EndValve0.
+        /// Gets or sets a value to write on payload member Load.
         /// </summary>
-        [Range(min: 1, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the pulse duration for EndValve0.")]
-        public ushort EndValve0PulseDuration { get; set; } = 1;
+        [Description("The time spent in interrupts during the last second, in 0.1 %.")]
+        public ushort Load { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EndValve0PulseDuration register.
+        /// Gets or sets a value to write on payload member PeakLoad.
+        /// </summary>
+        [Description("The load of the busiest 1 ms slot of the last second, in 0.1 %.")]
+        public ushort PeakLoad { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member MissedTicks.
+        /// </summary>
+        [Description("The 1 ms ticks missed during the last second.")]
+        public ushort MissedTicks { get; set; }
+
+        /// <summary>
+        /// Gets or sets a value to write on payload member TotalMissedTicks.
+        /// </summary>
+        [Description("The 1 ms ticks missed since reset or the last clear, saturates at 65535.")]
+        public ushort TotalMissedTicks { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CpuLoad register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public CpuLoadPayload GetPayload()
         {
-            return EndValve0PulseDuration;
+            CpuLoadPayload value;
+            value.Load = Load;
+            value.PeakLoad = PeakLoad;
+            value.MissedTicks = MissedTicks;
+            value.TotalMissedTicks = TotalMissedTicks;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that sets the pulse duration for EndValve0.
+        /// Creates a message that updated each second.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EndValve0PulseDuration register.</returns>
+        /// <returns>A new message for the CpuLoad register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.EndValve0PulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CpuLoad.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the pulse duration for EndValve0.
+    /// that updated each second.
     /// </summary>
-    [DisplayName("TimestampedEndValve0PulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the pulse duration for EndValve0.")]
-    public partial class CreateTimestampedEndValve0PulseDurationPayload : CreateEndValve0PulseDurationPayload
+    [DisplayName("TimestampedCpuLoadPayload")]
+    [Description("Creates a timestamped message payload that updated each second.")]
+    public partial class CreateTimestampedCpuLoadPayload : CreateCpuLoadPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the pulse duration for EndValve0.
+        /// Creates a timestamped message that updated each second.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EndValve0PulseDuration register.</returns>
+        /// <returns>A new timestamped message for the CpuLoad register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.EndValve0PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CpuLoad.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that sets the pulse duration for EndValve1.
+    /// that configures the CPU load measurement.
     /// </summary>
-    [DisplayName("EndValve1PulseDurationPayload")]
-    [Description("Creates a message payload that sets the pulse duration for EndValve1.")]
-    public partial class CreateEndValve1PulseDurationPayload
+    [DisplayName("CpuLoadControlPayload")]
+    [Description("Creates a message payload that configures the CPU load measurement.")]
+    public partial class CreateCpuLoadControlPayload
     {
         /// <summary>
-        /// Gets or sets the value that sets the pulse duration for EndValve1.
+        /// Gets or sets a value to write on payload member Event.
         /// </summary>
-        [Range(min: 1, max: 65535)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that sets the pulse duration for EndValve1.")]
-        public ushort EndValve1PulseDuration { get; set; } = 1;
+        [Description("Sends CpuLoad each second.")]
+        public bool Event { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EndValve1PulseDuration register.
+        /// Gets or sets a value to write on payload member Clear.
+        /// </summary>
+        [Description("Clears the total of missed ticks.")]
+        public bool Clear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CpuLoadControl register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public CpuLoadControlPayload GetPayload()
         {
-            return EndValve1PulseDuration;
+            CpuLoadControlPayload value;
+            value.Event = Event;
+            value.Clear = Clear;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that sets the pulse duration for EndValve1.
+        /// Creates a message that configures the CPU load measurement.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EndValve1PulseDuration register.</returns>
+        /// <returns>A new message for the CpuLoadControl register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.EndValve1PulseDuration.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CpuLoadControl.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that sets the pulse duration for EndValve1.
+    /// that configures the CPU load measurement.
     /// </summary>
-    [DisplayName("TimestampedEndValve1PulseDurationPayload")]
-    [Description("Creates a timestamped message payload that sets the pulse duration for EndValve1.")]
-    public partial class CreateTimestampedEndValve1PulseDurationPayload : CreateEndValve1PulseDurationPayload
+    [DisplayName("TimestampedCpuLoadControlPayload")]
+    [Description("Creates a timestamped message payload that configures the CPU load measurement.")]
+    public partial class CreateTimestampedCpuLoadControlPayload : CreateCpuLoadControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that sets the pulse duration for EndValve1.
+        /// Creates a timestamped message that configures the CPU load measurement.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EndValve1PulseDuration register.</returns>
+        /// <returns>A new timestamped message for the CpuLoadControl register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.EndValve1PulseDuration.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CpuLoadControl.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital output 0 (DOUT0).
+    /// that selects the channel reported by LoopLatency.
     /// </summary>
-    [DisplayName("DO0SyncPayload")]
-    [Description("Creates a message payload that configuration of the digital output 0 (DOUT0).")]
-    public partial class CreateDO0SyncPayload
+    [DisplayName("LoopLatencyChannelPayload")]
+    [Description("Creates a message payload that selects the channel reported by LoopLatency.")]
+    public partial class CreateLoopLatencyChannelPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital output 0 (DOUT0).
+        /// Gets or sets the value that selects the channel reported by LoopLatency.
         /// </summary>
-        [Description("The value that configuration of the digital output 0 (DOUT0).")]
-        public DO0SyncConfig DO0Sync { get; set; }
+        [Description("The value that selects the channel reported by LoopLatency.")]
+        public byte LoopLatencyChannel { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO0Sync register.
+        /// Creates a message payload for the LoopLatencyChannel register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DO0SyncConfig GetPayload()
+        public byte GetPayload()
         {
-            return DO0Sync;
+            return LoopLatencyChannel;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital output 0 (DOUT0).
+        /// Creates a message that selects the channel reported by LoopLatency.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO0Sync register.</returns>
+        /// <returns>A new message for the LoopLatencyChannel register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DO0Sync.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.LoopLatencyChannel.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital output 0 (DOUT0).
+    /// that selects the channel reported by LoopLatency.
     /// </summary>
-    [DisplayName("TimestampedDO0SyncPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital output 0 (DOUT0).")]
-    public partial class CreateTimestampedDO0SyncPayload : CreateDO0SyncPayload
+    [DisplayName("TimestampedLoopLatencyChannelPayload")]
+    [Description("Creates a timestamped message payload that selects the channel reported by LoopLatency.")]
+    public partial class CreateTimestampedLoopLatencyChannelPayload : CreateLoopLatencyChannelPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital output 0 (DOUT0).
+        /// Creates a timestamped message that selects the channel reported by LoopLatency.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO0Sync register.</returns>
+        /// <returns>A new timestamped message for the LoopLatencyChannel register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DO0Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.LoopLatencyChannel.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital output 1 (DOUT1).
+    /// that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.
     /// </summary>
-    [DisplayName("DO1SyncPayload")]
-    [Description("Creates a message payload that configuration of the digital output 1 (DOUT1).")]
-    public partial class CreateDO1SyncPayload
+    [DisplayName("LoopLatencyPayload")]
+    [Description("Creates a message payload that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.")]
+    public partial class CreateLoopLatencyPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital output 1 (DOUT1).
+        /// Gets or sets the value that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.
         /// </summary>
-        [Description("The value that configuration of the digital output 1 (DOUT1).")]
-        public DO1SyncConfig DO1Sync { get; set; }
+        [Description("The value that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.")]
+        public ushort[] LoopLatency { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DO1Sync register.
+        /// Creates a message payload for the LoopLatency register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DO1SyncConfig GetPayload()
+        public ushort[] GetPayload()
         {
-            return DO1Sync;
+            return LoopLatency;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital output 1 (DOUT1).
+        /// Creates a message that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DO1Sync register.</returns>
+        /// <returns>A new message for the LoopLatency register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DO1Sync.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.LoopLatency.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital output 1 (DOUT1).
+    /// that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.
     /// </summary>
-    [DisplayName("TimestampedDO1SyncPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital output 1 (DOUT1).")]
-    public partial class CreateTimestampedDO1SyncPayload : CreateDO1SyncPayload
+    [DisplayName("TimestampedLoopLatencyPayload")]
+    [Description("Creates a timestamped message payload that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.")]
+    public partial class CreateTimestampedLoopLatencyPayload : CreateLoopLatencyPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital output 1 (DOUT1).
+        /// Creates a timestamped message that time from the start of the ADC conversion used by the control loop to the duty cycle update of the selected channel. Min and max in us, followed by 32 bins of 128 us, the last one counting the longer times.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DO1Sync register.</returns>
+        /// <returns>A new timestamped message for the LoopLatency register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DO1Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.LoopLatency.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configuration of the digital input pin 0 (DIN0).
+    /// that clears the latency of the selected channels.
     /// </summary>
-    [DisplayName("DI0TriggerPayload")]
-    [Description("Creates a message payload that configuration of the digital input pin 0 (DIN0).")]
-    public partial class CreateDI0TriggerPayload
+    [DisplayName("LoopLatencyResetPayload")]
+    [Description("Creates a message payload that clears the latency of the selected channels.")]
+    public partial class CreateLoopLatencyResetPayload
     {
         /// <summary>
-        /// Gets or sets the value that configuration of the digital input pin 0 (DIN0).
+        /// Gets or sets the value that clears the latency of the selected channels.
         /// </summary>
-        [Description("The value that configuration of the digital input pin 0 (DIN0).")]
-        public DI0TriggerConfig DI0Trigger { get; set; }
+        [Description("The value that clears the latency of the selected channels.")]
+        public FlowChannels LoopLatencyReset { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DI0Trigger register.
+        /// Creates a message payload for the LoopLatencyReset register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DI0TriggerConfig GetPayload()
+        public FlowChannels GetPayload()
         {
-            return DI0Trigger;
+            return LoopLatencyReset;
         }
 
         /// <summary>
-        /// Creates a message that configuration of the digital input pin 0 (DIN0).
+        /// Creates a message that clears the latency of the selected channels.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0Trigger register.</returns>
+        /// <returns>A new message for the LoopLatencyReset register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.DI0Trigger.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.LoopLatencyReset.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configuration of the digital input pin 0 (DIN0).
+    /// that clears the latency of the selected channels.
     /// </summary>
-    [DisplayName("TimestampedDI0TriggerPayload")]
-    [Description("Creates a timestamped message payload that configuration of the digital input pin 0 (DIN0).")]
-    public partial class CreateTimestampedDI0TriggerPayload : CreateDI0TriggerPayload
+    [DisplayName("TimestampedLoopLatencyResetPayload")]
+    [Description("Creates a timestamped message payload that clears the latency of the selected channels.")]
+    public partial class CreateTimestampedLoopLatencyResetPayload : CreateLoopLatencyResetPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configuration of the digital input pin 0 (DIN0).
+        /// Creates a timestamped message that clears the latency of the selected channels.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0Trigger register.</returns>
+        /// <returns>A new timestamped message for the LoopLatencyReset register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.DI0Trigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.LoopLatencyReset.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that mimic Valve0.
+    /// that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.
     /// </summary>
-    [DisplayName("MimicValve0Payload")]
-    [Description("Creates a message payload that mimic Valve0.")]
-    public partial class CreateMimicValve0Payload
+    [DisplayName("SequenceSettleTimeoutPayload")]
+    [Description("Creates a message payload that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.")]
+    public partial class CreateSequenceSettleTimeoutPayload
     {
         /// <summary>
-        /// Gets or sets the value that mimic Valve0.
+        /// Gets or sets the value that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.
         /// </summary>
-        [Description("The value that mimic Valve0.")]
-        public MimicOutputs MimicValve0 { get; set; }
+        [Range(min: 1, max: 65535)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.")]
+        public ushort SequenceSettleTimeout { get; set; } = 1;
 
         /// <summary>
-        /// Creates a message payload for the MimicValve0 register.
+        /// Creates a message payload for the SequenceSettleTimeout register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
+        public ushort GetPayload()
         {
-            return MimicValve0;
+            return SequenceSettleTimeout;
         }
 
         /// <summary>
-        /// Creates a message that mimic Valve0.
+        /// Creates a message that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicValve0 register.</returns>
+        /// <returns>A new message for the SequenceSettleTimeout register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.MimicValve0.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.SequenceSettleTimeout.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that mimic Valve0.
+    /// that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.
     /// </summary>
-    [DisplayName("TimestampedMimicValve0Payload")]
-    [Description("Creates a timestamped message payload that mimic Valve0.")]
-    public partial class CreateTimestampedMimicValve0Payload : CreateMimicValve0Payload
+    [DisplayName("TimestampedSequenceSettleTimeoutPayload")]
+    [Description("Creates a timestamped message payload that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.")]
+    public partial class CreateTimestampedSequenceSettleTimeoutPayload : CreateSequenceSettleTimeoutPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Valve0.
+        /// Creates a timestamped message that longest time, in ms, a sequence step waits for its channels to settle before the sequence is aborted.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicValve0 register.</returns>
+        /// <returns>A new timestamped message for the SequenceSettleTimeout register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.MimicValve0.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.SequenceSettleTimeout.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that mimic Valve1.
+    /// that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.
     /// </summary>
-    [DisplayName("MimicValve1Payload")]
-    [Description("Creates a message payload that mimic Valve1.")]
-    public partial class CreateMimicValve1Payload
+    [DisplayName("CalibrationSourcePayload")]
+    [Description("Creates a message payload that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.")]
+    public partial class CreateCalibrationSourcePayload
     {
         /// <summary>
-        /// Gets or sets the value that mimic Valve1.
+        /// Gets or sets a value to write on payload member Source.
         /// </summary>
-        [Description("The value that mimic Valve1.")]
-        public MimicOutputs MimicValve1 { get; set; }
+        [Description("")]
+        public FactoryCalibrationSource Source { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the MimicValve1 register.
+        /// Gets or sets a value to write on payload member RecordDamaged.
+        /// </summary>
+        [Description("")]
+        public bool RecordDamaged { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CalibrationSource register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
+        public CalibrationSourcePayload GetPayload()
         {
-            return MimicValve1;
+            CalibrationSourcePayload value;
+            value.Source = Source;
+            value.RecordDamaged = RecordDamaged;
+            return value;
         }
 
         /// <summary>
-        /// Creates a message that mimic Valve1.
+        /// Creates a message that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicValve1 register.</returns>
+        /// <returns>A new message for the CalibrationSource register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.Olfactometer.MimicValve1.FromPayload(messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSource.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that mimic Valve1.
+    /// that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.
     /// </summary>
-    [DisplayName("TimestampedMimicValve1Payload")]
-    [Description("Creates a timestamped message payload that mimic Valve1.")]
-    public partial class CreateTimestampedMimicValve1Payload : CreateMimicValve1Payload
+    [DisplayName("TimestampedCalibrationSourcePayload")]
+    [Description("Creates a timestamped message payload that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.")]
+    public partial class CreateTimestampedCalibrationSourcePayload : CreateCalibrationSourcePayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Valve1.
+        /// Creates a timestamped message that where the factory calibration in use was read from. RecordDamaged is set when the EEPROM record failed its check and the legacy rows or the built-in tables are used instead.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicValve1 register.</returns>
+        /// <returns>A new timestamped message for the CalibrationSource register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.Olfactometer.MimicValve1.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.Olfactometer.CalibrationSource.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic Valve2.
+    /// Represents the payload of the Flowmeter register.
     /// </summary>
-    [DisplayName("MimicValve2Payload")]
-    [Description("Creates a message payload that mimic Valve2.")]
-    public partial class CreateMimicValve2Payload
+    public struct FlowmeterPayload
     {
         /// <summary>
-        /// Gets or sets the value that mimic Valve2.
+        /// Initializes a new instance of the <see cref="FlowmeterPayload"/> structure.
         /// </summary>
-        [Description("The value that mimic Valve2.")]
-        public MimicOutputs MimicValve2 { get; set; }
+        /// <param name="channel0"></param>
+        /// <param name="channel1"></param>
+        /// <param name="channel2"></param>
+        /// <param name="channel3"></param>
+        /// <param name="channel4"></param>
+        public FlowmeterPayload(
+            short channel0,
+            short channel1,
+            short channel2,
+            short channel3,
+            short channel4)
+        {
+            Channel0 = channel0;
+            Channel1 = channel1;
+            Channel2 = channel2;
+            Channel3 = channel3;
+            Channel4 = channel4;
+        }
 
         /// <summary>
-        /// Creates a message payload for the MimicValve2 register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicValve2;
-        }
+        public short Channel0;
 
         /// <summary>
-        /// Creates a message that mimic Valve2.
+        /// 
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicValve2 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public short Channel1;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel2;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel3;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public short Channel4;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the Flowmeter register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// Flowmeter register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicValve2.FromPayload(messageType, GetPayload());
+            return "FlowmeterPayload { " +
+                "Channel0 = " + Channel0 + ", " +
+                "Channel1 = " + Channel1 + ", " +
+                "Channel2 = " + Channel2 + ", " +
+                "Channel3 = " + Channel3 + ", " +
+                "Channel4 = " + Channel4 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic Valve2.
+    /// Represents the payload of the ChannelsTargetFlow register.
     /// </summary>
-    [DisplayName("TimestampedMimicValve2Payload")]
-    [Description("Creates a timestamped message payload that mimic Valve2.")]
-    public partial class CreateTimestampedMimicValve2Payload : CreateMimicValve2Payload
+    public struct ChannelsTargetFlowPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Valve2.
+        /// Initializes a new instance of the <see cref="ChannelsTargetFlowPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicValve2 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="channel0"></param>
+        /// <param name="channel1"></param>
+        /// <param name="channel2"></param>
+        /// <param name="channel3"></param>
+        /// <param name="channel4"></param>
+        public ChannelsTargetFlowPayload(
+            float channel0,
+            float channel1,
+            float channel2,
+            float channel3,
+            float channel4)
         {
-            return Harp.Olfactometer.MimicValve2.FromPayload(timestamp, messageType, GetPayload());
+            Channel0 = channel0;
+            Channel1 = channel1;
+            Channel2 = channel2;
+            Channel3 = channel3;
+            Channel4 = channel4;
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public float Channel0;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public float Channel1;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public float Channel2;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public float Channel3;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public float Channel4;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ChannelsTargetFlow register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ChannelsTargetFlow register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "ChannelsTargetFlowPayload { " +
+                "Channel0 = " + Channel0 + ", " +
+                "Channel1 = " + Channel1 + ", " +
+                "Channel2 = " + Channel2 + ", " +
+                "Channel3 = " + Channel3 + ", " +
+                "Channel4 = " + Channel4 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic Valve3.
+    /// Represents the payload of the ValvesEvent register.
     /// </summary>
-    [DisplayName("MimicValve3Payload")]
-    [Description("Creates a message payload that mimic Valve3.")]
-    public partial class CreateMimicValve3Payload
+    public struct ValvesEventPayload
     {
         /// <summary>
-        /// Gets or sets the value that mimic Valve3.
+        /// Initializes a new instance of the <see cref="ValvesEventPayload"/> structure.
         /// </summary>
-        [Description("The value that mimic Valve3.")]
-        public MimicOutputs MimicValve3 { get; set; }
+        /// <param name="changed">The valves that changed state.</param>
+        /// <param name="state">The state of all valves after the transition.</param>
+        public ValvesEventPayload(
+            Valves changed,
+            Valves state)
+        {
+            Changed = changed;
+            State = state;
+        }
 
         /// <summary>
-        /// Creates a message payload for the MimicValve3 register.
+        /// The valves that changed state.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicValve3;
-        }
+        public Valves Changed;
 
         /// <summary>
-        /// Creates a message that mimic Valve3.
+        /// The state of all valves after the transition.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicValve3 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public Valves State;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ValvesEvent register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ValvesEvent register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicValve3.FromPayload(messageType, GetPayload());
+            return "ValvesEventPayload { " +
+                "Changed = " + Changed + ", " +
+                "State = " + State + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic Valve3.
+    /// Represents the payload of the Valve0Train register.
     /// </summary>
-    [DisplayName("TimestampedMimicValve3Payload")]
-    [Description("Creates a timestamped message payload that mimic Valve3.")]
-    public partial class CreateTimestampedMimicValve3Payload : CreateMimicValve3Payload
+    public struct Valve0TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Valve3.
+        /// Initializes a new instance of the <see cref="Valve0TrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicValve3 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public Valve0TrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicValve3.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic Check Valve0.
-    /// </summary>
-    [DisplayName("MimicCheckValve0Payload")]
-    [Description("Creates a message payload that mimic Check Valve0.")]
-    public partial class CreateMimicCheckValve0Payload
-    {
         /// <summary>
-        /// Gets or sets the value that mimic Check Valve0.
+        /// Delay before the first pulse, in ms.
         /// </summary>
-        [Description("The value that mimic Check Valve0.")]
-        public MimicOutputs MimicCheckValve0 { get; set; }
+        public ushort Delay;
 
         /// <summary>
-        /// Creates a message payload for the MimicCheckValve0 register.
+        /// Time the valve is open on each pulse, in ms.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicCheckValve0;
-        }
+        public ushort OnTime;
 
         /// <summary>
-        /// Creates a message that mimic Check Valve0.
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicCheckValve0 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort OffTime;
+
+        /// <summary>
+        /// Number of pulses. Zero repeats until the train is stopped.
+        /// </summary>
+        public ushort Count;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the Valve0Train register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// Valve0Train register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicCheckValve0.FromPayload(messageType, GetPayload());
+            return "Valve0TrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic Check Valve0.
+    /// Represents the payload of the Valve1Train register.
     /// </summary>
-    [DisplayName("TimestampedMimicCheckValve0Payload")]
-    [Description("Creates a timestamped message payload that mimic Check Valve0.")]
-    public partial class CreateTimestampedMimicCheckValve0Payload : CreateMimicCheckValve0Payload
+    public struct Valve1TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Check Valve0.
+        /// Initializes a new instance of the <see cref="Valve1TrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicCheckValve0 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public Valve1TrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicCheckValve0.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic Check Valve1.
-    /// </summary>
-    [DisplayName("MimicCheckValve1Payload")]
-    [Description("Creates a message payload that mimic Check Valve1.")]
-    public partial class CreateMimicCheckValve1Payload
-    {
         /// <summary>
-        /// Gets or sets the value that mimic Check Valve1.
+        /// Delay before the first pulse, in ms.
         /// </summary>
-        [Description("The value that mimic Check Valve1.")]
-        public MimicOutputs MimicCheckValve1 { get; set; }
+        public ushort Delay;
 
         /// <summary>
-        /// Creates a message payload for the MimicCheckValve1 register.
+        /// Time the valve is open on each pulse, in ms.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicCheckValve1;
-        }
+        public ushort OnTime;
 
         /// <summary>
-        /// Creates a message that mimic Check Valve1.
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicCheckValve1 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort OffTime;
+
+        /// <summary>
+        /// Number of pulses. Zero repeats until the train is stopped.
+        /// </summary>
+        public ushort Count;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the Valve1Train register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// Valve1Train register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicCheckValve1.FromPayload(messageType, GetPayload());
+            return "Valve1TrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic Check Valve1.
+    /// Represents the payload of the Valve2Train register.
     /// </summary>
-    [DisplayName("TimestampedMimicCheckValve1Payload")]
-    [Description("Creates a timestamped message payload that mimic Check Valve1.")]
-    public partial class CreateTimestampedMimicCheckValve1Payload : CreateMimicCheckValve1Payload
+    public struct Valve2TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Check Valve1.
+        /// Initializes a new instance of the <see cref="Valve2TrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicCheckValve1 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public Valve2TrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicCheckValve1.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic Check Valve2.
-    /// </summary>
-    [DisplayName("MimicCheckValve2Payload")]
-    [Description("Creates a message payload that mimic Check Valve2.")]
-    public partial class CreateMimicCheckValve2Payload
-    {
         /// <summary>
-        /// Gets or sets the value that mimic Check Valve2.
+        /// Delay before the first pulse, in ms.
         /// </summary>
-        [Description("The value that mimic Check Valve2.")]
-        public MimicOutputs MimicCheckValve2 { get; set; }
+        public ushort Delay;
 
         /// <summary>
-        /// Creates a message payload for the MimicCheckValve2 register.
+        /// Time the valve is open on each pulse, in ms.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicCheckValve2;
-        }
+        public ushort OnTime;
 
         /// <summary>
-        /// Creates a message that mimic Check Valve2.
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicCheckValve2 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort OffTime;
+
+        /// <summary>
+        /// Number of pulses. Zero repeats until the train is stopped.
+        /// </summary>
+        public ushort Count;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the Valve2Train register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// Valve2Train register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicCheckValve2.FromPayload(messageType, GetPayload());
+            return "Valve2TrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic Check Valve2.
+    /// Represents the payload of the Valve3Train register.
     /// </summary>
-    [DisplayName("TimestampedMimicCheckValve2Payload")]
-    [Description("Creates a timestamped message payload that mimic Check Valve2.")]
-    public partial class CreateTimestampedMimicCheckValve2Payload : CreateMimicCheckValve2Payload
+    public struct Valve3TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Check Valve2.
+        /// Initializes a new instance of the <see cref="Valve3TrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicCheckValve2 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public Valve3TrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicCheckValve2.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic Check Valve3.
-    /// </summary>
-    [DisplayName("MimicCheckValve3Payload")]
-    [Description("Creates a message payload that mimic Check Valve3.")]
-    public partial class CreateMimicCheckValve3Payload
-    {
         /// <summary>
-        /// Gets or sets the value that mimic Check Valve3.
+        /// Delay before the first pulse, in ms.
         /// </summary>
-        [Description("The value that mimic Check Valve3.")]
-        public MimicOutputs MimicCheckValve3 { get; set; }
+        public ushort Delay;
 
         /// <summary>
-        /// Creates a message payload for the MimicCheckValve3 register.
+        /// Time the valve is open on each pulse, in ms.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicCheckValve3;
-        }
+        public ushort OnTime;
 
         /// <summary>
-        /// Creates a message that mimic Check Valve3.
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicCheckValve3 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort OffTime;
+
+        /// <summary>
+        /// Number of pulses. Zero repeats until the train is stopped.
+        /// </summary>
+        public ushort Count;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the Valve3Train register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// Valve3Train register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicCheckValve3.FromPayload(messageType, GetPayload());
+            return "Valve3TrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic Check Valve3.
+    /// Represents the payload of the EndValve0Train register.
     /// </summary>
-    [DisplayName("TimestampedMimicCheckValve3Payload")]
-    [Description("Creates a timestamped message payload that mimic Check Valve3.")]
-    public partial class CreateTimestampedMimicCheckValve3Payload : CreateMimicCheckValve3Payload
+    public struct EndValve0TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic Check Valve3.
+        /// Initializes a new instance of the <see cref="EndValve0TrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicCheckValve3 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public EndValve0TrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicCheckValve3.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic EndValve0.
-    /// </summary>
-    [DisplayName("MimicEndValve0Payload")]
-    [Description("Creates a message payload that mimic EndValve0.")]
-    public partial class CreateMimicEndValve0Payload
-    {
         /// <summary>
-        /// Gets or sets the value that mimic EndValve0.
+        /// Delay before the first pulse, in ms.
         /// </summary>
-        [Description("The value that mimic EndValve0.")]
-        public MimicOutputs MimicEndValve0 { get; set; }
+        public ushort Delay;
 
         /// <summary>
-        /// Creates a message payload for the MimicEndValve0 register.
+        /// Time the valve is open on each pulse, in ms.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicEndValve0;
-        }
+        public ushort OnTime;
 
         /// <summary>
-        /// Creates a message that mimic EndValve0.
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicEndValve0 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort OffTime;
+
+        /// <summary>
+        /// Number of pulses. Zero repeats until the train is stopped.
+        /// </summary>
+        public ushort Count;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the EndValve0Train register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// EndValve0Train register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicEndValve0.FromPayload(messageType, GetPayload());
+            return "EndValve0TrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic EndValve0.
+    /// Represents the payload of the EndValve1Train register.
     /// </summary>
-    [DisplayName("TimestampedMimicEndValve0Payload")]
-    [Description("Creates a timestamped message payload that mimic EndValve0.")]
-    public partial class CreateTimestampedMimicEndValve0Payload : CreateMimicEndValve0Payload
+    public struct EndValve1TrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic EndValve0.
+        /// Initializes a new instance of the <see cref="EndValve1TrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicEndValve0 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public EndValve1TrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicEndValve0.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that mimic EndValve1.
-    /// </summary>
-    [DisplayName("MimicEndValve1Payload")]
-    [Description("Creates a message payload that mimic EndValve1.")]
-    public partial class CreateMimicEndValve1Payload
-    {
         /// <summary>
-        /// Gets or sets the value that mimic EndValve1.
+        /// Delay before the first pulse, in ms.
+        /// </summary>
+        public ushort Delay;
+
+        /// <summary>
+        /// Time the valve is open on each pulse, in ms.
+        /// </summary>
+        public ushort OnTime;
+
+        /// <summary>
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        [Description("The value that mimic EndValve1.")]
-        public MimicOutputs MimicEndValve1 { get; set; }
+        public ushort OffTime;
 
         /// <summary>
-        /// Creates a message payload for the MimicEndValve1 register.
+        /// Number of pulses. Zero repeats until the train is stopped.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public MimicOutputs GetPayload()
-        {
-            return MimicEndValve1;
-        }
+        public ushort Count;
 
         /// <summary>
-        /// Creates a message that mimic EndValve1.
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the EndValve1Train register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the MimicEndValve1 register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// EndValve1Train register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.MimicEndValve1.FromPayload(messageType, GetPayload());
+            return "EndValve1TrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that mimic EndValve1.
+    /// Represents the payload of the DummyValveTrain register.
     /// </summary>
-    [DisplayName("TimestampedMimicEndValve1Payload")]
-    [Description("Creates a timestamped message payload that mimic EndValve1.")]
-    public partial class CreateTimestampedMimicEndValve1Payload : CreateMimicEndValve1Payload
+    public struct DummyValveTrainPayload
     {
         /// <summary>
-        /// Creates a timestamped message that mimic EndValve1.
+        /// Initializes a new instance of the <see cref="DummyValveTrainPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the MimicEndValve1 register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="delay">Delay before the first pulse, in ms.</param>
+        /// <param name="onTime">Time the valve is open on each pulse, in ms.</param>
+        /// <param name="offTime">Time the valve is closed between pulses, in ms.</param>
+        /// <param name="count">Number of pulses. Zero repeats until the train is stopped.</param>
+        public DummyValveTrainPayload(
+            ushort delay,
+            ushort onTime,
+            ushort offTime,
+            ushort count)
         {
-            return Harp.Olfactometer.MimicEndValve1.FromPayload(timestamp, messageType, GetPayload());
+            Delay = delay;
+            OnTime = onTime;
+            OffTime = offTime;
+            Count = count;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that enable the valves control via low-level IO screw terminals.
-    /// </summary>
-    [DisplayName("EnableValveExternalControlPayload")]
-    [Description("Creates a message payload that enable the valves control via low-level IO screw terminals.")]
-    public partial class CreateEnableValveExternalControlPayload
-    {
         /// <summary>
-        /// Gets or sets the value that enable the valves control via low-level IO screw terminals.
+        /// Delay before the first pulse, in ms.
         /// </summary>
-        [Description("The value that enable the valves control via low-level IO screw terminals.")]
-        public EnableFlag EnableValveExternalControl { get; set; }
+        public ushort Delay;
 
         /// <summary>
-        /// Creates a message payload for the EnableValveExternalControl register.
+        /// Time the valve is open on each pulse, in ms.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
-        {
-            return EnableValveExternalControl;
-        }
+        public ushort OnTime;
 
         /// <summary>
-        /// Creates a message that enable the valves control via low-level IO screw terminals.
+        /// Time the valve is closed between pulses, in ms.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableValveExternalControl register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort OffTime;
+
+        /// <summary>
+        /// Number of pulses. Zero repeats until the train is stopped.
+        /// </summary>
+        public ushort Count;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the DummyValveTrain register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// DummyValveTrain register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.EnableValveExternalControl.FromPayload(messageType, GetPayload());
+            return "DummyValveTrainPayload { " +
+                "Delay = " + Delay + ", " +
+                "OnTime = " + OnTime + ", " +
+                "OffTime = " + OffTime + ", " +
+                "Count = " + Count + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that enable the valves control via low-level IO screw terminals.
+    /// Represents the payload of the SequenceStep register.
     /// </summary>
-    [DisplayName("TimestampedEnableValveExternalControlPayload")]
-    [Description("Creates a timestamped message payload that enable the valves control via low-level IO screw terminals.")]
-    public partial class CreateTimestampedEnableValveExternalControlPayload : CreateEnableValveExternalControlPayload
+    public struct SequenceStepPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enable the valves control via low-level IO screw terminals.
+        /// Initializes a new instance of the <see cref="SequenceStepPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableValveExternalControl register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="time">Time of the step from the sequence start, in ms. It cannot be earlier than the time of the previous step.</param>
+        /// <param name="valves">State of the valves.</param>
+        /// <param name="digitalOutputs">State of the digital outputs.</param>
+        /// <param name="settle">Channels that must be settled before the step is applied. The sequence cannot be armed or started while a step selects a channel it gives no flow.</param>
+        public SequenceStepPayload(
+            ushort time,
+            Valves valves,
+            DigitalOutputs digitalOutputs,
+            FlowChannels settle)
         {
-            return Harp.Olfactometer.EnableValveExternalControl.FromPayload(timestamp, messageType, GetPayload());
+            Time = time;
+            Valves = valves;
+            DigitalOutputs = digitalOutputs;
+            Settle = settle;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that selects the flow range for the channel 3.
-    /// </summary>
-    [DisplayName("Channel3RangePayload")]
-    [Description("Creates a message payload that selects the flow range for the channel 3.")]
-    public partial class CreateChannel3RangePayload
-    {
         /// <summary>
-        /// Gets or sets the value that selects the flow range for the channel 3.
+        /// Time of the step from the sequence start, in ms. It cannot be earlier than the time of the previous step.
         /// </summary>
-        [Description("The value that selects the flow range for the channel 3.")]
-        public Channel3RangeConfig Channel3Range { get; set; }
+        public ushort Time;
 
         /// <summary>
-        /// Creates a message payload for the Channel3Range register.
+        /// State of the valves.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public Channel3RangeConfig GetPayload()
-        {
-            return Channel3Range;
-        }
+        public Valves Valves;
 
         /// <summary>
-        /// Creates a message that selects the flow range for the channel 3.
+        /// State of the digital outputs.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Channel3Range register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public DigitalOutputs DigitalOutputs;
+
+        /// <summary>
+        /// Channels that must be settled before the step is applied. The sequence cannot be armed or started while a step selects a channel it gives no flow.
+        /// </summary>
+        public FlowChannels Settle;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the SequenceStep register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// SequenceStep register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.Channel3Range.FromPayload(messageType, GetPayload());
+            return "SequenceStepPayload { " +
+                "Time = " + Time + ", " +
+                "Valves = " + Valves + ", " +
+                "DigitalOutputs = " + DigitalOutputs + ", " +
+                "Settle = " + Settle + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that selects the flow range for the channel 3.
+    /// Represents the payload of the CalibrationProfile register.
     /// </summary>
-    [DisplayName("TimestampedChannel3RangePayload")]
-    [Description("Creates a timestamped message payload that selects the flow range for the channel 3.")]
-    public partial class CreateTimestampedChannel3RangePayload : CreateChannel3RangePayload
+    public struct CalibrationProfilePayload
     {
         /// <summary>
-        /// Creates a timestamped message that selects the flow range for the channel 3.
+        /// Initializes a new instance of the <see cref="CalibrationProfilePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Channel3Range register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="channel0"></param>
+        /// <param name="channel1"></param>
+        /// <param name="channel2"></param>
+        /// <param name="channel3"></param>
+        /// <param name="channel4"></param>
+        public CalibrationProfilePayload(
+            byte channel0,
+            byte channel1,
+            byte channel2,
+            byte channel3,
+            byte channel4)
         {
-            return Harp.Olfactometer.Channel3Range.FromPayload(timestamp, messageType, GetPayload());
+            Channel0 = channel0;
+            Channel1 = channel1;
+            Channel2 = channel2;
+            Channel3 = channel3;
+            Channel4 = channel4;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that enable the check valve to sync with the respective odor valve.
-    /// </summary>
-    [DisplayName("EnableCheckValveSyncPayload")]
-    [Description("Creates a message payload that enable the check valve to sync with the respective odor valve.")]
-    public partial class CreateEnableCheckValveSyncPayload
-    {
         /// <summary>
-        /// Gets or sets the value that enable the check valve to sync with the respective odor valve.
+        /// 
         /// </summary>
-        [Description("The value that enable the check valve to sync with the respective odor valve.")]
-        public CheckValves EnableCheckValveSync { get; set; }
+        public byte Channel0;
 
         /// <summary>
-        /// Creates a message payload for the EnableCheckValveSync register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public CheckValves GetPayload()
-        {
-            return EnableCheckValveSync;
-        }
+        public byte Channel1;
 
         /// <summary>
-        /// Creates a message that enable the check valve to sync with the respective odor valve.
+        /// 
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableCheckValveSync register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public byte Channel2;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public byte Channel3;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public byte Channel4;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the CalibrationProfile register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// CalibrationProfile register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.EnableCheckValveSync.FromPayload(messageType, GetPayload());
+            return "CalibrationProfilePayload { " +
+                "Channel0 = " + Channel0 + ", " +
+                "Channel1 = " + Channel1 + ", " +
+                "Channel2 = " + Channel2 + ", " +
+                "Channel3 = " + Channel3 + ", " +
+                "Channel4 = " + Channel4 + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that enable the check valve to sync with the respective odor valve.
+    /// Represents the payload of the CalibrationProfileSave register.
     /// </summary>
-    [DisplayName("TimestampedEnableCheckValveSyncPayload")]
-    [Description("Creates a timestamped message payload that enable the check valve to sync with the respective odor valve.")]
-    public partial class CreateTimestampedEnableCheckValveSyncPayload : CreateEnableCheckValveSyncPayload
+    public struct CalibrationProfileSavePayload
     {
         /// <summary>
-        /// Creates a timestamped message that enable the check valve to sync with the respective odor valve.
+        /// Initializes a new instance of the <see cref="CalibrationProfileSavePayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableCheckValveSync register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="channel"></param>
+        /// <param name="profile"></param>
+        public CalibrationProfileSavePayload(
+            byte channel,
+            byte profile)
         {
-            return Harp.Olfactometer.EnableCheckValveSync.FromPayload(timestamp, messageType, GetPayload());
+            Channel = channel;
+            Profile = profile;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that temperature sensor reading value.
-    /// </summary>
-    [DisplayName("TemperatureValuePayload")]
-    [Description("Creates a message payload that temperature sensor reading value.")]
-    public partial class CreateTemperatureValuePayload
-    {
         /// <summary>
-        /// Gets or sets the value that temperature sensor reading value.
+        /// 
         /// </summary>
-        [Description("The value that temperature sensor reading value.")]
-        public byte TemperatureValue { get; set; }
+        public byte Channel;
 
         /// <summary>
-        /// Creates a message payload for the TemperatureValue register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
-        {
-            return TemperatureValue;
-        }
+        public byte Profile;
 
         /// <summary>
-        /// Creates a message that temperature sensor reading value.
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the CalibrationProfileSave register.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TemperatureValue register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// CalibrationProfileSave register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.TemperatureValue.FromPayload(messageType, GetPayload());
+            return "CalibrationProfileSavePayload { " +
+                "Channel = " + Channel + ", " +
+                "Profile = " + Profile + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that temperature sensor reading value.
+    /// Represents the payload of the CalibrationSweep register.
     /// </summary>
-    [DisplayName("TimestampedTemperatureValuePayload")]
-    [Description("Creates a timestamped message payload that temperature sensor reading value.")]
-    public partial class CreateTimestampedTemperatureValuePayload : CreateTemperatureValuePayload
+    public struct CalibrationSweepPayload
     {
         /// <summary>
-        /// Creates a timestamped message that temperature sensor reading value.
+        /// Initializes a new instance of the <see cref="CalibrationSweepPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TemperatureValue register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="channel"></param>
+        /// <param name="run"></param>
+        public CalibrationSweepPayload(
+            byte channel,
+            bool run)
         {
-            return Harp.Olfactometer.TemperatureValue.FromPayload(timestamp, messageType, GetPayload());
+            Channel = channel;
+            Run = run;
         }
-    }
-
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that enable flow adjustment based on the temperature calibration.
-    /// </summary>
-    [DisplayName("EnableTemperatureCalibrationPayload")]
-    [Description("Creates a message payload that enable flow adjustment based on the temperature calibration.")]
-    public partial class CreateEnableTemperatureCalibrationPayload
-    {
-        /// <summary>
-        /// Gets or sets the value that enable flow adjustment based on the temperature calibration.
-        /// </summary>
-        [Description("The value that enable flow adjustment based on the temperature calibration.")]
-        public EnableFlag EnableTemperatureCalibration { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableTemperatureCalibration register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public EnableFlag GetPayload()
-        {
-            return EnableTemperatureCalibration;
-        }
+        public byte Channel;
 
         /// <summary>
-        /// Creates a message that enable flow adjustment based on the temperature calibration.
+        /// 
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableTemperatureCalibration register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public bool Run;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the CalibrationSweep register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// CalibrationSweep register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.EnableTemperatureCalibration.FromPayload(messageType, GetPayload());
+            return "CalibrationSweepPayload { " +
+                "Channel = " + Channel + ", " +
+                "Run = " + Run + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that enable flow adjustment based on the temperature calibration.
+    /// Represents the payload of the CalibrationSweepConfig register.
     /// </summary>
-    [DisplayName("TimestampedEnableTemperatureCalibrationPayload")]
-    [Description("Creates a timestamped message payload that enable flow adjustment based on the temperature calibration.")]
-    public partial class CreateTimestampedEnableTemperatureCalibrationPayload : CreateEnableTemperatureCalibrationPayload
+    public struct CalibrationSweepConfigPayload
     {
         /// <summary>
-        /// Creates a timestamped message that enable flow adjustment based on the temperature calibration.
+        /// Initializes a new instance of the <see cref="CalibrationSweepConfigPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableTemperatureCalibration register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="firstDutyCycle">The first duty cycle of the sweep, in 0.1 %.</param>
+        /// <param name="lastDutyCycle">The last duty cycle of the sweep, in 0.1 %.</param>
+        /// <param name="steps">The number of duty cycles measured, from 2 to 255.</param>
+        /// <param name="settleTime">The time to wait after each duty cycle change, in ms.</param>
+        /// <param name="averageTime">The time over which the flowmeter code is averaged, in ms.</param>
+        public CalibrationSweepConfigPayload(
+            ushort firstDutyCycle,
+            ushort lastDutyCycle,
+            ushort steps,
+            ushort settleTime,
+            ushort averageTime)
         {
-            return Harp.Olfactometer.EnableTemperatureCalibration.FromPayload(timestamp, messageType, GetPayload());
+            FirstDutyCycle = firstDutyCycle;
+            LastDutyCycle = lastDutyCycle;
+            Steps = steps;
+            SettleTime = settleTime;
+            AverageTime = averageTime;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that temperature value measured during the device calibration.
-    /// </summary>
-    [DisplayName("TemperatureCalibrationValuePayload")]
-    [Description("Creates a message payload that temperature value measured during the device calibration.")]
-    public partial class CreateTemperatureCalibrationValuePayload
-    {
         /// <summary>
-        /// Gets or sets the value that temperature value measured during the device calibration.
+        /// The first duty cycle of the sweep, in 0.1 %.
         /// </summary>
-        [Description("The value that temperature value measured during the device calibration.")]
-        public byte TemperatureCalibrationValue { get; set; }
+        public ushort FirstDutyCycle;
 
         /// <summary>
-        /// Creates a message payload for the TemperatureCalibrationValue register.
+        /// The last duty cycle of the sweep, in 0.1 %.
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
-        {
-            return TemperatureCalibrationValue;
-        }
+        public ushort LastDutyCycle;
 
         /// <summary>
-        /// Creates a message that temperature value measured during the device calibration.
+        /// The number of duty cycles measured, from 2 to 255.
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the TemperatureCalibrationValue register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public ushort Steps;
+
+        /// <summary>
+        /// The time to wait after each duty cycle change, in ms.
+        /// </summary>
+        public ushort SettleTime;
+
+        /// <summary>
+        /// The time over which the flowmeter code is averaged, in ms.
+        /// </summary>
+        public ushort AverageTime;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the CalibrationSweepConfig register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// CalibrationSweepConfig register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.TemperatureCalibrationValue.FromPayload(messageType, GetPayload());
+            return "CalibrationSweepConfigPayload { " +
+                "FirstDutyCycle = " + FirstDutyCycle + ", " +
+                "LastDutyCycle = " + LastDutyCycle + ", " +
+                "Steps = " + Steps + ", " +
+                "SettleTime = " + SettleTime + ", " +
+                "AverageTime = " + AverageTime + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that temperature value measured during the device calibration.
+    /// Represents the payload of the TotalVolumeCommand register.
     /// </summary>
-    [DisplayName("TimestampedTemperatureCalibrationValuePayload")]
-    [Description("Creates a timestamped message payload that temperature value measured during the device calibration.")]
-    public partial class CreateTimestampedTemperatureCalibrationValuePayload : CreateTemperatureCalibrationValuePayload
+    public struct TotalVolumeCommandPayload
     {
         /// <summary>
-        /// Creates a timestamped message that temperature value measured during the device calibration.
+        /// Initializes a new instance of the <see cref="TotalVolumeCommandPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the TemperatureCalibrationValue register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="channels"></param>
+        /// <param name="latch"></param>
+        /// <param name="reset"></param>
+        public TotalVolumeCommandPayload(
+            FlowChannels channels,
+            bool latch,
+            bool reset)
         {
-            return Harp.Olfactometer.TemperatureCalibrationValue.FromPayload(timestamp, messageType, GetPayload());
+            Channels = channels;
+            Latch = latch;
+            Reset = reset;
         }
-    }
 
-    /// <summary>
-    /// Represents an operator that creates a message payload
-    /// that specifies the active events in the device.
-    /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that specifies the active events in the device.")]
-    public partial class CreateEnableEventsPayload
-    {
         /// <summary>
-        /// Gets or sets the value that specifies the active events in the device.
+        /// 
         /// </summary>
-        [Description("The value that specifies the active events in the device.")]
-        public OlfactometerEvents EnableEvents { get; set; }
+        public FlowChannels Channels;
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// 
         /// </summary>
-        /// <returns>The created message payload value.</returns>
-        public OlfactometerEvents GetPayload()
-        {
-            return EnableEvents;
-        }
+        public bool Latch;
 
         /// <summary>
-        /// Creates a message that specifies the active events in the device.
+        /// 
         /// </summary>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(MessageType messageType)
+        public bool Reset;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the TotalVolumeCommand register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// TotalVolumeCommand register.
+        /// </returns>
+        public override string ToString()
         {
-            return Harp.Olfactometer.EnableEvents.FromPayload(messageType, GetPayload());
+            return "TotalVolumeCommandPayload { " +
+                "Channels = " + Channels + ", " +
+                "Latch = " + Latch + ", " +
+                "Reset = " + Reset + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that specifies the active events in the device.
+    /// Represents the payload of the ProfilerControl register.
     /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    public struct ProfilerControlPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies the active events in the device.
+        /// Initializes a new instance of the <see cref="ProfilerControlPayload"/> structure.
         /// </summary>
-        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
-        /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
-        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        /// <param name="reset"></param>
+        /// <param name="available"></param>
+        public ProfilerControlPayload(
+            bool reset,
+            bool available)
         {
-            return Harp.Olfactometer.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            Reset = reset;
+            Available = available;
+        }
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public bool Reset;
+
+        /// <summary>
+        /// 
+        /// </summary>
+        public bool Available;
+
+        /// <summary>
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the ProfilerControl register.
+        /// </summary>
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// ProfilerControl register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "ProfilerControlPayload { " +
+                "Reset = " + Reset + ", " +
+                "Available = " + Available + " " +
+            "}";
         }
     }
 
     /// <summary>
-    /// Represents the payload of the Flowmeter register.
+    /// Represents the payload of the CpuLoad register.
     /// </summary>
-    public struct FlowmeterPayload
+    public struct CpuLoadPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="FlowmeterPayload"/> structure.
+        /// Initializes a new instance of the <see cref="CpuLoadPayload"/> structure.
         /// </summary>
-        /// <param name="channel0"></param>
-        /// <param name="channel1"></param>
-        /// <param name="channel2"></param>
-        /// <param name="channel3"></param>
-        /// <param name="channel4"></param>
-        public FlowmeterPayload(
-            short channel0,
-            short channel1,
-            short channel2,
-            short channel3,
-            short channel4)
+        /// <param name="load">The time spent in interrupts during the last second, in 0.1 %.</param>
+        /// <param name="peakLoad">The load of the busiest 1 ms slot of the last second, in 0.1 %.</param>
+        /// <param name="missedTicks">The 1 ms ticks missed during the last second.</param>
+        /// <param name="totalMissedTicks">The 1 ms ticks missed since reset or the last clear, saturates at 65535.</param>
+        public CpuLoadPayload(
+            ushort load,
+            ushort peakLoad,
+            ushort missedTicks,
+            ushort totalMissedTicks)
         {
-            Channel0 = channel0;
-            Channel1 = channel1;
-            Channel2 = channel2;
-            Channel3 = channel3;
-            Channel4 = channel4;
+            Load = load;
+            PeakLoad = peakLoad;
+            MissedTicks = missedTicks;
+            TotalMissedTicks = totalMissedTicks;
         }
 
         /// <summary>
-        /// 
-        /// </summary>
-        public short Channel0;
-
-        /// <summary>
-        /// 
+        /// The time spent in interrupts during the last second, in 0.1 %.
         /// </summary>
-        public short Channel1;
+        public ushort Load;
 
         /// <summary>
-        /// 
+        /// The load of the busiest 1 ms slot of the last second, in 0.1 %.
         /// </summary>
-        public short Channel2;
+        public ushort PeakLoad;
 
         /// <summary>
-        /// 
+        /// The 1 ms ticks missed during the last second.
         /// </summary>
-        public short Channel3;
+        public ushort MissedTicks;
 
         /// <summary>
-        /// 
+        /// The 1 ms ticks missed since reset or the last clear, saturates at 65535.
         /// </summary>
-        public short Channel4;
+        public ushort TotalMissedTicks;
 
         /// <summary>
         /// Returns a <see cref="string"/> that represents the payload of
-        /// the Flowmeter register.
+        /// the CpuLoad register.
         /// </summary>
         /// <returns>
         /// A <see cref="string"/> that represents the payload of the
-        /// Flowmeter register.
+        /// CpuLoad register.
         /// </returns>
         public override string ToString()
         {
-            return "FlowmeterPayload { " +
-                "Channel0 = " + Channel0 + ", " +
-                "Channel1 = " + Channel1 + ", " +
-                "Channel2 = " + Channel2 + ", " +
-                "Channel3 = " + Channel3 + ", " +
-                "Channel4 = " + Channel4 + " " +
+            return "CpuLoadPayload { " +
+                "Load = " + Load + ", " +
+                "PeakLoad = " + PeakLoad + ", " +
+                "MissedTicks = " + MissedTicks + ", " +
+                "TotalMissedTicks = " + TotalMissedTicks + " " +
             "}";
         }
     }
 
     /// <summary>
-    /// Represents the payload of the ChannelsTargetFlow register.
+    /// Represents the payload of the CpuLoadControl register.
     /// </summary>
-    public struct ChannelsTargetFlowPayload
+    public struct CpuLoadControlPayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="ChannelsTargetFlowPayload"/> structure.
+        /// Initializes a new instance of the <see cref="CpuLoadControlPayload"/> structure.
         /// </summary>
-        /// <param name="channel0"></param>
-        /// <param name="channel1"></param>
-        /// <param name="channel2"></param>
-        /// <param name="channel3"></param>
-        /// <param name="channel4"></param>
-        public ChannelsTargetFlowPayload(
-            float channel0,
-            float channel1,
-            float channel2,
-            float channel3,
-            float channel4)
+        /// <param name="event">Sends CpuLoad each second.</param>
+        /// <param name="clear">Clears the total of missed ticks.</param>
+        public CpuLoadControlPayload(
+            bool @event,
+            bool clear)
         {
-            Channel0 = channel0;
-            Channel1 = channel1;
-            Channel2 = channel2;
-            Channel3 = channel3;
-            Channel4 = channel4;
+            Event = @event;
+            Clear = clear;
         }
 
         /// <summary>
-        /// 
+        /// Sends CpuLoad each second.
         /// </summary>
-        public float Channel0;
+        public bool Event;
 
         /// <summary>
-        /// 
+        /// Clears the total of missed ticks.
         /// </summary>
-        public float Channel1;
+        public bool Clear;
 
         /// <summary>
-        /// 
+        /// Returns a <see cref="string"/> that represents the payload of
+        /// the CpuLoadControl register.
         /// </summary>
-        public float Channel2;
+        /// <returns>
+        /// A <see cref="string"/> that represents the payload of the
+        /// CpuLoadControl register.
+        /// </returns>
+        public override string ToString()
+        {
+            return "CpuLoadControlPayload { " +
+                "Event = " + Event + ", " +
+                "Clear = " + Clear + " " +
+            "}";
+        }
+    }
+
+    /// <summary>
+    /// Represents the payload of the CalibrationSource register.
+    /// </summary>
+    public struct CalibrationSourcePayload
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CalibrationSourcePayload"/> structure.
+        /// </summary>
+        /// <param name="source"></param>
+        /// <param name="recordDamaged"></param>
+        public CalibrationSourcePayload(
+            FactoryCalibrationSource source,
+            bool recordDamaged)
+        {
+            Source = source;
+            RecordDamaged = recordDamaged;
+        }
 
         /// <summary>
         /// 
         /// </summary>
-        public float Channel3;
+        public FactoryCalibrationSource Source;
 
         /// <summary>
         /// 
         /// </summary>
-        public float Channel4;
+        public bool RecordDamaged;
 
         /// <summary>
         /// Returns a <see cref="string"/> that represents the payload of
-        /// the ChannelsTargetFlow register.
+        /// the CalibrationSource register.
         /// </summary>
         /// <returns>
         /// A <see cref="string"/> that represents the payload of the
-        /// ChannelsTargetFlow register.
+        /// CalibrationSource register.
         /// </returns>
         public override string ToString()
         {
-            return "ChannelsTargetFlowPayload { " +
-                "Channel0 = " + Channel0 + ", " +
-                "Channel1 = " + Channel1 + ", " +
-                "Channel2 = " + Channel2 + ", " +
-                "Channel3 = " + Channel3 + ", " +
-                "Channel4 = " + Channel4 + " " +
+            return "CalibrationSourcePayload { " +
+                "Source = " + Source + ", " +
+                "RecordDamaged = " + RecordDamaged + " " +
             "}";
         }
     }
@@ -11824,6 +21485,32 @@ namespace Harp.Olfactometer
         ValveDummy = 0x40
     }
 
+    /// <summary>
+    /// Specifies the flow channels.
+    /// </summary>
+    [Flags]
+    public enum FlowChannels : byte
+    {
+        None = 0x0,
+        Channel0 = 0x1,
+        Channel1 = 0x2,
+        Channel2 = 0x4,
+        Channel3 = 0x8,
+        Channel4 = 0x10
+    }
+
+    /// <summary>
+    /// Specifies the warm start options.
+    /// </summary>
+    [Flags]
+    public enum WarmStartConfig : byte
+    {
+        None = 0x0,
+        Enable = 0x1,
+        SaveToEeprom = 0x2,
+        Clear = 0x4
+    }
+
     /// <summary>
     /// The events that can be enabled/disabled.
     /// </summary>
@@ -11833,7 +21520,12 @@ namespace Harp.Olfactometer
         None = 0x0,
         Flowmeter = 0x1,
         DI0Trigger = 0x2,
-        ChannelActualFlow = 0x4
+        ChannelActualFlow = 0x4,
+        ValvesEvent = 0x8,
+        ValvesTrainDone = 0x10,
+        SequenceControl = 0x20,
+        FlowSettled = 0x40,
+        CalibrationSweep = 0x80
     }
 
     /// <summary>
@@ -11851,7 +21543,15 @@ namespace Harp.Olfactometer
     public enum DO0SyncConfig : byte
     {
         None = 0,
-        MimicEnableFlow = 1
+        MimicEnableFlow = 1,
+        AdcClock = 2,
+        Heartbeat = 3,
+        SequenceStartPulse = 4,
+        Channel0FlowSettled = 8,
+        Channel1FlowSettled = 9,
+        Channel2FlowSettled = 10,
+        Channel3FlowSettled = 11,
+        Channel4FlowSettled = 12
     }
 
     /// <summary>
@@ -11860,7 +21560,15 @@ namespace Harp.Olfactometer
     public enum DO1SyncConfig : byte
     {
         None = 0,
-        MimicEnableFlow = 1
+        MimicEnableFlow = 1,
+        AdcClock = 2,
+        Heartbeat = 3,
+        SequenceStartPulse = 4,
+        Channel0FlowSettled = 8,
+        Channel1FlowSettled = 9,
+        Channel2FlowSettled = 10,
+        Channel3FlowSettled = 11,
+        Channel4FlowSettled = 12
     }
 
     /// <summary>
@@ -11870,7 +21578,8 @@ namespace Harp.Olfactometer
     {
         Sync = 0,
         EnableFlowWhileHigh = 1,
-        ValveToggle = 2
+        ValveToggle = 2,
+        StartSequence = 3
     }
 
     /// <summary>
@@ -11880,7 +21589,29 @@ namespace Harp.Olfactometer
     {
         None = 0,
         DO0 = 1,
-        DO1 = 2
+        DO1 = 2,
+        DO0AndDO1 = 3
+    }
+
+    /// <summary>
+    /// Where the factory calibration was read from.
+    /// </summary>
+    public enum FactoryCalibrationSource : byte
+    {
+        BuiltIn = 0,
+        Legacy = 1,
+        Record = 2
+    }
+
+    /// <summary>
+    /// The state of the odor delivery sequence.
+    /// </summary>
+    public enum SequenceState : byte
+    {
+        Idle = 0,
+        Armed = 1,
+        Running = 2,
+        SettleFailed = 3
     }
 
     /// <summary>
@@ -11889,6 +21620,7 @@ namespace Harp.Olfactometer
     public enum Channel3RangeConfig : byte
     {
         FlowRate100 = 0,
-        FlowRate1000 = 1
+        FlowRate1000 = 1,
+        FlowRateAuto = 2
     }
 }